@@ -22,6 +22,7 @@ LIBCOMPUTER_SOURCES = \
 	$(SRC)/Computer/ThermalBandComputer.cpp \
 	$(SRC)/Computer/Wind/Computer.cpp \
 	$(SRC)/Computer/ContestComputer.cpp \
+	$(SRC)/Computer/ContestThread.cpp \
 	$(SRC)/Computer/TraceComputer.cpp \
 	$(SRC)/Computer/WarningComputer.cpp \
 	$(SRC)/Computer/ThermalRecency.cpp \
@@ -44,8 +45,11 @@ LIBCOMPUTER_SOURCES = \
 	$(SRC)/Computer/BasicComputer.cpp \
 	$(SRC)/Computer/GroundSpeedComputer.cpp \
 	$(SRC)/Computer/AutoQNH.cpp \
+	$(SRC)/Computer/ComputerStage.cpp \
+	$(SRC)/Computer/StageTiming.cpp \
+	$(SRC)/Computer/StageTimer.cpp \
 	$(SRC)/Computer/Settings.cpp
 
-LIBCOMPUTER_DEPENDS = AIRSPACE TASK GEO LIBNMEA
+LIBCOMPUTER_DEPENDS = AIRSPACE TASK GEO LIBNMEA PROFILER
 
 $(eval $(call link-library,libcomputer,LIBCOMPUTER))
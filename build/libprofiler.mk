@@ -0,0 +1,9 @@
+# Build rules for the runtime profiler
+
+PROFILER_SOURCES = \
+	$(SRC)/Profiler/Profiler.cpp \
+	$(SRC)/Profiler/ChromeTrace.cpp
+
+PROFILER_DEPENDS = IO UTIL
+
+$(eval $(call link-library,libprofiler,PROFILER))
@@ -20,6 +20,6 @@ TERRAIN_SOURCES = \
 TERRAIN_CXXFLAGS_INTERNAL = -Wno-shift-negative-value
 TERRAIN_CPPFLAGS_INTERNAL = $(SCREEN_CPPFLAGS)
 
-TERRAIN_DEPENDS = JASPER ZZIP GEO UTIL
+TERRAIN_DEPENDS = JASPER ZZIP GEO PROFILER UTIL
 
 $(eval $(call link-library,libterrain,TERRAIN))
@@ -21,6 +21,7 @@ LUA_SOURCES = \
 	$(SRC)/lua/Log.cpp \
 	$(SRC)/lua/Http.cpp \
 	$(SRC)/lua/Timer.cpp \
+	$(SRC)/lua/Async.cpp \
 	$(SRC)/lua/Geo.cpp \
 	$(SRC)/lua/Map.cpp \
 	$(SRC)/lua/Blackboard.cpp \
@@ -35,6 +36,8 @@ LUA_SOURCES = \
 	$(SRC)/lua/Logger.cpp \
 	$(SRC)/lua/Tracking.cpp \
 	$(SRC)/lua/Replay.cpp \
+	$(SRC)/lua/Profiler.cpp \
+	$(SRC)/lua/Property.cpp \
 	$(SRC)/lua/InputEvent.cpp \
 
 ifeq ($(TARGET),ANDROID)
@@ -35,6 +35,6 @@ LIBMAPWINDOW_SOURCES += \
 	$(SRC)/MapWindow/OverlayBitmap.cpp
 endif
 
-LIBMAPWINDOW_DEPENDS = SCREEN
+LIBMAPWINDOW_DEPENDS = SCREEN PROFILER
 
 $(eval $(call link-library,libmapwindow,LIBMAPWINDOW))
@@ -30,12 +30,6 @@ endif
 # (e.g. "address,undefined").
 SANITIZE ?= n
 
-# show map renderer times?
-STOP_WATCH ?= n
-ifeq ($(STOP_WATCH),y)
-  TARGET_CPPFLAGS += -DSTOP_WATCH
-endif
-
 # compile without UI?
 HEADLESS ?= n
 
@@ -69,6 +69,7 @@ $$(eval $$(call link-program,$(1),$(1)))
 endef
 
 $(foreach name,$(HARNESS_PROGRAMS),$(eval $(call link-harness-program,$(name))))
+$(eval $(call link-harness-program,BenchmarkTaskMacCready))
 
 TEST_NAMES = \
 	test_fixed \
@@ -81,12 +82,14 @@ TEST_NAMES = \
 	TestTransponderCode \
 	TestMath \
 	TestMathTables \
+	TestAudioAlgorithms \
 	TestAngle TestARange \
 	TestGrahamScan \
 	TestUnits TestEarth TestSunEphemeris \
 	TestValidity TestUTM \
 	TestAllocatedGrid \
-	TestRadixTree TestGeoBounds TestGeoClip \
+	TestRadixTree TestRadixQueue TestGeoBounds TestGeoClip \
+	TestProfiler TestStageTiming TestContestThread TestGlideComputerReplay \
 	TestLogger TestGRecord TestClimbAvCalc \
 	TestWaypointReader TestThermalBase \
 	TestFlarmNet \
@@ -111,6 +114,9 @@ TEST_NAMES = \
 	TestTimeFormatter \
 	TestIGCFilenameFormatter \
 	TestNMEAFormatter \
+	TestLineSplitter \
+	TestNMEASentence \
+	TestSensorStreams \
 	TestLXNToIGC \
 	TestLeastSquares \
 	TestHexString \
@@ -318,6 +324,11 @@ TEST_REACH_SOURCES = \
 TEST_REACH_DEPENDS = TERRAIN OPERATION IO ZZIP OS ROUTE GLIDE GEO MATH UTIL
 $(eval $(call link-program,test_reach,TEST_REACH))
 
+BENCHMARK_REACH_SOURCES = \
+	$(TEST_SRC_DIR)/BenchmarkReach.cpp
+BENCHMARK_REACH_DEPENDS = TERRAIN OPERATION IO ZZIP OS ROUTE GLIDE GEO MATH UTIL
+$(eval $(call link-program,BenchmarkReach,BENCHMARK_REACH))
+
 TEST_ROUTE_SOURCES = \
 	$(SRC)/Engine/Navigation/Aircraft.cpp \
 	$(SRC)/Engine/Util/Gradient.cpp \
@@ -359,6 +370,13 @@ TEST_MATH_TABLES_SOURCES = \
 TEST_MATH_TABLES_DEPENDS = MATH
 $(eval $(call link-program,TestMathTables,TEST_MATH_TABLES))
 
+TEST_AUDIO_ALGORITHMS_SOURCES = \
+	$(SRC)/Audio/ToneSynthesiser.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestAudioAlgorithms.cpp
+TEST_AUDIO_ALGORITHMS_DEPENDS = MATH
+$(eval $(call link-program,TestAudioAlgorithms,TEST_AUDIO_ALGORITHMS))
+
 TEST_ANGLE_SOURCES = \
 	$(TEST_SRC_DIR)/tap.c \
 	$(TEST_SRC_DIR)/TestAngle.cpp
@@ -519,6 +537,7 @@ TEST_POLARS_DEPENDS = IO OS MATH UTIL UNITS
 $(eval $(call link-program,TestPolars,TEST_POLARS))
 
 TEST_GLIDE_POLAR_SOURCES = \
+	$(ENGINE_SRC_DIR)/GlideSolvers/GlideSettings.cpp \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlidePolar.cpp \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlideResult.cpp \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlideState.cpp \
@@ -617,6 +636,58 @@ TEST_RADIX_TREE_SOURCES = \
 TEST_RADIX_TREE_DEPENDS = UTIL
 $(eval $(call link-program,TestRadixTree,TEST_RADIX_TREE))
 
+TEST_RADIX_QUEUE_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestRadixQueue.cpp
+TEST_RADIX_QUEUE_DEPENDS = UTIL
+$(eval $(call link-program,TestRadixQueue,TEST_RADIX_QUEUE))
+
+TEST_PROFILER_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestProfiler.cpp
+TEST_PROFILER_DEPENDS = PROFILER
+$(eval $(call link-program,TestProfiler,TEST_PROFILER))
+
+TEST_STAGE_TIMING_SOURCES = \
+	$(SRC)/Computer/StageTiming.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestStageTiming.cpp
+$(eval $(call link-program,TestStageTiming,TEST_STAGE_TIMING))
+
+TEST_CONTEST_THREAD_SOURCES = \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Computer/TraceComputer.cpp \
+	$(SRC)/Computer/ContestComputer.cpp \
+	$(SRC)/Computer/ContestThread.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestContestThread.cpp
+TEST_CONTEST_THREAD_DEPENDS = CONTEST PROFILER THREAD IO OS GEO MATH UTIL
+$(eval $(call link-program,TestContestThread,TEST_CONTEST_THREAD))
+
+TEST_LINE_SPLITTER_SOURCES = \
+	$(SRC)/Device/Util/LineSplitter.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestLineSplitter.cpp
+TEST_LINE_SPLITTER_DEPENDS = UTIL
+$(eval $(call link-program,TestLineSplitter,TEST_LINE_SPLITTER))
+
+TEST_NMEA_SENTENCE_SOURCES = \
+	$(SRC)/io/CSVLine.cpp \
+	$(SRC)/NMEA/Checksum.cpp \
+	$(SRC)/NMEA/Sentence.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestNMEASentence.cpp
+TEST_NMEA_SENTENCE_DEPENDS = MATH
+$(eval $(call link-program,TestNMEASentence,TEST_NMEA_SENTENCE))
+
+TEST_SENSOR_STREAMS_SOURCES = \
+	$(SRC)/Atmosphere/AirDensity.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestSensorStreams.cpp
+TEST_SENSOR_STREAMS_DEPENDS = LIBNMEA GEO MATH UTIL TIME UNITS
+$(eval $(call link-program,TestSensorStreams,TEST_SENSOR_STREAMS))
+
 TEST_LOGGER_SOURCES = \
 	$(SRC)/IGC/IGCFix.cpp \
 	$(SRC)/IGC/IGCWriter.cpp \
@@ -625,12 +696,13 @@ TEST_LOGGER_SOURCES = \
 	$(SRC)/Logger/LoggerFRecord.cpp \
 	$(SRC)/Logger/GRecord.cpp \
 	$(SRC)/Logger/LoggerEPE.cpp \
+	$(SRC)/Logger/AsyncLogWriter.cpp \
 	$(SRC)/util/MD5.cpp \
 	$(SRC)/Version.cpp \
 	$(SRC)/Atmosphere/Pressure.cpp \
 	$(TEST_SRC_DIR)/tap.c \
 	$(TEST_SRC_DIR)/TestLogger.cpp
-TEST_LOGGER_DEPENDS = IO OS GEO MATH UTIL UNITS
+TEST_LOGGER_DEPENDS = PROFILER IO OS THREAD GEO MATH UTIL UNITS
 $(eval $(call link-program,TestLogger,TEST_LOGGER))
 
 TEST_GRECORD_SOURCES = \
@@ -708,6 +780,10 @@ check-no-build: $(OUT)/test/dirstamp
 
 DEBUG_PROGRAM_NAMES = \
 	test_reach \
+	BenchmarkReach \
+	BenchmarkRouteReplay \
+	BenchmarkTaskMacCready \
+	BenchmarkNMEAParser \
 	test_route \
 	test_troute \
 	TestTrace \
@@ -720,6 +796,8 @@ DEBUG_PROGRAM_NAMES = \
 	ReadMO \
 	RunMD5 RunSHA256 \
 	ReadGRecord VerifyGRecord AppendGRecord FixGRecord \
+	BenchmarkGRecord \
+	BenchmarkVario \
 	AddChecksum \
 	LoadTopography LoadTerrain \
 	RunHeightMatrix \
@@ -748,6 +826,7 @@ DEBUG_PROGRAM_NAMES += \
 	ReadPort RunPortHandler LogPort \
 	SplicePorts \
 	RunDeviceDriver RunDeclare RunFlightList RunDownloadFlight \
+	RunSensorLatency \
 	RunEnableNMEA \
 	CAI302Tool \
 	RunIGCWriter \
@@ -757,6 +836,8 @@ DEBUG_PROGRAM_NAMES += \
 	RunTask \
 	LoadImage ViewImage \
 	RunCanvas RunMapWindow \
+	BenchmarkTextRenderer \
+	BenchmarkAirspaceRenderer \
 	RunListControl \
 	RunTextEntry RunNumberEntry RunDateEntry RunTimeEntry RunAngleEntry \
 	RunGeoPointEntry \
@@ -771,6 +852,8 @@ DEBUG_PROGRAM_NAMES += \
 	RunProgressWindow \
 	RunJobDialog \
 	RunAnalysis \
+	RunGlideComputer \
+	RunBatchReplay \
 	RunAirspaceWarningDialog \
 	RunProfileListDialog \
 	TestNotify \
@@ -1058,9 +1141,24 @@ VERIFY_GRECORD_SOURCES = \
 	$(SRC)/Logger/GRecord.cpp \
 	$(SRC)/util/MD5.cpp \
 	$(TEST_SRC_DIR)/VerifyGRecord.cpp
-VERIFY_GRECORD_DEPENDS = IO OS UTIL
+VERIFY_GRECORD_DEPENDS = IO OS THREAD UTIL
 $(eval $(call link-program,VerifyGRecord,VERIFY_GRECORD))
 
+BENCHMARK_GRECORD_SOURCES = \
+	$(SRC)/Logger/GRecord.cpp \
+	$(SRC)/util/MD5.cpp \
+	$(TEST_SRC_DIR)/BenchmarkGRecord.cpp
+BENCHMARK_GRECORD_DEPENDS = IO OS THREAD UTIL
+$(eval $(call link-program,BenchmarkGRecord,BENCHMARK_GRECORD))
+
+BENCHMARK_VARIO_SOURCES = \
+	$(SRC)/Audio/ToneSynthesiser.cpp \
+	$(SRC)/Audio/VarioSynthesiser.cpp \
+	$(SRC)/Audio/PCMMixerDataSource.cpp \
+	$(TEST_SRC_DIR)/BenchmarkVario.cpp
+BENCHMARK_VARIO_DEPENDS = MATH UTIL
+$(eval $(call link-program,BenchmarkVario,BENCHMARK_VARIO))
+
 APPEND_GRECORD_SOURCES = \
 	$(SRC)/Logger/GRecord.cpp \
 	$(SRC)/util/MD5.cpp \
@@ -1248,6 +1346,56 @@ RUN_DEVICE_DRIVER_SOURCES = \
 RUN_DEVICE_DRIVER_DEPENDS = DRIVER OPERATION IO LIBNMEA OS THREAD GEO MATH UTIL TIME
 $(eval $(call link-program,RunDeviceDriver,RUN_DEVICE_DRIVER))
 
+BENCHMARK_NMEA_PARSER_SOURCES = \
+	$(SRC)/FLARM/Id.cpp \
+	$(SRC)/Device/Port/Port.cpp \
+	$(SRC)/Device/Port/NullPort.cpp \
+	$(SRC)/Device/Parser.cpp \
+	$(SRC)/Device/Util/NMEAWriter.cpp \
+	$(SRC)/Device/Util/NMEAReader.cpp \
+	$(SRC)/Device/Config.cpp \
+	$(SRC)/FLARM/Traffic.cpp \
+	$(SRC)/FLARM/List.cpp \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/IGC/Generator.cpp \
+	$(SRC)/FLARM/Calculations.cpp \
+	$(SRC)/Computer/ClimbAverageCalculator.cpp \
+	$(SRC)/Atmosphere/AirDensity.cpp \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(SRC)/TransponderCode.cpp \
+	$(SRC)/Formatter/NMEAFormatter.cpp \
+	$(TEST_SRC_DIR)/FakeMessage.cpp \
+	$(TEST_SRC_DIR)/FakeLanguage.cpp \
+	$(TEST_SRC_DIR)/FakeGeoid.cpp \
+	$(TEST_SRC_DIR)/BenchmarkNMEAParser.cpp
+BENCHMARK_NMEA_PARSER_DEPENDS = DRIVER OPERATION IO LIBNMEA OS THREAD GEO MATH UTIL TIME
+$(eval $(call link-program,BenchmarkNMEAParser,BENCHMARK_NMEA_PARSER))
+
+RUN_SENSOR_LATENCY_SOURCES = \
+	$(SRC)/FLARM/Id.cpp \
+	$(SRC)/Device/Port/Port.cpp \
+	$(SRC)/Device/Port/NullPort.cpp \
+	$(SRC)/Device/Parser.cpp \
+	$(SRC)/Device/Util/NMEAWriter.cpp \
+	$(SRC)/Device/Util/NMEAReader.cpp \
+	$(SRC)/Device/Config.cpp \
+	$(SRC)/FLARM/Traffic.cpp \
+	$(SRC)/FLARM/List.cpp \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/IGC/Generator.cpp \
+	$(SRC)/FLARM/Calculations.cpp \
+	$(SRC)/Computer/ClimbAverageCalculator.cpp \
+	$(SRC)/Atmosphere/AirDensity.cpp \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(SRC)/TransponderCode.cpp \
+	$(SRC)/Formatter/NMEAFormatter.cpp \
+	$(TEST_SRC_DIR)/FakeMessage.cpp \
+	$(TEST_SRC_DIR)/FakeLanguage.cpp \
+	$(TEST_SRC_DIR)/FakeGeoid.cpp \
+	$(TEST_SRC_DIR)/RunSensorLatency.cpp
+RUN_SENSOR_LATENCY_DEPENDS = DRIVER OPERATION IO LIBNMEA OS THREAD GEO MATH UTIL TIME
+$(eval $(call link-program,RunSensorLatency,RUN_SENSOR_LATENCY))
+
 RUN_DECLARE_SOURCES = \
 	$(SRC)/Device/Port/ConfiguredPort.cpp \
 	$(SRC)/Device/Util/NMEAWriter.cpp \
@@ -1422,11 +1570,12 @@ RUN_IGC_WRITER_SOURCES = \
 	$(SRC)/Logger/LoggerFRecord.cpp \
 	$(SRC)/Logger/GRecord.cpp \
 	$(SRC)/Logger/LoggerEPE.cpp \
+	$(SRC)/Logger/AsyncLogWriter.cpp \
 	$(SRC)/util/MD5.cpp \
 	$(SRC)/TransponderCode.cpp \
 	$(SRC)/Formatter/NMEAFormatter.cpp \
 	$(TEST_SRC_DIR)/RunIGCWriter.cpp
-RUN_IGC_WRITER_DEPENDS = $(DEBUG_REPLAY_DEPENDS) GEO MATH UTIL
+RUN_IGC_WRITER_DEPENDS = $(DEBUG_REPLAY_DEPENDS) PROFILER THREAD GEO MATH UTIL
 $(eval $(call link-program,RunIGCWriter,RUN_IGC_WRITER))
 
 RUN_FLIGHT_LOGGER_SOURCES = \
@@ -1527,6 +1676,15 @@ RUN_TRACE_SOURCES = \
 RUN_TRACE_DEPENDS = $(DEBUG_REPLAY_DEPENDS) UTIL LIBNMEA GEO MATH TIME
 $(eval $(call link-program,RunTrace,RUN_TRACE))
 
+BENCHMARK_ROUTE_REPLAY_SOURCES = \
+	$(DEBUG_REPLAY_SOURCES) \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/TransponderCode.cpp \
+	$(SRC)/Formatter/NMEAFormatter.cpp \
+	$(TEST_SRC_DIR)/BenchmarkRouteReplay.cpp
+BENCHMARK_ROUTE_REPLAY_DEPENDS = TERRAIN OPERATION ROUTE GLIDE $(DEBUG_REPLAY_DEPENDS) ZZIP LIBNMEA GEO MATH UTIL TIME
+$(eval $(call link-program,BenchmarkRouteReplay,BENCHMARK_ROUTE_REPLAY))
+
 RUN_CONTEST_SOURCES = \
 	$(DEBUG_REPLAY_SOURCES) \
 	$(SRC)/IGC/IGCParser.cpp \
@@ -1576,6 +1734,53 @@ ANALYSE_FLIGHT_SOURCES = \
 ANALYSE_FLIGHT_DEPENDS = $(DEBUG_REPLAY_DEPENDS) CONTEST JSON UTIL GEO MATH TIME
 $(eval $(call link-program,AnalyseFlight,ANALYSE_FLIGHT))
 
+GLIDE_COMPUTER_REPLAY_SOURCES = \
+	$(DEBUG_REPLAY_SOURCES) \
+	$(SRC)/Task/ProtectedTaskManager.cpp \
+	$(SRC)/Task/ProtectedRoutePlanner.cpp \
+	$(SRC)/Task/RoutePlannerGlue.cpp \
+	$(SRC)/Airspace/ProtectedAirspaceWarningManager.cpp \
+	$(SRC)/Airspace/AirspaceParser.cpp \
+	$(SRC)/Airspace/ActivePredicate.cpp \
+	$(SRC)/Airspace/AirspaceComputerSettings.cpp \
+	$(SRC)/Atmosphere/CuSonde.cpp \
+	$(SRC)/Engine/Util/Gradient.cpp \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/FlightStatistics.cpp \
+	$(SRC)/Logger/Settings.cpp \
+	$(SRC)/Math/SunEphemeris.cpp \
+	$(SRC)/RadioFrequency.cpp \
+	$(SRC)/TeamCode/TeamCode.cpp \
+	$(SRC)/TeamCode/Settings.cpp \
+	$(SRC)/TransponderCode.cpp \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(SRC)/Waypoint/Factory.cpp \
+	$(TEST_SRC_DIR)/FakeProfile.cpp \
+	$(TEST_SRC_DIR)/GlideComputerReplay.cpp
+GLIDE_COMPUTER_REPLAY_DEPENDS = $(DEBUG_REPLAY_DEPENDS) \
+	LIBCOMPUTER TASKFILE CONTEST ROUTE GLIDE WAYPOINTFILE WAYPOINT \
+	AIRSPACE TERRAIN ZZIP OPERATION FMT UTIL GEO MATH
+
+RUN_GLIDE_COMPUTER_SOURCES = \
+	$(GLIDE_COMPUTER_REPLAY_SOURCES) \
+	$(TEST_SRC_DIR)/RunGlideComputer.cpp
+RUN_GLIDE_COMPUTER_DEPENDS = $(GLIDE_COMPUTER_REPLAY_DEPENDS)
+$(eval $(call link-program,RunGlideComputer,RUN_GLIDE_COMPUTER))
+
+RUN_BATCH_REPLAY_SOURCES = \
+	$(GLIDE_COMPUTER_REPLAY_SOURCES) \
+	$(TEST_SRC_DIR)/RunBatchReplay.cpp
+RUN_BATCH_REPLAY_DEPENDS = $(GLIDE_COMPUTER_REPLAY_DEPENDS) JSON
+$(eval $(call link-program,RunBatchReplay,RUN_BATCH_REPLAY))
+
+TEST_GLIDE_COMPUTER_REPLAY_SOURCES = \
+	$(GLIDE_COMPUTER_REPLAY_SOURCES) \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestGlideComputerReplay.cpp
+TEST_GLIDE_COMPUTER_REPLAY_DEPENDS = $(GLIDE_COMPUTER_REPLAY_DEPENDS)
+$(eval $(call link-program,TestGlideComputerReplay,TEST_GLIDE_COMPUTER_REPLAY))
+
 FLIGHT_PATH_SOURCES = \
 	$(DEBUG_REPLAY_SOURCES) \
 	$(SRC)/TransponderCode.cpp \
@@ -1621,6 +1826,42 @@ RUN_CANVAS_LDADD = $(FAKE_LIBS)
 RUN_CANVAS_DEPENDS = FORM SCREEN EVENT ASYNC OS IO THREAD MATH UTIL
 $(eval $(call link-program,RunCanvas,RUN_CANVAS))
 
+BENCHMARK_TEXT_RENDERER_SOURCES = \
+	$(MORE_SCREEN_SOURCES) \
+	$(SRC)/Compatibility/fmode.c \
+	$(TEST_SRC_DIR)/Fonts.cpp \
+	$(TEST_SRC_DIR)/FakeAsset.cpp \
+	$(TEST_SRC_DIR)/BenchmarkTextRenderer.cpp
+BENCHMARK_TEXT_RENDERER_LDADD = $(FAKE_LIBS)
+BENCHMARK_TEXT_RENDERER_DEPENDS = FORM SCREEN EVENT ASYNC OS IO THREAD MATH UTIL
+$(eval $(call link-program,BenchmarkTextRenderer,BENCHMARK_TEXT_RENDERER))
+
+BENCHMARK_AIRSPACE_RENDERER_SOURCES = \
+	$(MORE_SCREEN_SOURCES) \
+	$(SRC)/Airspace/AirspaceParser.cpp \
+	$(SRC)/Airspace/AirspaceVisibility.cpp \
+	$(SRC)/Airspace/AirspaceComputerSettings.cpp \
+	$(SRC)/Airspace/ProtectedAirspaceWarningManager.cpp \
+	$(SRC)/Look/AirspaceLook.cpp \
+	$(SRC)/Projection/Projection.cpp \
+	$(SRC)/Projection/WindowProjection.cpp \
+	$(SRC)/MapWindow/MapCanvas.cpp \
+	$(SRC)/MapWindow/StencilMapCanvas.cpp \
+	$(SRC)/Math/Screen.cpp \
+	$(SRC)/Renderer/TransparentRendererCache.cpp \
+	$(SRC)/Renderer/AirspaceRendererSettings.cpp \
+	$(SRC)/Renderer/AirspaceRenderer.cpp \
+	$(SRC)/Renderer/AirspaceRendererGL.cpp \
+	$(SRC)/Renderer/AirspaceGeometryCache.cpp \
+	$(SRC)/Renderer/AirspaceRendererOther.cpp \
+	$(SRC)/Compatibility/fmode.c \
+	$(TEST_SRC_DIR)/Fonts.cpp \
+	$(TEST_SRC_DIR)/FakeAsset.cpp \
+	$(TEST_SRC_DIR)/BenchmarkAirspaceRenderer.cpp
+BENCHMARK_AIRSPACE_RENDERER_LDADD = $(FAKE_LIBS)
+BENCHMARK_AIRSPACE_RENDERER_DEPENDS = FORM SCREEN EVENT RESOURCE ASYNC OS IO THREAD AIRSPACE GEO MATH UTIL
+$(eval $(call link-program,BenchmarkAirspaceRenderer,BENCHMARK_AIRSPACE_RENDERER))
+
 RUN_MAP_WINDOW_SOURCES = \
 	$(CONTEST_SRC_DIR)/Settings.cpp \
 	$(SRC)/Engine/Util/Gradient.cpp \
@@ -1662,6 +1903,7 @@ RUN_MAP_WINDOW_SOURCES = \
 	$(SRC)/Renderer/AircraftRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRendererGL.cpp \
+	$(SRC)/Renderer/AirspaceGeometryCache.cpp \
 	$(SRC)/Renderer/AirspaceRendererOther.cpp \
 	$(SRC)/Renderer/AirspaceLabelList.cpp \
 	$(SRC)/Renderer/AirspaceLabelRenderer.cpp \
@@ -1671,6 +1913,7 @@ RUN_MAP_WINDOW_SOURCES = \
 	$(SRC)/Renderer/TrackLineRenderer.cpp \
 	$(SRC)/Renderer/TrafficRenderer.cpp \
 	$(SRC)/Renderer/TrailRenderer.cpp \
+	$(SRC)/Renderer/TrailBuffer.cpp \
 	$(SRC)/Renderer/WaypointIconRenderer.cpp \
 	$(SRC)/Renderer/WaypointRenderer.cpp \
 	$(SRC)/Renderer/WaypointRendererSettings.cpp \
@@ -2064,6 +2307,7 @@ RUN_ANALYSIS_SOURCES = \
 	$(SRC)/Renderer/GeoBitmapRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRendererGL.cpp \
+	$(SRC)/Renderer/AirspaceGeometryCache.cpp \
 	$(SRC)/Renderer/AirspaceRendererOther.cpp \
 	$(SRC)/Renderer/TransparentRendererCache.cpp \
 	$(SRC)/Renderer/GradientRenderer.cpp \
@@ -2073,6 +2317,7 @@ RUN_ANALYSIS_SOURCES = \
 	$(SRC)/Renderer/OZRenderer.cpp \
 	$(SRC)/Renderer/AircraftRenderer.cpp \
 	$(SRC)/Renderer/TrailRenderer.cpp \
+	$(SRC)/Renderer/TrailBuffer.cpp \
 	$(SRC)/MapWindow/MapCanvas.cpp \
 	$(SRC)/MapWindow/StencilMapCanvas.cpp \
 	$(SRC)/Units/Units.cpp \
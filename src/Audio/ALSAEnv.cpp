@@ -17,9 +17,11 @@ namespace ALSAEnv
 
 static constexpr char ALSA_DEVICE_ENV[] = "ALSA_DEVICE";
 static constexpr char ALSA_LATENCY_ENV[] = "ALSA_LATENCY";
+static constexpr char ALSA_PERIODS_ENV[] = "ALSA_PERIODS";
 
 static constexpr char DEFAULT_ALSA_DEVICE[] = "default";
 static constexpr unsigned DEFAULT_ALSA_LATENCY = 100000;
+static constexpr unsigned DEFAULT_ALSA_PERIODS = 4;
 
 
 static const char *InitALSADeviceName()
@@ -44,7 +46,7 @@ static unsigned InitALSALatency()
     latency = ParseUnsigned(latency_env_value, &p);
     if (*p != '\0') {
       LogFormat("Invalid %s value \"%s\"", ALSA_LATENCY_ENV, latency_env_value);
-      return false;
+      latency = DEFAULT_ALSA_LATENCY;
     }
   }
   LogFormat("Using ALSA PCM latency %u μs (use environment variable "
@@ -52,6 +54,25 @@ static unsigned InitALSALatency()
   return latency;
 }
 
+static unsigned InitALSAPeriods()
+{
+  unsigned periods;
+  const char *periods_env_value = getenv(ALSA_PERIODS_ENV);
+  if ((nullptr == periods_env_value) || ('\0' == *periods_env_value)) {
+    periods = DEFAULT_ALSA_PERIODS;
+  } else {
+    char *p;
+    periods = ParseUnsigned(periods_env_value, &p);
+    if (*p != '\0' || periods < 2) {
+      LogFormat("Invalid %s value \"%s\"", ALSA_PERIODS_ENV, periods_env_value);
+      periods = DEFAULT_ALSA_PERIODS;
+    }
+  }
+  LogFormat("Using %u ALSA PCM periods (use environment variable "
+                "%s to override)", periods, ALSA_PERIODS_ENV);
+  return periods;
+}
+
 const char *GetALSADeviceName()
 {
   static const char *alsa_device = InitALSADeviceName();
@@ -65,4 +86,10 @@ unsigned GetALSALatency()
   return alsa_latency;
 }
 
+unsigned GetALSAPeriods()
+{
+  static unsigned alsa_periods = InitALSAPeriods();
+  return alsa_periods;
+}
+
 }
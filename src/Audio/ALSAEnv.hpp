@@ -26,7 +26,20 @@ namespace ALSAEnv
    * underruns.
    *
    * @return Value of the environment variable "ALSA_LATENCY", parsed as
-   * unsigned, or 10000 if not set, or unparsable. The unit is μs.
+   * unsigned, or 100000 if not set, or unparsable. The unit is μs.
    */
   unsigned GetALSALatency();
+
+  /**
+   * Get the desired number of periods in the ALSA PCM buffer.  The
+   * period time is the latency divided by this value; the player
+   * refills the buffer once per period.
+   *
+   * Together with a small "ALSA_LATENCY", a value of 2 gives the
+   * lowest latency, at the cost of more frequent wakeups.
+   *
+   * @return Value of the environment variable "ALSA_PERIODS", parsed as
+   * unsigned, or 4 if not set, unparsable or less than 2.
+   */
+  unsigned GetALSAPeriods();
 }
@@ -60,7 +60,7 @@ class ALSAPCMPlayer : public PCMPlayer {
 
   static bool SetParameters(snd_pcm_t &alsa_handle, unsigned sample_rate,
                             bool big_endian_source, unsigned latency,
-                            unsigned &channels);
+                            unsigned periods, unsigned &channels);
 
 public:
   explicit ALSAPCMPlayer(EventLoop &event_loop) noexcept;
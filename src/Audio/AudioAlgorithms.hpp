@@ -14,6 +14,12 @@
 #include <cstddef>
 #include <cstdint>
 
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /* Algorithms for processing audio data */
 
 /**
@@ -47,6 +53,85 @@ constexpr int16_t Clip(int32_t value) noexcept {
           static_cast<int32_t>(std::numeric_limits<int16_t>::max())));
 }
 
+/**
+ * Convert a volume percentage to a gain factor for ScalePCM() and
+ * MixScaledPCM().  The gain is a Q15 fixed point number; 100% maps
+ * to 32767, which is a tiny bit below unity.
+ */
+constexpr int16_t VolumeToGain(unsigned vol_percent) noexcept {
+  return vol_percent >= 100
+    ? 32767
+    : static_cast<int16_t>(vol_percent * 32768 / 100);
+}
+
+/**
+ * Multiply a sample with a gain factor (see VolumeToGain()).
+ */
+constexpr int16_t ScaleSample(int32_t sample, int16_t gain) noexcept {
+  return static_cast<int16_t>((sample * gain) >> 15);
+}
+
+/**
+ * Multiply all samples of a PCM buffer with a gain factor (see
+ * VolumeToGain()).  Uses NEON or SSE2 if available.
+ */
+inline void ScalePCM(int16_t *buffer, size_t num_frames,
+                     int16_t gain) noexcept {
+  size_t i = 0;
+
+#ifdef __ARM_NEON__
+  const int16x8_t g = vdupq_n_s16(gain);
+  for (; i + 8 <= num_frames; i += 8)
+    vst1q_s16(buffer + i, vqdmulhq_s16(vld1q_s16(buffer + i), g));
+#elif defined(__SSE2__)
+  const __m128i g = _mm_set1_epi16(gain);
+  for (; i + 8 <= num_frames; i += 8) {
+    __m128i *p = reinterpret_cast<__m128i *>(buffer + i);
+    const __m128i x = _mm_loadu_si128(p);
+    /* combine bits 15..30 of the 32 bit products */
+    const __m128i hi = _mm_mulhi_epi16(x, g), lo = _mm_mullo_epi16(x, g);
+    _mm_storeu_si128(p, _mm_or_si128(_mm_slli_epi16(hi, 1),
+                                     _mm_srli_epi16(lo, 15)));
+  }
+#endif
+
+  for (; i < num_frames; ++i)
+    buffer[i] = ScaleSample(buffer[i], gain);
+}
+
+/**
+ * Multiply samples with a gain factor (see VolumeToGain()) and add
+ * them to a destination buffer (which already contains PCM data).
+ * Uses NEON or SSE2 if available.
+ *
+ * Performs clipping, if necessary.
+ */
+inline void MixScaledPCM(int16_t *dest, const int16_t *src,
+                         size_t num_frames, int16_t gain) noexcept {
+  size_t i = 0;
+
+#ifdef __ARM_NEON__
+  const int16x8_t g = vdupq_n_s16(gain);
+  for (; i + 8 <= num_frames; i += 8)
+    vst1q_s16(dest + i, vqaddq_s16(vld1q_s16(dest + i),
+                                   vqdmulhq_s16(vld1q_s16(src + i), g)));
+#elif defined(__SSE2__)
+  const __m128i g = _mm_set1_epi16(gain);
+  for (; i + 8 <= num_frames; i += 8) {
+    __m128i *d = reinterpret_cast<__m128i *>(dest + i);
+    const __m128i x =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    const __m128i hi = _mm_mulhi_epi16(x, g), lo = _mm_mullo_epi16(x, g);
+    const __m128i scaled = _mm_or_si128(_mm_slli_epi16(hi, 1),
+                                        _mm_srli_epi16(lo, 15));
+    _mm_storeu_si128(d, _mm_adds_epi16(_mm_loadu_si128(d), scaled));
+  }
+#endif
+
+  for (; i < num_frames; ++i)
+    dest[i] = Clip(dest[i] + ScaleSample(src[i], gain));
+}
+
 /**
  * Mix PCM data from a data source (which is read using the provided source
  * reader function) to a destination buffer (which already contains PCM data).
@@ -63,8 +148,9 @@ inline void MixPCM(int16_t *dest, size_t num_frames,
     return;
   }
 
+  const int16_t gain = VolumeToGain(vol_percent);
   for (size_t i = 0; i < num_frames; ++i) {
-    dest[i] += Clip(src_reader(i) * static_cast<int32_t>(vol_percent) / 100);
+    dest[i] = Clip(dest[i] + ScaleSample(src_reader(i), gain));
   }
 }
 
@@ -76,7 +162,12 @@ inline void MixPCM(int16_t *dest, size_t num_frames,
  */
 inline void MixPCM(int16_t *dest, const int16_t *src, size_t num_frames,
                    unsigned vol_percent) {
-  MixPCM(dest, num_frames, vol_percent, [&src](size_t i) { return src[i]; });
+  if (0 == vol_percent) {
+    std::fill(dest, dest + num_frames, 0);
+    return;
+  }
+
+  MixScaledPCM(dest, src, num_frames, VolumeToGain(vol_percent));
 }
 
 /**
@@ -107,11 +198,10 @@ inline void LowerVolume(int16_t *buffer, size_t num_frames,
     return;
   }
 
-  for (size_t i = 0; i < num_frames; ++i) {
-    buffer[i] =
-        static_cast<int16_t>(
-            (static_cast<int32_t>(vol_percent) * buffer[i]) / 100);
-  }
+  if (vol_percent >= 100)
+    return;
+
+  ScalePCM(buffer, num_frames, VolumeToGain(vol_percent));
 }
 
 /**
@@ -125,11 +215,8 @@ inline void ByteSwapAndLowerVolume(int16_t *buffer, size_t num_frames,
     return;
   }
 
-  for (size_t i = 0; i < num_frames; ++i) {
-    buffer[i] =
-        static_cast<int16_t>(
-            static_cast<int32_t>(vol_percent) *
-                static_cast<int32_t>(GenericByteSwap16(buffer[i])) /
-                100);
-  }
+  for (size_t i = 0; i < num_frames; ++i)
+    buffer[i] = static_cast<int16_t>(GenericByteSwap16(buffer[i]));
+
+  LowerVolume(buffer, num_frames, vol_percent);
 }
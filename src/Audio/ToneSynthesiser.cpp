@@ -4,6 +4,7 @@
 #include "ToneSynthesiser.hpp"
 #include "Math/FastTrig.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 void
@@ -17,10 +18,23 @@ ToneSynthesiser::Synthesise(int16_t *buffer, size_t n)
 {
   assert(angle < ISINETABLE.size());
 
-  for (int16_t *end = buffer + n; buffer != end; ++buffer) {
-    *buffer = ISINETABLE[angle] * (32767 / 1024) * (int)volume / 100;
+  /* the oscillator; the table lookup cannot be vectorised, therefore
+     the gain is applied in a separate pass */
+  for (size_t i = 0; i < n; ++i) {
+    buffer[i] = ISINETABLE[angle] * (32767 / 1024);
     angle = (angle + increment) & (ISINETABLE.size() - 1);
   }
+
+  /* ramp towards the requested volume */
+  size_t i = 0;
+  for (; i < n && gain != target_gain; ++i) {
+    gain = gain < target_gain
+      ? std::min(gain + ramp_step, target_gain)
+      : std::max(gain - ramp_step, target_gain);
+    buffer[i] = ScaleSample(buffer[i], gain);
+  }
+
+  ScalePCM(buffer + i, n - i, gain);
 }
 
 unsigned
@@ -4,15 +4,28 @@
 #pragma once
 
 #include "PCMSynthesiser.hpp"
+#include "AudioAlgorithms.hpp"
 
 /**
  * This class generates tones with a sine wave.
  */
 class ToneSynthesiser : public PCMSynthesiser {
-  unsigned volume = 100, angle = 0, increment = 0;
+  unsigned angle = 0, increment = 0;
+
+  /**
+   * The gain currently applied to the sine wave (see VolumeToGain())
+   * and the one requested by SetVolume().  Synthesise() moves #gain
+   * towards #target_gain by at most #ramp_step per sample, because a
+   * sudden change would be audible as a click.
+   */
+  int gain = VolumeToGain(100), target_gain = gain;
+
+  const int ramp_step;
 
 public:
-  explicit ToneSynthesiser(unsigned _sample_rate) : sample_rate(_sample_rate) {
+  explicit ToneSynthesiser(unsigned _sample_rate)
+    :ramp_step(std::max(int(VolumeToGain(100) * RAMP_HZ / _sample_rate), 1)),
+     sample_rate(_sample_rate) {
   }
 
   unsigned GetSampleRate() const {
@@ -26,7 +39,7 @@ public:
    * means full volume
    */
   void SetVolume(unsigned _volume) {
-    volume = _volume;
+    target_gain = VolumeToGain(_volume);
   }
 
   void SetTone(unsigned tone_hz);
@@ -35,6 +48,12 @@ public:
   virtual void Synthesise(int16_t *buffer, size_t n);
 
 protected:
+  /**
+   * A volume change from muted to full volume is spread over this
+   * fraction of a second (5 ms).
+   */
+  static constexpr unsigned RAMP_HZ = 200;
+
   const unsigned sample_rate;
 
   /**
@@ -16,6 +16,7 @@ class ProtectedTaskManager;
 class ProtectedAirspaceWarningManager;
 class GlideComputer;
 class CalculationThread;
+class TargetOptimiserThread;
 class Replay;
 
 /**
@@ -35,6 +36,7 @@ struct BackendComponents {
   std::unique_ptr<ProtectedTaskManager> protected_task_manager;
   std::unique_ptr<GlideComputer> glide_computer;
   std::unique_ptr<CalculationThread> calculation_thread;
+  std::unique_ptr<TargetOptimiserThread> target_optimiser_thread;
 
   std::unique_ptr<Replay> replay;
 
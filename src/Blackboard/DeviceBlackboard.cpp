@@ -213,3 +213,27 @@ DeviceBlackboard::Merge() noexcept
     basic = real_data;
   }
 }
+
+void
+DeviceBlackboard::ConsumeSensorSamples(SensorSampleBatch &batch) noexcept
+{
+  const bool use_real = !replay_data.alive && !simulator_data.alive;
+  bool have_attitude = false, have_acceleration = false, have_vario = false;
+
+  for (unsigned i = 0; i < NUMDEV; ++i) {
+    SensorStreams &streams = sensor_streams[i];
+    if (!use_real || !per_device_data[i].alive) {
+      streams.Discard();
+      continue;
+    }
+
+    have_attitude |=
+      streams.ConsumeAttitude(have_attitude ? nullptr : &batch.attitude) > 0;
+    have_acceleration |=
+      streams.ConsumeAcceleration(have_acceleration
+                                  ? nullptr
+                                  : &batch.acceleration) > 0;
+    have_vario |=
+      streams.ConsumeVario(have_vario ? nullptr : &batch.vario) > 0;
+  }
+}
@@ -7,6 +7,7 @@
 #include "Blackboard/ComputerSettingsBlackboard.hpp"
 #include "Device/Simulator.hpp"
 #include "Device/Features.hpp"
+#include "NMEA/SensorStreams.hpp"
 #include "thread/Mutex.hxx"
 #include "time/WrapClock.hpp"
 
@@ -35,6 +36,12 @@ class DeviceBlackboard
    */
   std::array<NMEAInfo, NUMDEV> per_device_data;
 
+  /**
+   * High-rate sensor samples from each physical device.  They are
+   * not protected by #mutex.
+   */
+  std::array<SensorStreams, NUMDEV> sensor_streams;
+
   /**
    * Merged data from the physical devices.
    */
@@ -118,6 +125,19 @@ public:
     ScheduleMerge();
   }
 
+  SensorStreams &GetSensorStreams(unsigned i) noexcept {
+    return sensor_streams[i];
+  }
+
+  /**
+   * Move the sensor samples queued by all devices to the given
+   * batch.  For each stream, only the samples of the first alive
+   * device which has some are used, and the others are discarded.
+   * Nothing is used while replay or the simulator is active.  Caller
+   * must lock the blackboard.
+   */
+  void ConsumeSensorSamples(SensorSampleBatch &batch) noexcept;
+
   NMEAInfo &SetSimulatorState() noexcept { return simulator_data; }
   NMEAInfo &SetReplayState() noexcept { return replay_data; }
 
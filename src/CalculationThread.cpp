@@ -6,6 +6,13 @@
 #include "Protection.hpp"
 #include "Blackboard/DeviceBlackboard.hpp"
 #include "Hardware/CPU.hpp"
+#include "Profiler/Profiler.hpp"
+#include "LogFile.hpp"
+#include "util/StaticString.hxx"
+
+static constinit Profiler::Zone tick_zone{"CalculationThread"};
+static constinit Profiler::Zone gps_zone{"ProcessGPS"};
+static constinit Profiler::Zone idle_zone{"ProcessIdle"};
 
 /**
  * Constructor of the CalculationThread class
@@ -26,6 +33,7 @@ CalculationThread::CalculationThread(DeviceBlackboard &_device_blackboard,
    force(false),
    device_blackboard(_device_blackboard),
    glide_computer(_glide_computer) {
+  stage_log_clock.Update();
 }
 
 void
@@ -49,6 +57,32 @@ CalculationThread::SetScreenDistanceMeters(double new_value) noexcept
   screen_distance_meters = new_value;
 }
 
+/**
+ * Write the mean and maximum duration of each #GlideComputer stage to
+ * the log file.
+ */
+static void
+LogStageTiming(const StageTimingInfo &timing) noexcept
+{
+  NarrowString<512> buffer;
+  buffer = "GlideComputer stages [us mean/max]:";
+
+  for (std::size_t i = 0; i < NUM_COMPUTER_STAGES; ++i) {
+    const ComputerStage stage = ComputerStage(i);
+    const StageTiming &t = timing[stage];
+    buffer.AppendFormat(" %s=%u/%u", GetComputerStageName(stage),
+                        (unsigned)t.mean, (unsigned)t.max);
+    if (t.deferred > 0)
+      buffer.AppendFormat("(-%u)", (unsigned)t.deferred);
+  }
+
+  const StageTiming &latency = timing.fix_latency;
+  buffer.AppendFormat(" fix_latency=%u/%u",
+                      (unsigned)latency.mean, (unsigned)latency.max);
+
+  LogString(buffer);
+}
+
 /**
  * Main loop of the CalculationThread
  */
@@ -59,6 +93,8 @@ CalculationThread::Tick() noexcept
   const ScopeLockCPU cpu;
 #endif
 
+  const Profiler::Scope profile{tick_zone};
+
   bool gps_updated;
 
   // update and transfer master info to glide computer
@@ -69,8 +105,13 @@ CalculationThread::Tick() noexcept
 
     // Copy data from DeviceBlackboard to GlideComputerBlackboard
     glide_computer.ReadBlackboard(device_blackboard.Basic());
+
+    sensor_samples.Clear();
+    device_blackboard.ConsumeSensorSamples(sensor_samples);
   }
 
+  glide_computer.ProcessSensorSamples(sensor_samples);
+
   bool force;
   {
     const std::lock_guard lock{mutex};
@@ -88,9 +129,11 @@ CalculationThread::Tick() noexcept
 
   bool do_idle = false;
 
-  if (gps_updated || force)
+  if (gps_updated || force) {
+    const Profiler::Scope profile_gps{gps_zone};
     // perform idle call if time advanced and slow calculations need to be updated
     do_idle |= glide_computer.ProcessGPS(force);
+  }
 
   // values changed, so copy them back now: ONLY CALCULATED INFO
   // should be changed in DoCalculations, so we only need to write
@@ -106,9 +149,15 @@ CalculationThread::Tick() noexcept
     TriggerCalculatedUpdate();
 
   if (do_idle) {
+    const Profiler::Scope profile_idle{idle_zone};
     // do slow calculations last, to minimise latency
     glide_computer.ProcessIdle();
+
+    TriggerTargetOptimiser();
   }
+
+  if (stage_log_clock.CheckUpdate(std::chrono::minutes{10}))
+    LogStageTiming(glide_computer.Calculated().stage_timing);
 }
 
 void
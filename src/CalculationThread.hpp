@@ -6,6 +6,8 @@
 #include "thread/WorkerThread.hpp"
 #include "thread/Mutex.hxx"
 #include "Computer/Settings.hpp"
+#include "NMEA/SensorSample.hpp"
+#include "time/PeriodClock.hpp"
 
 class DeviceBlackboard;
 class GlideComputer;
@@ -38,6 +40,18 @@ class CalculationThread final : public WorkerThread {
   /** Pointer to the GlideComputer that should be used */
   GlideComputer &glide_computer;
 
+  /**
+   * Sensor samples collected from the #DeviceBlackboard in Tick().
+   * This is a member only to reuse its memory.
+   */
+  SensorSampleBatch sensor_samples;
+
+  /**
+   * Limits how often the stage timing of the #GlideComputer is
+   * written to the log file.
+   */
+  PeriodClock stage_log_clock;
+
 public:
   CalculationThread(DeviceBlackboard &_device_blackboard,
                     GlideComputer &_glide_computer) noexcept;
@@ -4,6 +4,7 @@
 #include "AverageVarioComputer.hpp"
 #include "NMEA/MoreData.hpp"
 #include "NMEA/VarioInfo.hpp"
+#include "NMEA/SensorSample.hpp"
 
 void
 AverageVarioComputer::Reset()
@@ -11,6 +12,17 @@ AverageVarioComputer::Reset()
   delta_time.Reset();
   vario_30s_filter.Reset();
   netto_30s_filter.Reset();
+  vario_sample_sum = 0;
+  n_vario_samples = 0;
+}
+
+void
+AverageVarioComputer::AddVarioSamples(std::span<const VarioSample> samples) noexcept
+{
+  for (const auto &sample : samples)
+    vario_sample_sum += sample.total_energy_vario;
+
+  n_vario_samples += samples.size();
 }
 
 void
@@ -33,8 +45,14 @@ AverageVarioComputer::Compute(const MoreData &basic,
   if (Elapsed == 0)
     return;
 
+  const double vario = n_vario_samples > 0 && basic.total_energy_vario_available
+    ? vario_sample_sum / n_vario_samples
+    : basic.brutto_vario;
+  vario_sample_sum = 0;
+  n_vario_samples = 0;
+
   for (unsigned i = 0; i < Elapsed; ++i) {
-    vario_30s_filter.Update(basic.brutto_vario);
+    vario_30s_filter.Update(vario);
     netto_30s_filter.Update(basic.netto_vario);
   }
 
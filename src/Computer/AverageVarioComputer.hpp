@@ -6,7 +6,10 @@
 #include "Math/WindowFilter.hpp"
 #include "time/DeltaTime.hpp"
 
+#include <span>
+
 struct MoreData;
+struct VarioSample;
 struct VarioInfo;
 
 class AverageVarioComputer {
@@ -15,9 +18,24 @@ class AverageVarioComputer {
   WindowFilter<30> vario_30s_filter;
   WindowFilter<30> netto_30s_filter;
 
+  /**
+   * The sum and number of total energy vario samples passed to
+   * AddVarioSamples() since the last filter update.
+   */
+  double vario_sample_sum = 0;
+  unsigned n_vario_samples = 0;
+
 public:
   void Reset();
 
+  /**
+   * Feed the total energy vario samples received since the last
+   * call.  If there are any, Compute() feeds their average into the
+   * 30 second filter instead of the latest brutto vario value, so
+   * high-rate vario data is not aliased.
+   */
+  void AddVarioSamples(std::span<const VarioSample> samples) noexcept;
+
   void Compute(const MoreData &basic,
                bool circling, bool last_circling,
                VarioInfo &calculated);
@@ -5,6 +5,7 @@
 #include "NMEA/MoreData.hpp"
 #include "NMEA/CirclingInfo.hpp"
 #include "NMEA/FlyingState.hpp"
+#include "NMEA/SensorSample.hpp"
 #include "Settings.hpp"
 #include "Math/LowPassFilter.hpp"
 #include "time/Cast.hxx"
@@ -13,10 +14,17 @@
 
 static constexpr Angle MIN_TURN_RATE = Angle::Degrees(4);
 
+/**
+ * A gap between two AHRS samples larger than this restarts the
+ * heading accumulation.
+ */
+static constexpr FloatDuration MAX_HEADING_SAMPLE_GAP = std::chrono::seconds{1};
+
 void
 CirclingComputer::Reset()
 {
   turn_rate_delta_time.Reset();
+  heading_sample_start = heading_sample_end = TimeStamp::Undefined();
   turning_delta_time.Reset();
   percent_delta_time.Reset();
 
@@ -29,6 +37,27 @@ CirclingComputer::ResetStats()
   min_altitude = 0;
 }
 
+void
+CirclingComputer::AddAttitudeSamples(std::span<const AttitudeSample> samples) noexcept
+{
+  for (const auto &sample : samples) {
+    if (!sample.heading_available)
+      continue;
+
+    if (!heading_sample_end.IsDefined() ||
+        sample.time < heading_sample_end ||
+        sample.time - heading_sample_end > MAX_HEADING_SAMPLE_GAP) {
+      /* (re)start accumulating */
+      heading_sample_delta = Angle::Zero();
+      heading_sample_start = sample.time;
+    } else
+      heading_sample_delta += (sample.heading - last_sample_heading).AsDelta();
+
+    heading_sample_end = sample.time;
+    last_sample_heading = sample.heading;
+  }
+}
+
 void
 CirclingComputer::TurnRate(CirclingInfo &circling_info,
                            const NMEAInfo &basic,
@@ -64,8 +93,18 @@ CirclingComputer::TurnRate(CirclingInfo &circling_info,
   if (dt.count() > 0) {
     circling_info.turn_rate =
       (basic.track - last_track).AsDelta() / ToFloatSeconds(dt);
-    circling_info.turn_rate_heading =
-      (basic.attitude.heading - last_heading).AsDelta() / ToFloatSeconds(dt);
+    if (heading_sample_start.IsDefined() &&
+        heading_sample_end > heading_sample_start) {
+      /* use all AHRS samples since the last call, which is immune
+         to aliasing and uses the AHRS time base */
+      circling_info.turn_rate_heading = heading_sample_delta /
+        ToFloatSeconds(heading_sample_end - heading_sample_start);
+
+      heading_sample_delta = Angle::Zero();
+      heading_sample_start = heading_sample_end;
+    } else
+      circling_info.turn_rate_heading =
+        (basic.attitude.heading - last_heading).AsDelta() / ToFloatSeconds(dt);
 
     // JMW limit rate to 50 deg per second otherwise a big spike
     // will cause spurious lock on circling for a long time
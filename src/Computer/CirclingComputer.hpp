@@ -7,6 +7,9 @@
 #include "time/DeltaTime.hpp"
 #include "time/Stamp.hpp"
 
+#include <span>
+
+struct AttitudeSample;
 struct CirclingInfo;
 struct NMEAInfo;
 struct MoreData;
@@ -23,6 +26,20 @@ class CirclingComputer {
 
   Angle last_track, last_heading;
 
+  /**
+   * The heading change accumulated from AHRS samples (see
+   * AddAttitudeSamples()) between #heading_sample_start and
+   * #heading_sample_end, which has not yet been used by TurnRate().
+   */
+  Angle heading_sample_delta;
+  TimeStamp heading_sample_start = TimeStamp::Undefined();
+  TimeStamp heading_sample_end = TimeStamp::Undefined();
+
+  /**
+   * The heading of the latest AHRS sample.
+   */
+  Angle last_sample_heading;
+
   DeltaTime turning_delta_time;
 
   /**
@@ -65,6 +82,13 @@ public:
    */
   void ResetStats();
 
+  /**
+   * Feed the attitude samples received since the last call.  If
+   * there are any, TurnRate() calculates the heading turn rate from
+   * them instead of sampling NMEAInfo::attitude.
+   */
+  void AddAttitudeSamples(std::span<const AttitudeSample> samples) noexcept;
+
   /**
    * Calculates the turn rate
    */
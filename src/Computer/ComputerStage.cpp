@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "ComputerStage.hpp"
+
+#include <cassert>
+#include <iterator>
+
+static constexpr const char *stage_names[] = {
+  "air_data",
+  "trace",
+  "task",
+  "route",
+  "cu",
+  "stats",
+  "monitors",
+  "contest",
+  "warning",
+  "log",
+};
+
+static_assert(std::size(stage_names) == NUM_COMPUTER_STAGES);
+
+const char *
+GetComputerStageName(ComputerStage stage) noexcept
+{
+  assert(std::size_t(stage) < NUM_COMPUTER_STAGES);
+
+  return stage_names[std::size_t(stage)];
+}
+
+void
+StageBudgetSettings::SetDefaults() noexcept
+{
+  /* generous limits which are exceeded only on slow devices or with
+     huge tasks and airspace files */
+  Set(ComputerStage::AIR_DATA, 20);
+  Set(ComputerStage::TRACE, 20);
+  Set(ComputerStage::TASK, 100);
+  Set(ComputerStage::ROUTE, 100);
+  Set(ComputerStage::CU, 10);
+  Set(ComputerStage::STATS, 10);
+  Set(ComputerStage::MONITORS, 20);
+  Set(ComputerStage::CONTEST, 200);
+  Set(ComputerStage::WARNING, 100);
+  Set(ComputerStage::LOG, 20);
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/**
+ * The stages of the #GlideComputer whose execution time is measured
+ * by #StageTimer.
+ */
+enum class ComputerStage : uint8_t {
+  AIR_DATA,
+  TRACE,
+  TASK,
+  ROUTE,
+  CU,
+  STATS,
+  MONITORS,
+  CONTEST,
+  WARNING,
+  LOG,
+  COUNT
+};
+
+static constexpr std::size_t NUM_COMPUTER_STAGES =
+  std::size_t(ComputerStage::COUNT);
+
+/**
+ * Returns a short lower-case name for the stage, to be used in log
+ * files and scripts.
+ */
+[[gnu::const]]
+const char *
+GetComputerStageName(ComputerStage stage) noexcept;
+
+/**
+ * Is this optional work which may be deferred to a later tick when
+ * the calculation thread is overloaded?
+ */
+constexpr bool
+IsOptionalComputerStage(ComputerStage stage) noexcept
+{
+  return stage == ComputerStage::ROUTE || stage == ComputerStage::CONTEST;
+}
+
+/**
+ * The time budget of each #ComputerStage.  When a stage takes longer
+ * than its budget, the optional stages are deferred for the rest of
+ * the tick.
+ */
+struct StageBudgetSettings {
+  /**
+   * The budget of each stage in milliseconds; 0 means unlimited.
+   */
+  std::array<uint16_t, NUM_COMPUTER_STAGES> budget_ms;
+
+  void SetDefaults() noexcept;
+
+  constexpr uint16_t Get(ComputerStage stage) const noexcept {
+    return budget_ms[std::size_t(stage)];
+  }
+
+  constexpr void Set(ComputerStage stage, uint16_t value) noexcept {
+    budget_ms[std::size_t(stage)] = value;
+  }
+};
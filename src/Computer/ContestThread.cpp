@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "ContestThread.hpp"
+#include "Profiler/Profiler.hpp"
+
+static constinit Profiler::Zone tick_zone{"ContestThread"};
+
+ContestThread::ContestThread() noexcept
+  :WorkerThread("Contest",
+                std::chrono::seconds{1},
+                std::chrono::milliseconds{200}),
+   contest(trace.GetFull(), trace.GetContest(), trace.GetSprint())
+{
+  settings.SetDefaults();
+  predicted = TracePoint::Invalid();
+}
+
+void
+ContestThread::Start()
+{
+  WorkerThread::Start();
+}
+
+void
+ContestThread::Stop() noexcept
+{
+  BeginStop();
+  Join();
+}
+
+void
+ContestThread::Reset() noexcept
+{
+  const std::lock_guard lock{mutex};
+  pending_points.clear();
+  reset_pending = true;
+  ++generation;
+  result_available = false;
+}
+
+void
+ContestThread::Append(const TracePoint &point, bool contest_enabled) noexcept
+{
+  const std::lock_guard lock{mutex};
+  pending_points.push_back({point, contest_enabled});
+}
+
+void
+ContestThread::Solve(const ContestSettings &_settings,
+                     const TracePoint &_predicted) noexcept
+{
+  {
+    const std::lock_guard lock{mutex};
+    settings = _settings;
+    predicted = _predicted;
+  }
+
+  Trigger();
+}
+
+void
+ContestThread::SetIncremental(bool _incremental) noexcept
+{
+  const std::lock_guard lock{mutex};
+  incremental = _incremental;
+}
+
+bool
+ContestThread::SolveExhaustive(const ContestSettings &_settings,
+                               const TracePoint &_predicted,
+                               ContestStatistics &stats) noexcept
+{
+  /* while this thread is suspended, the caller owns the trace and
+     the solver */
+  Suspend();
+
+  bool reset, job_incremental;
+
+  {
+    const std::lock_guard lock{mutex};
+    new_points.swap(pending_points);
+    reset = reset_pending;
+    reset_pending = false;
+    job_incremental = incremental;
+  }
+
+  ApplyPoints(reset);
+
+  contest.SetIncremental(job_incremental);
+  contest.SetPredicted(_predicted);
+  const bool result = contest.SolveExhaustive(_settings, stats);
+
+  Resume();
+  return result;
+}
+
+bool
+ContestThread::GetResult(ContestStatistics &stats) noexcept
+{
+  const std::lock_guard lock{mutex};
+  if (!result_available)
+    return false;
+
+  stats = result;
+  result_available = false;
+  return true;
+}
+
+void
+ContestThread::ApplyPoints(bool reset) noexcept
+{
+  if (reset) {
+    trace.Reset();
+    contest.Reset();
+  }
+
+  for (const auto &i : new_points)
+    trace.Append(i.point, i.contest_enabled);
+  new_points.clear();
+}
+
+void
+ContestThread::Tick() noexcept
+{
+  if (!priority_lowered) {
+    /* this must be called by the new thread, because it affects the
+       calling thread */
+    SetIdlePriority();
+    priority_lowered = true;
+  }
+
+  const Profiler::Scope profile{tick_zone};
+
+  bool reset, job_incremental;
+  ContestSettings job_settings;
+  TracePoint job_predicted;
+  unsigned job_generation;
+
+  {
+    const std::lock_guard lock{mutex};
+    new_points.swap(pending_points);
+    reset = reset_pending;
+    reset_pending = false;
+    job_settings = settings;
+    job_predicted = predicted;
+    job_generation = generation;
+    job_incremental = incremental;
+  }
+
+  ApplyPoints(reset);
+  contest.SetIncremental(job_incremental);
+
+  if (!job_settings.enable || CheckStoppedOrSuspended())
+    return;
+
+  contest.SetPredicted(job_predicted);
+
+  ContestStatistics stats;
+  contest.Solve(job_settings, stats);
+
+  const std::lock_guard lock{mutex};
+  if (job_generation == generation) {
+    result = stats;
+    result_available = true;
+  }
+  /* else: Reset() was called meanwhile; the result refers to the old
+     trace and must not be published */
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "TraceComputer.hpp"
+#include "ContestComputer.hpp"
+#include "Engine/Contest/Settings.hpp"
+#include "Engine/Contest/ContestStatistics.hpp"
+#include "Engine/Trace/Point.hpp"
+#include "thread/WorkerThread.hpp"
+
+#include <vector>
+
+/**
+ * Solves the contest in a low-priority thread, so a slow solver
+ * does not delay the calculations of the #CalculationThread.
+ *
+ * This thread has its own contest and sprint traces, which are fed
+ * by the #CalculationThread with Append().  While it is in use, the
+ * #CalculationThread does not keep these traces itself.  Solve() schedules one solver
+ * iteration; its result is picked up later with GetResult().
+ * Reset() cancels the current job: its result is discarded.
+ */
+class ContestThread final : public WorkerThread {
+  /**
+   * A point passed to Append() which has not yet been added to the
+   * trace.
+   */
+  struct PendingPoint {
+    TracePoint point;
+    bool contest_enabled;
+  };
+
+  /* the following attributes are protected by the mutex */
+
+  std::vector<PendingPoint> pending_points;
+
+  ContestSettings settings;
+  TracePoint predicted;
+  bool incremental = true;
+
+  /**
+   * Incremented by Reset().  A result is published only if the job
+   * has been started in the same generation.
+   */
+  unsigned generation = 0;
+
+  bool reset_pending = false;
+
+  ContestStatistics result;
+  bool result_available = false;
+
+  /* the following attributes are used only inside this thread */
+
+  /**
+   * The points moved from #pending_points.  This is a member only to
+   * reuse its memory.
+   */
+  std::vector<PendingPoint> new_points;
+
+  TraceComputer trace;
+  ContestComputer contest;
+
+  /**
+   * Has this thread lowered its priority already?
+   */
+  bool priority_lowered = false;
+
+public:
+  ContestThread() noexcept;
+
+  /**
+   * Throws on error.
+   */
+  void Start();
+
+  /**
+   * Stop the thread and wait for it to finish.
+   */
+  void Stop() noexcept;
+
+  /**
+   * Clear the trace and cancel the current job.
+   */
+  void Reset() noexcept;
+
+  /**
+   * Append a point to the trace; see TraceComputer::Append().
+   */
+  void Append(const TracePoint &point, bool contest_enabled) noexcept;
+
+  /**
+   * @see ContestComputer::SetIncremental()
+   */
+  void SetIncremental(bool incremental) noexcept;
+
+  /**
+   * Schedule a solver iteration.
+   */
+  void Solve(const ContestSettings &settings,
+             const TracePoint &predicted) noexcept;
+
+  /**
+   * Find the optimal solution on this thread's trace, synchronously
+   * in the calling thread.  This thread is suspended meanwhile.
+   *
+   * @return true if a new result was copied to #stats
+   */
+  bool SolveExhaustive(const ContestSettings &settings,
+                       const TracePoint &predicted,
+                       ContestStatistics &stats) noexcept;
+
+  /**
+   * Obtain the result of the most recent solver iteration, if there
+   * is a new one.
+   *
+   * @return true if a new result was copied to #stats
+   */
+  bool GetResult(ContestStatistics &stats) noexcept;
+
+private:
+  /**
+   * Add the points moved from #pending_points to the trace.  May be
+   * called only by the thread which owns the trace: this one, or the
+   * caller of SolveExhaustive() while this one is suspended.
+   *
+   * @param reset clear the trace and the solver first
+   */
+  void ApplyPoints(bool reset) noexcept;
+
+protected:
+  void Tick() noexcept override;
+};
@@ -5,6 +5,7 @@
 #include "Computer/Settings.hpp"
 #include "NMEA/Derived.hpp"
 #include "GlideComputerInterface.hpp"
+#include "StageTimer.hpp"
 #include "Engine/Waypoint/Waypoints.hpp"
 
 using namespace std::chrono;
@@ -77,9 +78,16 @@ GlideComputer::ProcessGPS(bool force)
 
   calculated.Expire(basic.clock);
 
+  StageTimingInfo &timing = calculated.stage_timing;
+  const StageBudgetSettings &budget = settings.stage_budget;
+  timing.BeginTick();
+
   // Process basic information
-  air_data_computer.ProcessBasic(Basic(), SetCalculated(),
-                                 settings);
+  {
+    const StageTimer timer(timing, ComputerStage::AIR_DATA, budget);
+    air_data_computer.ProcessBasic(Basic(), SetCalculated(),
+                                   settings);
+  }
 
   // Process basic task information
   const bool last_finished = calculated.ordered_task_stats.task_finished;
@@ -96,22 +104,38 @@ GlideComputer::ProcessGPS(bool force)
   if (!last_finished && calculated.ordered_task_stats.task_finished)
     OnFinishTask();
 
-  // Check if everything is okay with the gps time and process it
-  air_data_computer.FlightTimes(Basic(), SetCalculated(),
-                                settings);
+  {
+    const StageTimer timer(timing, ComputerStage::AIR_DATA, budget);
 
-  TakeoffLanding(last_flying);
+    // Check if everything is okay with the gps time and process it
+    air_data_computer.FlightTimes(Basic(), SetCalculated(),
+                                  settings);
 
-  task_computer.ProcessAutoTask(basic, calculated);
+    TakeoffLanding(last_flying);
+  }
+
+  {
+    const StageTimer timer(timing, ComputerStage::TASK, budget);
+    task_computer.ProcessAutoTask(basic, calculated);
+  }
 
   // Process extended information
-  air_data_computer.ProcessVertical(Basic(),
-                                    SetCalculated(),
-                                    settings);
+  {
+    const StageTimer timer(timing, ComputerStage::AIR_DATA, budget);
+    air_data_computer.ProcessVertical(Basic(),
+                                      SetCalculated(),
+                                      settings);
+  }
 
-  stats_computer.ProcessClimbEvents(calculated);
+  {
+    const StageTimer timer(timing, ComputerStage::STATS, budget);
+    stats_computer.ProcessClimbEvents(calculated);
+  }
 
-  cu_computer.Compute(basic, calculated, settings);
+  {
+    const StageTimer timer(timing, ComputerStage::CU, budget);
+    cu_computer.Compute(basic, calculated, settings);
+  }
 
   // Calculate the team code
   CalculateOwnTeamCode();
@@ -133,7 +157,15 @@ GlideComputer::ProcessGPS(bool force)
   CalculateVarioScale();
 
   // Update the ConditionMonitors
-  condition_monitors.Update(Basic(), Calculated(), settings);
+  {
+    const StageTimer timer(timing, ComputerStage::MONITORS, budget);
+    condition_monitors.Update(Basic(), Calculated(), settings);
+  }
+
+  timing.Commit();
+
+  if (!force)
+    UpdateFixLatency();
 
   return idle_clock.CheckUpdate(milliseconds(500));
 }
@@ -143,23 +175,59 @@ GlideComputer::ProcessIdle(bool exhaustive)
 {
   const MoreData &basic = Basic();
   DerivedInfo &calculated = SetCalculated();
+  StageTimingInfo &timing = calculated.stage_timing;
+  const StageBudgetSettings &budget = GetComputerSettings().stage_budget;
 
   // Log GPS fixes for internal usage
   // (snail trail, stats, contest, ...)
-  stats_computer.DoLogging(basic, calculated);
-  log_computer.Run(basic, calculated, GetComputerSettings().logger);
+  {
+    const StageTimer timer(timing, ComputerStage::STATS, budget);
+    stats_computer.DoLogging(basic, calculated);
+  }
+
+  {
+    const StageTimer timer(timing, ComputerStage::LOG, budget);
+    log_computer.Run(basic, calculated, GetComputerSettings().logger);
+  }
 
   task_computer.ProcessIdle(basic, calculated, GetComputerSettings(),
                             exhaustive);
 
-  warning_computer.Update(GetComputerSettings(), basic,
-                          calculated, calculated.airspace_warnings);
+  {
+    const StageTimer timer(timing, ComputerStage::WARNING, budget);
+    warning_computer.Update(GetComputerSettings(), basic,
+                            calculated, calculated.airspace_warnings);
+  }
 
-  idle_condition_monitors.Update(basic, calculated, GetComputerSettings());
+  {
+    const StageTimer timer(timing, ComputerStage::MONITORS, budget);
+    idle_condition_monitors.Update(basic, calculated, GetComputerSettings());
+  }
 
-  // Calculate summary of flight
+  /* Calculate summary of flight; unlike the contest solver, this is
+     only one waypoint lookup per fix, so it remains in this thread */
   if (basic.location_available)
     retrospective.UpdateSample(basic.location);
+
+  timing.Commit();
+}
+
+inline void
+GlideComputer::UpdateFixLatency() noexcept
+{
+  const MoreData &basic = Basic();
+  if (!basic.location_available)
+    return;
+
+  const TimeStamp now{steady_clock::now().time_since_epoch()};
+  const auto latency = now - basic.location_available.GetTimeStamp();
+
+  /* replays use a synthetic clock; ignore values which cannot be a
+     real latency */
+  if (latency.count() < 0 || latency > seconds{10})
+    return;
+
+  SetCalculated().stage_timing.fix_latency.Add(duration_cast<microseconds>(latency).count());
 }
 
 bool
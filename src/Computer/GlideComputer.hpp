@@ -80,6 +80,14 @@ public:
     SetCalculated().Expire(Basic().clock);
   }
 
+  /**
+   * Is called by the CalculationThread with the sensor samples which
+   * were received since the last call.
+   */
+  void ProcessSensorSamples(const SensorSampleBatch &samples) noexcept {
+    air_data_computer.ProcessSensorSamples(samples);
+  }
+
   /**
    * Is called by the CalculationThread and processes the received GPS
    * data in Basic().
@@ -145,6 +153,13 @@ public:
     task_computer.SetContestIncremental(incremental);
   }
 
+  /**
+   * @see TaskComputer::SetBackgroundContest()
+   */
+  void SetBackgroundContest(bool enable) noexcept {
+    task_computer.SetBackgroundContest(enable);
+  }
+
 protected:
   void OnTakeoff();
   void OnLanding();
@@ -174,4 +189,10 @@ private:
 
   void CalculateWorkingBand();
   void CalculateVarioScale();
+
+  /**
+   * Measure the time since the current GPS fix was received, see
+   * StageTimingInfo::fix_latency.
+   */
+  void UpdateFixLatency() noexcept;
 };
@@ -10,6 +10,7 @@
 #include "Math/SunEphemeris.hpp"
 #include "NMEA/Derived.hpp"
 #include "NMEA/MoreData.hpp"
+#include "NMEA/SensorSample.hpp"
 
 using namespace std::chrono;
 
@@ -56,6 +57,14 @@ GlideComputerAirData::ResetFlight(DerivedInfo &calculated,
   delta_time.Reset();
 }
 
+void
+GlideComputerAirData::ProcessSensorSamples(const SensorSampleBatch &samples) noexcept
+{
+  circling_computer.AddAttitudeSamples(samples.attitude);
+  wind_computer.AddAccelerationSamples(samples.acceleration);
+  average_vario.AddVarioSamples(samples.vario);
+}
+
 void
 GlideComputerAirData::ProcessBasic(const MoreData &basic,
                                    DerivedInfo &calculated,
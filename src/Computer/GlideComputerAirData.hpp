@@ -14,6 +14,7 @@
 #include "AverageVarioComputer.hpp"
 #include "ThermalLocator.hpp"
 
+struct SensorSampleBatch;
 struct VarioInfo;
 struct OneClimbInfo;
 struct TerrainInfo;
@@ -73,6 +74,13 @@ public:
   void ProcessBasic(const MoreData &basic, DerivedInfo &calculated,
                     const ComputerSettings &settings);
 
+  /**
+   * Feed the high-rate sensor samples received since the last call
+   * into the computers which use them.  They are evaluated by the
+   * next ProcessVertical() call.
+   */
+  void ProcessSensorSamples(const SensorSampleBatch &samples) noexcept;
+
   /**
    * Calculates some other values
    */
@@ -7,14 +7,43 @@
 #include "NMEA/Derived.hpp"
 #include "NMEA/Aircraft.hpp"
 #include "Navigation/Aircraft.hpp"
+#include "thread/WorkStealingPool.hpp"
+#include "LogFile.hpp"
 
 #include <algorithm>
+#include <thread>
+
+/**
+ * The maximum number of threads used for the reach calculation.
+ * More would not help much, because the calculation thread competes
+ * with the draw thread.
+ */
+static constexpr unsigned MAX_REACH_THREADS = 4;
 
 RouteComputer::RouteComputer(const Airspaces &airspace_database,
                              const ProtectedAirspaceWarningManager *warnings)
   :protected_route_planner(route_planner, airspace_database, warnings),
    terrain(NULL)
-{}
+{
+  /* the route is re-planned every few seconds from the moving
+     aircraft back to the same target, which is what the incremental
+     mode is made for */
+  route_planner.SetIncremental(true);
+
+  const unsigned n_threads = std::min(std::thread::hardware_concurrency(),
+                                      MAX_REACH_THREADS);
+  if (n_threads > 1) {
+    try {
+      reach_pool = std::make_unique<WorkStealingPool>(n_threads);
+      route_planner.SetReachPool(reach_pool.get());
+    } catch (...) {
+      /* not fatal: fall back to calculating reach in this thread */
+      LogError(std::current_exception(), "Failed to start reach threads");
+    }
+  }
+}
+
+RouteComputer::~RouteComputer() noexcept = default;
 
 void
 RouteComputer::ResetFlight()
@@ -8,6 +8,8 @@
 #include "Engine/Route/RoutePlanner.hpp"
 #include "time/GPSClock.hpp"
 
+#include <memory>
+
 struct MoreData;
 struct DerivedInfo;
 struct GlideSettings;
@@ -15,10 +17,17 @@ struct RoutePlannerConfig;
 class ProtectedAirspaceWarningManager;
 class RasterTerrain;
 class GlidePolar;
+class WorkStealingPool;
 
 class RouteComputer {
   static constexpr std::chrono::steady_clock::duration PERIOD = std::chrono::seconds(5);
 
+  /**
+   * Threads which help with the reach calculation on multi-core
+   * machines.  This is nullptr on single-core machines.
+   */
+  std::unique_ptr<WorkStealingPool> reach_pool;
+
   RoutePlannerGlue route_planner;
   ProtectedRoutePlanner protected_route_planner;
 
@@ -33,6 +42,7 @@ class RouteComputer {
 public:
   RouteComputer(const Airspaces &airspace_database,
                 const ProtectedAirspaceWarningManager *warnings);
+  ~RouteComputer() noexcept;
 
   const ProtectedRoutePlanner &GetProtectedRoutePlanner() const {
     return protected_route_planner;
@@ -18,6 +18,7 @@
 #include "Plane/Plane.hpp"
 #include "Wind/Settings.hpp"
 #include "WaveSettings.hpp"
+#include "ComputerStage.hpp"
 #include "RadioFrequency.hpp"
 #include "TransponderCode.hpp"
 #include "net/client/WeGlide/Settings.hpp"
@@ -233,6 +234,8 @@ struct ComputerSettings {
 
   TransponderSettings transponder;
 
+  StageBudgetSettings stage_budget;
+
   void SetDefaults();
 };
 
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "StageTimer.hpp"
+
+using namespace std::chrono;
+
+static constinit Profiler::Zone zones[] = {
+  Profiler::Zone{"GlideComputer.air_data"},
+  Profiler::Zone{"GlideComputer.trace"},
+  Profiler::Zone{"GlideComputer.task"},
+  Profiler::Zone{"GlideComputer.route"},
+  Profiler::Zone{"GlideComputer.cu"},
+  Profiler::Zone{"GlideComputer.stats"},
+  Profiler::Zone{"GlideComputer.monitors"},
+  Profiler::Zone{"GlideComputer.contest"},
+  Profiler::Zone{"GlideComputer.warning"},
+  Profiler::Zone{"GlideComputer.log"},
+};
+
+static_assert(std::size(zones) == NUM_COMPUTER_STAGES);
+
+StageTimer::~StageTimer() noexcept
+{
+  const auto end = Profiler::Clock::now();
+
+  if (Profiler::IsEnabled())
+    Profiler::Record(zones[std::size_t(stage)], start, end);
+
+  StageTiming &timing = info[stage];
+  const uint32_t us = duration_cast<microseconds>(end - start).count();
+  const uint32_t budget_us = uint32_t(budget_ms) * 1000;
+  const bool was_over = budget_us > 0 && timing.has_pending &&
+    timing.pending > budget_us;
+
+  timing.pending = timing.has_pending ? timing.pending + us : us;
+  timing.has_pending = true;
+
+  if (budget_us > 0 && timing.pending > budget_us && !was_over) {
+    ++timing.over_budget;
+    info.overloaded = true;
+  }
+}
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "StageTiming.hpp"
+#include "Profiler/Profiler.hpp"
+
+/**
+ * Measure the time from construction to destruction and add it to
+ * the #StageTiming of a #ComputerStage.  When the stage exceeds its
+ * budget, the tick is marked as overloaded.  If the #Profiler is
+ * enabled, the measurement is recorded there, too.
+ */
+class StageTimer {
+  StageTimingInfo &info;
+  const ComputerStage stage;
+  const uint16_t budget_ms;
+  const Profiler::Clock::time_point start;
+
+public:
+  StageTimer(StageTimingInfo &_info, ComputerStage _stage,
+             const StageBudgetSettings &budget) noexcept
+    :info(_info), stage(_stage), budget_ms(budget.Get(_stage)),
+     start(Profiler::Clock::now()) {}
+
+  ~StageTimer() noexcept;
+
+  StageTimer(const StageTimer &) = delete;
+  StageTimer &operator=(const StageTimer &) = delete;
+};
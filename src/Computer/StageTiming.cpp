@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "StageTiming.hpp"
+
+#include <algorithm>
+
+void
+StageTiming::Add(uint32_t duration_us) noexcept
+{
+  last = duration_us;
+
+  if (count == 0)
+    mean_scaled = duration_us << MEAN_SHIFT;
+  else
+    mean_scaled = mean_scaled - (mean_scaled >> MEAN_SHIFT) + duration_us;
+
+  mean = mean_scaled >> MEAN_SHIFT;
+
+  if (count % WINDOW == 0) {
+    previous_window_max = window_max;
+    window_max = 0;
+  }
+
+  window_max = std::max(window_max, duration_us);
+  max = std::max(window_max, previous_window_max);
+
+  ++count;
+}
+
+void
+StageTimingInfo::Commit() noexcept
+{
+  for (auto &i : stages) {
+    if (i.has_pending) {
+      i.Add(i.pending);
+      i.pending = 0;
+      i.has_pending = false;
+    }
+  }
+}
+
+bool
+StageTimingInfo::CheckDefer(ComputerStage stage) noexcept
+{
+  StageTiming &timing = (*this)[stage];
+
+  if (!overloaded ||
+      timing.consecutive_deferred >= MAX_CONSECUTIVE_DEFERRED) {
+    timing.consecutive_deferred = 0;
+    return false;
+  }
+
+  ++timing.deferred;
+  ++timing.consecutive_deferred;
+  return true;
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "ComputerStage.hpp"
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Rolling statistics of the execution time of one #ComputerStage.
+ * All durations are in microseconds.
+ */
+struct StageTiming {
+  /**
+   * The number of measurements since the last Clear().
+   */
+  uint32_t count;
+
+  /**
+   * The most recent duration.
+   */
+  uint32_t last;
+
+  /**
+   * An exponential moving average of the durations.
+   */
+  uint32_t mean;
+
+  /**
+   * #mean multiplied by 2^MEAN_SHIFT, so short durations do not get
+   * lost in the integer division.
+   */
+  uint32_t mean_scaled;
+
+  /**
+   * The maximum duration of the last #WINDOW to 2 * #WINDOW
+   * measurements.
+   */
+  uint32_t max;
+
+  /**
+   * The maximum of the current window; #max includes the previous
+   * window, so old peaks are forgotten gradually.
+   */
+  uint32_t window_max, previous_window_max;
+
+  /**
+   * The number of measurements which exceeded the budget.
+   */
+  uint32_t over_budget;
+
+  /**
+   * The number of times this (optional) stage was skipped, and the
+   * number of consecutive skips until now.
+   */
+  uint32_t deferred, consecutive_deferred;
+
+  /**
+   * The time accumulated during the current tick, to be added by
+   * StageTimingInfo::Commit().  A stage may be measured in several
+   * pieces per tick.
+   */
+  uint32_t pending;
+  bool has_pending;
+
+  static constexpr unsigned WINDOW = 64;
+
+  /**
+   * The weight of a new measurement in #mean is 1/2^MEAN_SHIFT.
+   */
+  static constexpr unsigned MEAN_SHIFT = 3;
+
+  void Clear() noexcept {
+    count = last = mean = mean_scaled = max = 0;
+    window_max = previous_window_max = 0;
+    over_budget = deferred = consecutive_deferred = 0;
+    pending = 0;
+    has_pending = false;
+  }
+
+  void Add(uint32_t duration_us) noexcept;
+};
+
+/**
+ * The #StageTiming of all stages of the #GlideComputer.
+ */
+struct StageTimingInfo {
+  std::array<StageTiming, NUM_COMPUTER_STAGES> stages;
+
+  /**
+   * The time from the reception of a GPS fix until all calculations
+   * of GlideComputer::ProcessGPS() for it are done.  Only #count,
+   * #last, #mean and #max are used.
+   */
+  StageTiming fix_latency;
+
+  /**
+   * Has a stage exceeded its budget during the current tick?  If yes,
+   * optional stages are deferred.
+   */
+  bool overloaded;
+
+  /**
+   * Do not defer an optional stage more often than this in a row, so
+   * it gets updated even when the device is permanently overloaded.
+   */
+  static constexpr unsigned MAX_CONSECUTIVE_DEFERRED = 4;
+
+  void Clear() noexcept {
+    for (auto &i : stages)
+      i.Clear();
+    fix_latency.Clear();
+    overloaded = false;
+  }
+
+  constexpr StageTiming &operator[](ComputerStage stage) noexcept {
+    return stages[std::size_t(stage)];
+  }
+
+  constexpr const StageTiming &operator[](ComputerStage stage) const noexcept {
+    return stages[std::size_t(stage)];
+  }
+
+  /**
+   * Call this at the beginning of each calculation tick.
+   */
+  void BeginTick() noexcept {
+    overloaded = false;
+  }
+
+  /**
+   * Add the time measured during the current tick to the statistics.
+   * Call this at the end of GlideComputer::ProcessGPS() and
+   * GlideComputer::ProcessIdle().
+   */
+  void Commit() noexcept;
+
+  /**
+   * Shall the given optional stage be skipped in this tick?  This
+   * updates the deferral counters.
+   */
+  bool CheckDefer(ComputerStage stage) noexcept;
+};
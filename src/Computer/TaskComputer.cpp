@@ -2,6 +2,7 @@
 // Copyright The XCSoar Project
 
 #include "TaskComputer.hpp"
+#include "ContestThread.hpp"
 #include "Task/ProtectedTaskManager.hpp"
 #include "Engine/Task/TaskManager.hpp"
 #include "Engine/Task/Ordered/OrderedTask.hpp"
@@ -9,6 +10,8 @@
 #include "NMEA/MoreData.hpp"
 #include "NMEA/Derived.hpp"
 #include "Settings.hpp"
+#include "StageTimer.hpp"
+#include "LogFile.hpp"
 
 #include <algorithm>
 
@@ -28,6 +31,47 @@ TaskComputer::TaskComputer(ProtectedTaskManager &_task,
   task.SetRoutePlanner(&route.GetProtectedRoutePlanner());
 }
 
+TaskComputer::~TaskComputer() noexcept
+{
+  SetBackgroundContest(false);
+}
+
+void
+TaskComputer::SetBackgroundContest(bool enable) noexcept
+{
+  if (!enable) {
+    if (contest_thread) {
+      contest_thread->Stop();
+      contest_thread.reset();
+    }
+
+    return;
+  }
+
+  if (contest_thread)
+    return;
+
+  try {
+    auto thread = std::make_unique<ContestThread>();
+    thread->SetIncremental(contest_incremental);
+    thread->Start();
+    contest_thread = std::move(thread);
+  } catch (...) {
+    /* not fatal: fall back to solving the contest in this thread */
+    LogError(std::current_exception(), "Failed to start contest thread");
+  }
+}
+
+void
+TaskComputer::SetContestIncremental(bool incremental) noexcept
+{
+  contest_incremental = incremental;
+  contest.SetIncremental(incremental);
+
+  if (contest_thread)
+    contest_thread->SetIncremental(incremental);
+}
+
 void
 TaskComputer::ResetFlight([[maybe_unused]] const bool full)
 {
@@ -36,6 +80,9 @@ TaskComputer::ResetFlight([[maybe_unused]] const bool full)
   trace.Reset();
   contest.Reset();
 
+  if (contest_thread)
+    contest_thread->Reset();
+
   valid_last_state = false;
   last_flying = false;
 
@@ -48,10 +95,28 @@ TaskComputer::ProcessBasicTask(const MoreData &basic,
                                const ComputerSettings &settings_computer,
                                bool force)
 {
-  trace.Update(settings_computer, basic, calculated);
+  StageTimingInfo &timing = calculated.stage_timing;
+
+  {
+    const StageTimer timer(timing, ComputerStage::TRACE,
+                           settings_computer.stage_budget);
+    /* if the ContestThread is running, it keeps the contest traces,
+       and only the full trace is recorded here */
+    if (trace.Update(settings_computer, basic, calculated,
+                     !contest_thread) &&
+        contest_thread)
+      contest_thread->Append(TracePoint(basic),
+                             settings_computer.contest.enable);
+  }
 
   ProtectedTaskManager::ExclusiveLease _task(task);
 
+  /* start measuring after the lock has been obtained; waiting for the
+     TargetOptimiserThread is not work done by this stage and must not
+     make it exceed its budget */
+  const StageTimer timer(timing, ComputerStage::TASK,
+                         settings_computer.stage_budget);
+
   _task->SetTaskBehaviour(settings_computer.task);
 
   if (force || (last_location_available &&
@@ -89,10 +154,17 @@ TaskComputer::ProcessMoreTask(const MoreData &basic,
   const GlidePolar &glide_polar = settings_computer.polar.glide_polar_task;
   const GlidePolar &safety_polar = calculated.glide_polar_safety;
 
-  route.ProcessRoute(basic, calculated,
-                     settings_computer.task.glide,
-                     settings_computer.task.route_planner,
-                     glide_polar, safety_polar);
+  /* the route is optional; if a stage has exceeded its budget, keep
+     the previous result and try again in the next tick */
+  StageTimingInfo &timing = calculated.stage_timing;
+  if (!timing.CheckDefer(ComputerStage::ROUTE)) {
+    const StageTimer timer(timing, ComputerStage::ROUTE,
+                           settings_computer.stage_budget);
+    route.ProcessRoute(basic, calculated,
+                       settings_computer.task.glide,
+                       settings_computer.task.route_planner,
+                       glide_polar, safety_polar);
+  }
 
   if (settings_computer.features.block_stf_enabled)
     calculated.V_stf = calculated.common_stats.V_block;
@@ -130,18 +202,51 @@ TaskComputer::ProcessIdle(const MoreData &basic, DerivedInfo &calculated,
                           const ComputerSettings &settings_computer,
                           bool exhaustive)
 {
-  contest.SetPredicted(Predicted(settings_computer.contest, basic,
-                                 calculated.task_stats.current_leg));
-
-  if (exhaustive)
-    contest.SolveExhaustive(settings_computer.contest,
-                            calculated.contest_stats);
-  else
-    contest.Solve(settings_computer.contest, calculated.contest_stats);
+  StageTimingInfo &timing = calculated.stage_timing;
+
+  if (contest_thread) {
+    const StageTimer timer(timing, ComputerStage::CONTEST,
+                           settings_computer.stage_budget);
+
+    const TracePoint predicted =
+      Predicted(settings_computer.contest, basic,
+                calculated.task_stats.current_leg);
+
+    if (exhaustive) {
+      contest_thread->SolveExhaustive(settings_computer.contest, predicted,
+                                      calculated.contest_stats);
+    } else {
+      /* publish the result of the previous job and schedule the next
+         one; this is cheap, therefore it is never deferred */
+      if (settings_computer.contest.enable)
+        contest_thread->GetResult(calculated.contest_stats);
+
+      contest_thread->Solve(settings_computer.contest, predicted);
+    }
+  } else if (exhaustive || !timing.CheckDefer(ComputerStage::CONTEST)) {
+    /* the contest is optional, unless an exhaustive solution was
+       requested explicitly */
+    const StageTimer timer(timing, ComputerStage::CONTEST,
+                           settings_computer.stage_budget);
+
+    contest.SetPredicted(Predicted(settings_computer.contest, basic,
+                                   calculated.task_stats.current_leg));
+
+    if (exhaustive)
+      contest.SolveExhaustive(settings_computer.contest,
+                              calculated.contest_stats);
+    else
+      contest.Solve(settings_computer.contest, calculated.contest_stats);
+  }
 
   const AircraftState as = ToAircraftState(basic, calculated);
 
   ProtectedTaskManager::ExclusiveLease _task(task);
+
+  /* see ProcessBasicTask() */
+  const StageTimer timer(timing, ComputerStage::TASK,
+                         settings_computer.stage_budget);
+
   _task->UpdateIdle(as);
 }
 
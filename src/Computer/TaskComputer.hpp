@@ -9,8 +9,11 @@
 #include "Engine/Navigation/Aircraft.hpp"
 #include "NMEA/Validity.hpp"
 
+#include <memory>
+
 struct NMEAInfo;
 class ProtectedTaskManager;
+class ContestThread;
 class ProtectedAirspaceWarningManager;
 
 class TaskComputer
@@ -23,6 +26,17 @@ class TaskComputer
 
   ContestComputer contest;
 
+  /**
+   * If set, the (non-exhaustive) contest is solved in this thread
+   * instead of the calling thread; see SetBackgroundContest().
+   */
+  std::unique_ptr<ContestThread> contest_thread;
+
+  /**
+   * The last value passed to SetContestIncremental().
+   */
+  bool contest_incremental = true;
+
   AircraftState last_state;
   bool valid_last_state;
 
@@ -34,6 +48,7 @@ public:
   TaskComputer(ProtectedTaskManager &_task,
                const Airspaces &airspace_database,
                const ProtectedAirspaceWarningManager *warnings);
+  ~TaskComputer() noexcept;
 
   const ProtectedTaskManager &GetProtectedTaskManager() const {
     return task;
@@ -72,9 +87,17 @@ public:
 
   void SetTerrain(const RasterTerrain* _terrain);
 
-  void SetContestIncremental(bool incremental) {
-    contest.SetIncremental(incremental);
-  }
+  void SetContestIncremental(bool incremental) noexcept;
+
+  /**
+   * Solve the contest in a separate low-priority thread.  The result
+   * is picked up by the next ProcessIdle() call.  Exhaustive solving
+   * is still done synchronously, on the trace of that thread.  While
+   * the thread is enabled, this object does not record the contest
+   * traces.  Must not be called while ProcessIdle() may run in
+   * another thread.
+   */
+  void SetBackgroundContest(bool enable) noexcept;
 
   /**
    * Auto-create a task on takeoff that leads back home.
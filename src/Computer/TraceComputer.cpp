@@ -49,26 +49,32 @@ TraceComputer::LockedCopyTo(TracePointVector &v,
 }
 
 void
-TraceComputer::Update(const ComputerSettings &settings_computer,
-                      const MoreData &basic, const DerivedInfo &calculated)
+TraceComputer::Append(const TracePoint &point, bool contest_enabled)
 {
-  /* time warps are handled by the Trace class */
-
-  if (!basic.time_available || !basic.location_available ||
-      !basic.NavAltitudeAvailable() ||
-      !calculated.flight.flying)
-    return;
-
-  const TracePoint point(basic);
-
   {
     const std::lock_guard lock{mutex};
     full.push_back(point);
   }
 
   // only contest requires trace_sprint
-  if (settings_computer.contest.enable) {
+  if (contest_enabled) {
     sprint.push_back(point);
     contest.push_back(point);
   }
 }
+
+bool
+TraceComputer::Update(const ComputerSettings &settings_computer,
+                      const MoreData &basic, const DerivedInfo &calculated,
+                      bool _contest)
+{
+  /* time warps are handled by the Trace class */
+
+  if (!basic.time_available || !basic.location_available ||
+      !basic.NavAltitudeAvailable() ||
+      !calculated.flight.flying)
+    return false;
+
+  Append(TracePoint(basic), _contest && settings_computer.contest.enable);
+  return true;
+}
@@ -70,6 +70,20 @@ public:
                     std::chrono::duration<unsigned> min_time,
                     const GeoPoint &location, double resolution) const;
 
-  void Update(const ComputerSettings &settings_computer,
-              const MoreData &basic, const DerivedInfo &calculated);
+  /**
+   * Append a point to the full trace, and to the contest traces if
+   * the contest is enabled.
+   */
+  void Append(const TracePoint &point, bool contest_enabled);
+
+  /**
+   * Append the current location to the trace.
+   *
+   * @param contest false if the contest traces are kept elsewhere
+   * (by the #ContestThread); only the full trace is updated then
+   * @return true if a point was appended
+   */
+  bool Update(const ComputerSettings &settings_computer,
+              const MoreData &basic, const DerivedInfo &calculated,
+              bool contest=true);
 };
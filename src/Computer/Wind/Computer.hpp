@@ -38,6 +38,13 @@ public:
 
   void Reset();
 
+  /**
+   * @see WindEKFGlue::AddAccelerationSamples()
+   */
+  void AddAccelerationSamples(std::span<const AccelerationSample> samples) noexcept {
+    wind_ekf.AddAccelerationSamples(samples);
+  }
+
   void Compute(const WindSettings &settings,
                const GlidePolar &glide_polar,
                const MoreData &basic, DerivedInfo &calculated);
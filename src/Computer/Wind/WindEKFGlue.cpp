@@ -5,6 +5,14 @@
 #include "Math/Angle.hpp"
 #include "NMEA/Info.hpp"
 #include "NMEA/Derived.hpp"
+#include "NMEA/SensorSample.hpp"
+
+#include <utility> // for std::exchange()
+
+/**
+ * A g-load deviating more than this from 1 indicates manoeuvring.
+ */
+static constexpr double MAX_G_LOAD_DEVIATION = 0.3;
 
 void
 WindEKFGlue::Reset() noexcept
@@ -13,6 +21,7 @@ WindEKFGlue::Reset() noexcept
   last_ground_speed_available.Clear();
   last_airspeed_available.Clear();
   i = 0;
+  sample_manoeuvre = false;
 
   ResetBlackout();
 }
@@ -29,6 +38,14 @@ CounterToQuality(unsigned i) noexcept
           : 1u));
 }
 
+void
+WindEKFGlue::AddAccelerationSamples(std::span<const AccelerationSample> samples) noexcept
+{
+  for (const auto &sample : samples)
+    if (fabs(sample.g_load - 1) > MAX_G_LOAD_DEVIATION)
+      sample_manoeuvre = true;
+}
+
 WindEKFGlue::Result
 WindEKFGlue::Update(const NMEAInfo &basic, const DerivedInfo &derived) noexcept
 {
@@ -66,10 +83,12 @@ WindEKFGlue::Update(const NMEAInfo &basic, const DerivedInfo &derived) noexcept
        ends is delayed for another 10 seconds */
     i = 0;
 
-  if (derived.turn_rate.Absolute() > Angle::Degrees(20) ||
+  const bool manoeuvre = std::exchange(sample_manoeuvre, false);
+
+  if (derived.turn_rate.Absolute() > Angle::Degrees(20) || manoeuvre ||
       (basic.acceleration.available &&
        basic.acceleration.real &&
-       fabs(basic.acceleration.g_load - 1) > 0.3)) {
+       fabs(basic.acceleration.g_load - 1) > MAX_G_LOAD_DEVIATION)) {
 
     SetBlackout(basic.clock);
     return Result(0);
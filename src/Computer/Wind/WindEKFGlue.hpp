@@ -8,6 +8,9 @@
 #include "Geo/SpeedVector.hpp"
 #include "time/Stamp.hpp"
 
+#include <span>
+
+struct AccelerationSample;
 struct NMEAInfo;
 struct DerivedInfo;
 
@@ -43,6 +46,13 @@ class WindEKFGlue
 
   TimeStamp time_blackout;
 
+  /**
+   * Did one of the acceleration samples passed to
+   * AddAccelerationSamples() indicate manoeuvring?  This is cleared
+   * when Update() evaluates it.
+   */
+  bool sample_manoeuvre = false;
+
 public:
   struct Result
   {
@@ -55,6 +65,13 @@ public:
 
   void Reset() noexcept;
 
+  /**
+   * Feed the acceleration samples received since the last call.
+   * This catches short manoeuvres between two Update() calls, which
+   * NMEAInfo::acceleration does not show.
+   */
+  void AddAccelerationSamples(std::span<const AccelerationSample> samples) noexcept;
+
   Result Update(const NMEAInfo &basic, const DerivedInfo &derived) noexcept;
 
 private:
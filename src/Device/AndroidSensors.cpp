@@ -3,6 +3,7 @@
 
 #include "Descriptor.hpp"
 #include "DataEditor.hpp"
+#include "Blackboard/DeviceBlackboard.hpp"
 #include "NMEA/Info.hpp"
 #include "Geo/Geoid.hpp"
 #include "time/FloatDuration.hxx"
@@ -103,7 +104,10 @@ DeviceDescriptor::OnAccelerationSensor(double acceleration) noexcept
   basic.UpdateClock();
   basic.alive.Update(basic.clock);
 
+  SensorStreams &sensor_streams = blackboard.GetSensorStreams(index);
+  sensor_streams.BeginCapture(basic);
   basic.acceleration.ProvideGLoad(acceleration);
+  sensor_streams.EndCapture(basic);
 
   e.Commit();
 }
@@ -1181,6 +1181,8 @@ DeviceDescriptor::OnSysTicker() noexcept
   if (has_failed && !IsOccupied())
     Close();
 
+  ingest_counters.Update();
+
   if (device == nullptr)
     return;
 
@@ -1337,16 +1339,43 @@ DeviceDescriptor::DataReceived(std::span<const std::byte> s) noexcept
 bool
 DeviceDescriptor::LineReceived(const char *line) noexcept
 {
-  if (nmea_logger != nullptr)
-    nmea_logger->Log(line);
+  return LinesReceived({&line, 1});
+}
+
+bool
+DeviceDescriptor::LinesReceived(std::span<const char *const> lines) noexcept
+{
+  for (const char *line : lines) {
+    if (nmea_logger != nullptr)
+      nmea_logger->Log(line);
+
+    if (dispatcher != nullptr)
+      dispatcher->LineReceived(line);
+  }
 
-  if (dispatcher != nullptr)
-    dispatcher->LineReceived(line);
+  /* parse all lines of this chunk in one edit session, to lock the
+     DeviceBlackboard and schedule a merge only once */
+  std::chrono::steady_clock::duration lock_hold_time;
 
-  const auto e = BeginEdit();
-  e->UpdateClock();
-  ParseNMEA(line, *e);
-  e.Commit();
+  {
+    const auto e = BeginEdit();
+    const auto start = std::chrono::steady_clock::now();
+
+    SensorStreams &sensor_streams = blackboard.GetSensorStreams(index);
+
+    e->UpdateClock();
+    for (const char *line : lines) {
+      /* queue each sensor sample, not only the last one of this
+         chunk */
+      sensor_streams.BeginCapture(*e);
+      ParseNMEA(line, *e);
+      sensor_streams.EndCapture(*e);
+    }
+    e.Commit();
+
+    lock_hold_time = std::chrono::steady_clock::now() - start;
+  }
 
+  ingest_counters.Add(lines.size(), lock_hold_time);
   return true;
 }
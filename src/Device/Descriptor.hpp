@@ -9,6 +9,7 @@
 #include "Port/State.hpp"
 #include "Port/Listener.hpp"
 #include "Device/Parser.hpp"
+#include "IngestStats.hpp"
 #include "RadioFrequency.hpp"
 #include "TransponderCode.hpp"
 #include "NMEA/ExternalSettings.hpp"
@@ -125,6 +126,12 @@ class DeviceDescriptor final
    */
   PortLineHandler *dispatcher = nullptr;
 
+  /**
+   * Counts the NMEA lines received from the port and the
+   * #DeviceBlackboard edit sessions they caused.
+   */
+  DeviceIngestCounters ingest_counters;
+
   /**
    * The device driver used to handle data to/from the device.
    */
@@ -511,6 +518,16 @@ public:
 
   DeviceDataEditor BeginEdit() noexcept;
 
+  /**
+   * Returns the NMEA ingestion rates of the last measurement window.
+   * They are updated by OnSysTicker().
+   *
+   * May only be called from the main thread.
+   */
+  const DeviceIngestStats &GetIngestStats() const noexcept {
+    return ingest_counters.GetStats();
+  }
+
 private:
   bool ParseNMEA(const char *line, struct NMEAInfo &info) noexcept;
 
@@ -598,6 +615,9 @@ private:
   /* virtual methods from PortLineHandler */
   bool LineReceived(const char *line) noexcept override;
 
+  /* virtual methods from PortLineSplitter */
+  bool LinesReceived(std::span<const char *const> lines) noexcept override;
+
 #ifdef HAVE_INTERNAL_GPS
   /* methods from SensorListener */
   void OnConnected(int connected) noexcept override;
@@ -2,8 +2,7 @@
 // Copyright The XCSoar Project
 
 #include "Device.hpp"
-#include "NMEA/InputLine.hpp"
-#include "NMEA/Checksum.hpp"
+#include "NMEA/Sentence.hpp"
 
 #include <string.h>
 
@@ -31,12 +30,13 @@ FlarmDevice::ParsePFLAC(NMEAInputLine &line)
 bool
 FlarmDevice::ParseNMEA(const char *_line, [[maybe_unused]] NMEAInfo &info)
 {
-  if (!VerifyNMEAChecksum(_line))
+  const NMEASentence sentence(_line);
+  if (!sentence.IsChecksumValid())
     return false;
 
-  NMEAInputLine line(_line);
+  NMEAInputLine line = sentence.GetLine();
 
-  const auto type = line.ReadView();
+  const auto type = sentence.GetType();
   if (type == "$PFLAC"sv)
     return ParsePFLAC(line);
   else
@@ -2,8 +2,8 @@
 // Copyright The XCSoar Project
 
 #include "Internal.hpp"
-#include "NMEA/Checksum.hpp"
-#include "NMEA/InputLine.hpp"
+#include "NMEA/Sentence.hpp"
+#include "NMEA/SentenceTable.hpp"
 #include "NMEA/Info.hpp"
 #include "Geo/SpeedVector.hpp"
 #include "Units/System.hpp"
@@ -286,19 +286,50 @@ PLXVS(NMEAInputLine &line, NMEAInfo &info)
   return true;
 }
 
+namespace {
+
+enum class LXSentence : uint_least8_t {
+  LXWP0,
+  LXWP1,
+  LXWP2,
+  LXWP3,
+  PLXV0,
+  PLXVC,
+  PLXVF,
+  PLXVS,
+};
+
+} // anonymous namespace
+
+static constexpr auto lx_sentences = MakeNMEASentenceTable<LXSentence>({
+  {"$LXWP0"sv, LXSentence::LXWP0},
+  {"$LXWP1"sv, LXSentence::LXWP1},
+  {"$LXWP2"sv, LXSentence::LXWP2},
+  {"$LXWP3"sv, LXSentence::LXWP3},
+  {"$PLXV0"sv, LXSentence::PLXV0},
+  {"$PLXVC"sv, LXSentence::PLXVC},
+  {"$PLXVF"sv, LXSentence::PLXVF},
+  {"$PLXVS"sv, LXSentence::PLXVS},
+});
+
 bool
 LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
 {
-  if (!VerifyNMEAChecksum(String))
+  const NMEASentence sentence(String);
+  if (!sentence.IsChecksumValid())
+    return false;
+
+  const auto *type = lx_sentences.Find(sentence.GetType());
+  if (type == nullptr)
     return false;
 
-  NMEAInputLine line(String);
+  NMEAInputLine line = sentence.GetLine();
 
-  const auto type = line.ReadView();
-  if (type == "$LXWP0"sv)
+  switch (*type) {
+  case LXSentence::LXWP0:
     return LXWP0(line, info);
 
-  else if (type == "$LXWP1"sv) {
+  case LXSentence::LXWP1: {
     /* if in pass-through mode, assume that this line was sent by the
        secondary device */
     DeviceInfo &device_info = mode == Mode::PASS_THROUGH
@@ -335,18 +366,19 @@ LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
       is_colibri = false;
 
     return true;
+  }
 
-  } else if (type == "$LXWP2"sv)
+  case LXSentence::LXWP2:
     return LXWP2(line, info);
 
-  else if (type == "$LXWP3"sv)
+  case LXSentence::LXWP3:
     return LXWP3(line, info);
 
-  else if (type == "$PLXV0"sv) {
+  case LXSentence::PLXV0:
     is_colibri = false;
     return PLXV0(line, lxnav_vario_settings);
 
-  } else if (type == "$PLXVC"sv) {
+  case LXSentence::PLXVC:
     is_colibri = false;
     PLXVC(line, info.device, info.secondary_device, nano_settings);
     is_forwarded_nano = info.secondary_device.product.equals("NANO") ||
@@ -357,14 +389,14 @@ LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
 
     return true;
 
-  } else if (type == "$PLXVF"sv) {
+  case LXSentence::PLXVF:
     is_colibri = false;
     return PLXVF(line, info);
 
-  } else if (type == "$PLXVS"sv) {
+  case LXSentence::PLXVS:
     is_colibri = false;
     return PLXVS(line, info);
+  }
 
-  } else
-    return false;
+  return false;
 }
@@ -4,7 +4,8 @@
 #include "Internal.hpp"
 #include "Message.hpp"
 #include "NMEA/Info.hpp"
-#include "NMEA/InputLine.hpp"
+#include "NMEA/Sentence.hpp"
+#include "NMEA/SentenceTable.hpp"
 
 #include <tchar.h>
 #include <algorithm>
@@ -194,36 +195,80 @@ PDTSM(NMEAInputLine &line, [[maybe_unused]] NMEAInfo &info)
   return true;
 }
 
+namespace {
+
+enum class VegaSentence : uint_least8_t {
+  PDSWC,
+  PDAAV,
+  PDVSC,
+  PDVDV,
+  PDVDS,
+  PDVVT,
+  PDVSD,
+  PDTSM,
+};
+
+} // anonymous namespace
+
+static constexpr auto vega_sentences = MakeNMEASentenceTable<VegaSentence>({
+  {"$PDSWC"sv, VegaSentence::PDSWC},
+  {"$PDAAV"sv, VegaSentence::PDAAV},
+  {"$PDVSC"sv, VegaSentence::PDVSC},
+  {"$PDVDV"sv, VegaSentence::PDVDV},
+  {"$PDVDS"sv, VegaSentence::PDVDS},
+  {"$PDVVT"sv, VegaSentence::PDVVT},
+  {"$PDVSD"sv, VegaSentence::PDVSD},
+  {"$PDTSM"sv, VegaSentence::PDTSM},
+});
+
 bool
 VegaDevice::ParseNMEA(const char *String, NMEAInfo &info)
 {
-  NMEAInputLine line(String);
+  /* this driver does not verify checksums; NMEASentence is only
+     used to split the line */
+  const NMEASentence sentence(String);
 
-  const auto type = line.ReadView();
+  const auto type = sentence.GetType();
 
   if (type.starts_with("$PD"sv))
     detected = true;
 
-  if (type == "$PDSWC"sv)
+  const auto *t = vega_sentences.Find(type);
+  if (t == nullptr)
+    return false;
+
+  NMEAInputLine line = sentence.GetLine();
+
+  switch (*t) {
+  case VegaSentence::PDSWC:
     return PDSWC(line, info, volatile_data);
-  else if (type == "$PDAAV"sv)
+
+  case VegaSentence::PDAAV:
     return PDAAV(line, info);
-  else if (type == "$PDVSC"sv)
+
+  case VegaSentence::PDVSC:
     return PDVSC(line, info);
-  else if (type == "$PDVDV"sv)
+
+  case VegaSentence::PDVDV:
     return PDVDV(line, info);
-  else if (type == "$PDVDS"sv)
+
+  case VegaSentence::PDVDS:
     return PDVDS(line, info);
-  else if (type == "$PDVVT"sv)
+
+  case VegaSentence::PDVVT:
     return PDVVT(line, info);
-  else if (type == "$PDVSD"sv) {
+
+  case VegaSentence::PDVSD: {
     const auto message = line.Rest();
     StaticString<256> buffer;
     buffer.SetASCII(message);
     Message::AddMessage(buffer);
     return true;
-  } else if (type == "$PDTSM"sv)
+  }
+
+  case VegaSentence::PDTSM:
     return PDTSM(line, info);
-  else
-    return false;
+  }
+
+  return false;
 }
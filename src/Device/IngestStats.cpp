@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "IngestStats.hpp"
+
+bool
+DeviceIngestCounters::Update(const Clock::time_point now) noexcept
+{
+  const auto elapsed = now - window_start;
+  if (elapsed < WINDOW)
+    return false;
+
+  const unsigned current_lines = lines.load(std::memory_order_relaxed);
+  const unsigned current_merges = merges.load(std::memory_order_relaxed);
+  const uint_least64_t current_lock_hold_ns =
+    lock_hold_ns.load(std::memory_order_relaxed);
+
+  const unsigned n_lines = current_lines - window_lines;
+  const unsigned n_merges = current_merges - window_merges;
+
+  if (window_start != Clock::time_point{}) {
+    const double seconds = FloatDuration(elapsed).count();
+    stats.lines_per_second = n_lines / seconds;
+    stats.merges_per_second = n_merges / seconds;
+    const std::chrono::nanoseconds lock_hold(current_lock_hold_ns -
+                                             window_lock_hold_ns);
+    stats.lock_hold_time = n_merges > 0
+      ? FloatDuration(lock_hold) / n_merges
+      : FloatDuration{};
+  }
+
+  window_start = now;
+  window_lines = current_lines;
+  window_merges = current_merges;
+  window_lock_hold_ns = current_lock_hold_ns;
+  return true;
+}
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "time/FloatDuration.hxx"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Rates describing how a device feeds NMEA data into the
+ * #DeviceBlackboard, see #DeviceIngestCounters.
+ */
+struct DeviceIngestStats {
+  /**
+   * Number of lines parsed per second.
+   */
+  double lines_per_second = 0;
+
+  /**
+   * Number of edit sessions (each taking the #DeviceBlackboard mutex
+   * and scheduling a merge) per second.
+   */
+  double merges_per_second = 0;
+
+  /**
+   * The average time the #DeviceBlackboard mutex was held by one
+   * edit session.
+   */
+  FloatDuration lock_hold_time{};
+
+  constexpr bool operator==(const DeviceIngestStats &) const noexcept = default;
+};
+
+/**
+ * Counts the lines and edit sessions of one device.  Add() is called
+ * by the port's thread, Update() by the main thread.
+ */
+class DeviceIngestCounters {
+  using Clock = std::chrono::steady_clock;
+
+  std::atomic<unsigned> lines{0}, merges{0};
+  std::atomic<uint_least64_t> lock_hold_ns{0};
+
+  /**
+   * The counter values at the start of the current measurement
+   * window.
+   */
+  Clock::time_point window_start{};
+  unsigned window_lines = 0, window_merges = 0;
+  uint_least64_t window_lock_hold_ns = 0;
+
+  DeviceIngestStats stats;
+
+public:
+  static constexpr Clock::duration WINDOW = std::chrono::seconds{1};
+
+  /**
+   * Record one edit session.
+   *
+   * @param n_lines the number of lines parsed in it
+   * @param lock_hold_time how long the #DeviceBlackboard mutex was held
+   */
+  void Add(unsigned n_lines, Clock::duration lock_hold_time) noexcept {
+    lines.fetch_add(n_lines, std::memory_order_relaxed);
+    merges.fetch_add(1, std::memory_order_relaxed);
+    const auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(lock_hold_time);
+    lock_hold_ns.fetch_add(ns.count(), std::memory_order_relaxed);
+  }
+
+  /**
+   * Recalculate the rates if the current window has expired.
+   *
+   * @return true if the rates were updated
+   */
+  bool Update(Clock::time_point now=Clock::now()) noexcept;
+
+  const DeviceIngestStats &GetStats() const noexcept {
+    return stats;
+  }
+};
@@ -4,8 +4,8 @@
 #include "Device/Parser.hpp"
 #include "Geo/Geoid.hpp"
 #include "NMEA/Info.hpp"
-#include "NMEA/Checksum.hpp"
-#include "NMEA/InputLine.hpp"
+#include "NMEA/Sentence.hpp"
+#include "NMEA/SentenceTable.hpp"
 #include "Units/System.hpp"
 #include "Driver/FLARM/StaticParser.hpp"
 #include "util/CharUtil.hxx"
@@ -27,6 +27,55 @@ NMEAParser::Reset()
   last_time = {};
 }
 
+namespace {
+
+enum class TalkerSentence : uint_least8_t {
+  GSA,
+  GLL,
+  RMC,
+  GGA,
+  HDM,
+  MWV,
+};
+
+enum class ProprietarySentence : uint_least8_t {
+  PTAS1,
+  PFLAE,
+  PFLAV,
+  PFLAA,
+  PFLAU,
+  PGRMZ,
+};
+
+} // anonymous namespace
+
+/**
+ * Sentences with a talker id ("$GPRMC", "$GNRMC", ...); the key
+ * omits the "$" and the two-letter talker id.
+ */
+static constexpr auto talker_sentences =
+  MakeNMEASentenceTable<TalkerSentence>({
+    {"GSA"sv, TalkerSentence::GSA},
+    {"GLL"sv, TalkerSentence::GLL},
+    {"RMC"sv, TalkerSentence::RMC},
+    {"GGA"sv, TalkerSentence::GGA},
+    {"HDM"sv, TalkerSentence::HDM},
+    {"MWV"sv, TalkerSentence::MWV},
+  });
+
+/**
+ * Proprietary sentences; the key omits the "$".
+ */
+static constexpr auto proprietary_sentences =
+  MakeNMEASentenceTable<ProprietarySentence>({
+    {"PTAS1"sv, ProprietarySentence::PTAS1},
+    {"PFLAE"sv, ProprietarySentence::PFLAE},
+    {"PFLAV"sv, ProprietarySentence::PFLAV},
+    {"PFLAA"sv, ProprietarySentence::PFLAA},
+    {"PFLAU"sv, ProprietarySentence::PFLAU},
+    {"PGRMZ"sv, ProprietarySentence::PGRMZ},
+  });
+
 bool
 NMEAParser::ParseLine(const char *string, NMEAInfo &info)
 {
@@ -35,71 +84,72 @@ NMEAParser::ParseLine(const char *string, NMEAInfo &info)
   if (string[0] != '$')
     return false;
 
-  if (!NMEAChecksum(string))
+  const NMEASentence sentence(string);
+  if (!sentence.IsChecksumValid())
     return false;
 
-  NMEAInputLine line(string);
-
-  const auto type = line.ReadView();
+  const auto type = sentence.GetType();
   if (type.size() < 6)
     return false;
 
-  if (IsAlphaASCII(type[1]) && IsAlphaASCII(type[2])) {
-    const auto type2 = type.substr(3);
+  NMEAInputLine line = sentence.GetLine();
 
-    if (type2 == "GSA"sv)
-      return GSA(line, info);
+  if (IsAlphaASCII(type[1]) && IsAlphaASCII(type[2])) {
+    if (const auto *t = talker_sentences.Find(type.substr(3))) {
+      switch (*t) {
+      case TalkerSentence::GSA:
+        return GSA(line, info);
 
-    if (type2 == "GLL"sv)
-      return GLL(line, info);
+      case TalkerSentence::GLL:
+        return GLL(line, info);
 
-    if (type2 == "RMC"sv)
-      return RMC(line, info);
+      case TalkerSentence::RMC:
+        return RMC(line, info);
 
-    if (type2 == "GGA"sv)
-      return GGA(line, info);
+      case TalkerSentence::GGA:
+        return GGA(line, info);
 
-    if (type2 == "HDM"sv)
-      return HDM(line, info);
+      case TalkerSentence::HDM:
+        return HDM(line, info);
 
-    if (type2 == "MWV"sv)
-      return MWV(line, info);
+      case TalkerSentence::MWV:
+        return MWV(line, info);
+      }
+    }
   }
 
   // if (proprietary sentence) ...
   if (type[1] == 'P') {
-    const auto type2 = type.substr(1);
+    const auto *t = proprietary_sentences.Find(type.substr(1));
+    if (t == nullptr)
+      return false;
 
-    // Airspeed and vario sentence
-    if (type2 == "PTAS1"sv)
+    switch (*t) {
+    case ProprietarySentence::PTAS1:
+      // Airspeed and vario sentence
       return PTAS1(line, info);
 
     // FLARM sentences
-    if (type2 == "PFLAE"sv) {
+    case ProprietarySentence::PFLAE:
       ParsePFLAE(line, info.flarm.error, info.clock);
       return true;
-    }
 
-    if (type2 == "PFLAV"sv) {
+    case ProprietarySentence::PFLAV:
       ParsePFLAV(line, info.flarm.version, info.clock);
       return true;
-    }
 
-    if (type2 == "PFLAA"sv) {
+    case ProprietarySentence::PFLAA:
       ParsePFLAA(line, info.flarm.traffic, info.clock);
       return true;
-    }
 
-    if (type2 == "PFLAU"sv) {
+    case ProprietarySentence::PFLAU:
       ParsePFLAU(line, info.flarm.status, info.clock);
       return true;
-    }
 
-    // Garmin altitude sentence
-    if (type2 == "PGRMZ"sv)
+    case ProprietarySentence::PGRMZ:
+      // Garmin altitude sentence
       return RMZ(line, info);
-
-    return false;
+    }
   }
 
   return false;
@@ -660,12 +710,6 @@ NMEAParser::RMZ(NMEAInputLine &line, NMEAInfo &info)
   return true;
 }
 
-bool
-NMEAParser::NMEAChecksum(const char *string)
-{
-  return VerifyNMEAChecksum(string);
-}
-
 bool
 NMEAParser::PTAS1(NMEAInputLine &line, NMEAInfo &info)
 {
@@ -32,6 +32,13 @@ PortLineSplitter::DataReceived(std::span<const std::byte> s) noexcept
 
   const char *data = (const char *)s.data(), *end = data + s.size();
 
+  /* the lines cannot be longer than what was buffered plus the new
+     chunk; reserving that much up front keeps the pointers in
+     "batch_lines" valid */
+  batch.clear();
+  batch.reserve(buffer.Read().size() + s.size());
+  batch_lines.clear();
+
   do {
     /* append new data to buffer, as much as fits there */
     auto range = buffer.Write();
@@ -68,10 +75,27 @@ PortLineSplitter::DataReceived(std::span<const std::byte> s) noexcept
       while ((nul = memchr(line, 0, end - line)) != nullptr)
         line = (char *)nul + 1;
 
-      if (!LineReceived(line))
-        return false;
+      /* copy the line, because the buffer may be overwritten by the
+         rest of the chunk */
+      assert(batch.size() + (end - line) + 1 <= batch.capacity());
+      batch_lines.push_back(batch.data() + batch.size());
+      batch.insert(batch.end(), line, end);
+      batch.push_back('\0');
     }
   } while (data < end);
 
+  if (batch_lines.empty())
+    return true;
+
+  return LinesReceived(batch_lines);
+}
+
+bool
+PortLineSplitter::LinesReceived(std::span<const char *const> lines) noexcept
+{
+  for (const char *line : lines)
+    if (!LineReceived(line))
+      return false;
+
   return true;
 }
@@ -7,12 +7,33 @@
 #include "LineHandler.hpp"
 #include "util/StaticFifoBuffer.hxx"
 
+#include <span>
+#include <vector>
+
 class PortLineSplitter : public DataHandler, protected PortLineHandler {
   typedef StaticFifoBuffer<char, 256u> Buffer;
 
   Buffer buffer;
 
+  /**
+   * The complete lines found in the current DataReceived() chunk,
+   * each one null-terminated, and pointers to them.  They are kept
+   * to avoid allocating for each chunk.
+   */
+  std::vector<char> batch;
+  std::vector<const char *> batch_lines;
+
 public:
   /* virtual methods from class DataHandler */
   bool DataReceived(std::span<const std::byte> s) noexcept override;
+
+protected:
+  /**
+   * Handle all complete lines of one DataReceived() chunk at once.
+   * The default implementation passes each of them to
+   * LineReceived().
+   *
+   * @return false if the handler wishes to receive no more data
+   */
+  virtual bool LinesReceived(std::span<const char *const> lines) noexcept;
 };
@@ -169,6 +169,12 @@ class DeviceListWidget final
   Item items[NUMDEV];
   tstring error_messages[NUMDEV];
 
+  /**
+   * The NMEA ingestion rates; only shown (and updated) while debug
+   * mode is enabled for the device.
+   */
+  DeviceIngestStats ingest_stats[NUMDEV];
+
   Button *disable_button;
   Button *reconnect_button, *flight_button;
   Button *edit_button;
@@ -281,6 +287,14 @@ DeviceListWidget::RefreshList()
         error_messages[i] = std::move(error_message);
         modified = true;
       }
+
+      const DeviceIngestStats stats = (*item).debug
+        ? (*devices)[i].GetIngestStats()
+        : DeviceIngestStats{};
+      if (stats != ingest_stats[i]) {
+        ingest_stats[i] = stats;
+        modified = true;
+      }
     }
   }
 
@@ -444,6 +458,13 @@ DeviceListWidget::OnPaintItem(Canvas &canvas, const PixelRect rc,
     if (flags.debug) {
       buffer.append(_T("; "));
       buffer.append(_("Debug"));
+
+      const DeviceIngestStats &stats = ingest_stats[idx];
+      buffer.append(_T(" ("));
+      buffer.AppendFormat(_("%.0f lines/s, %.0f merges/s, lock %.0f µs"),
+                          stats.lines_per_second, stats.merges_per_second,
+                          stats.lock_hold_time.count() * 1e6);
+      buffer.append(_T(")"));
     }
 
     if (flags.battery_percent >= 0) {
@@ -22,6 +22,7 @@ enum ControlIndex {
   CrewWeightTemplate,
   LoggerTimeStepCruise,
   LoggerTimeStepCircling,
+  LoggerSyncInterval,
   DisableAutoLogger,
   EnableNMEALogger,
   EnableFlightLogger,
@@ -74,6 +75,13 @@ LoggerConfigPanel::Prepare(ContainerWindow &parent,
               seconds{1}, seconds{30}, seconds{1}, logger.time_step_circling);
   SetExpertRow(LoggerTimeStepCircling);
 
+  AddDuration(_("Sync interval"),
+              _("The maximum time logged points are kept in memory before they "
+                "are written to storage. Longer intervals mean fewer writes, but "
+                "more points may be lost if the device loses power."),
+              seconds{1}, seconds{60}, seconds{1}, logger.sync_interval);
+  SetExpertRow(LoggerSyncInterval);
+
   AddEnum(_("Auto. logger"),
           _("Enables the automatic starting and stopping of logger on takeoff and landing "
             "respectively. Disable when flying paragliders."),
@@ -115,6 +123,9 @@ LoggerConfigPanel::Save(bool &changed) noexcept
   changed |= SaveValue(LoggerTimeStepCircling, ProfileKeys::LoggerTimeStepCircling,
                        logger.time_step_circling);
 
+  changed |= SaveValue(LoggerSyncInterval, ProfileKeys::LoggerSyncInterval,
+                       logger.sync_interval);
+
   /* GUI label is "Enable Auto Logger" */
   changed |= SaveValueEnum(DisableAutoLogger, ProfileKeys::AutoLogger,
                            logger.auto_logger);
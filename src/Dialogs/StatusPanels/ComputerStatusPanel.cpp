@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "ComputerStatusPanel.hpp"
+#include "Interface.hpp"
+#include "Language/Language.hpp"
+
+void
+ComputerStatusPanel::Refresh() noexcept
+{
+  const StageTimingInfo &timing = CommonInterface::Calculated().stage_timing;
+  const StageBudgetSettings &budget =
+    CommonInterface::GetComputerSettings().stage_budget;
+
+  StaticString<64> temp;
+
+  for (std::size_t i = 0; i < NUM_COMPUTER_STAGES; ++i) {
+    const ComputerStage stage = ComputerStage(i);
+    const StageTiming &t = timing[stage];
+
+    if (t.count == 0) {
+      ClearText(i);
+      continue;
+    }
+
+    /* mean / max, budget in parentheses */
+    temp.Format(_T("%.1f / %.1f ms (%u)"),
+                t.mean / 1000., t.max / 1000., budget.Get(stage));
+
+    if (t.deferred > 0)
+      temp.AppendFormat(_T(", %s %u"), _("deferred"), t.deferred);
+
+    SetText(i, temp);
+  }
+
+  const StageTiming &latency = timing.fix_latency;
+  if (latency.count > 0) {
+    temp.Format(_T("%.0f / %.0f ms"),
+                latency.mean / 1000., latency.max / 1000.);
+    SetText(NUM_COMPUTER_STAGES, temp);
+  } else
+    ClearText(NUM_COMPUTER_STAGES);
+}
+
+void
+ComputerStatusPanel::Prepare([[maybe_unused]] ContainerWindow &parent,
+                             [[maybe_unused]] const PixelRect &rc) noexcept
+{
+  /* one row per ComputerStage, in the same order */
+  AddReadOnly(_("Air data"));
+  AddReadOnly(_("Trace"));
+  AddReadOnly(_("Task"));
+  AddReadOnly(_("Route"));
+  AddReadOnly(_("Cloud base"));
+  AddReadOnly(_("Statistics"));
+  AddReadOnly(_("Monitors"));
+  AddReadOnly(_("Contest"));
+  AddReadOnly(_("Airspace warnings"));
+  AddReadOnly(_("Logger"));
+
+  AddReadOnly(_("Fix latency"));
+}
@@ -26,6 +26,7 @@ class RASPSettingsPanel final
     FILE,
     ITEM,
     TIME,
+    INTERPOLATE,
   };
 
   std::shared_ptr<RaspStore> rasp;
@@ -134,6 +135,10 @@ RASPSettingsPanel::Prepare([[maybe_unused]] ContainerWindow &parent,
       : BrokenTime::Invalid();
   });
   UpdateTimeControl();
+
+  AddBoolean(_("Interpolate"),
+             _("Blend the two forecast steps around the current time of day.  Only applies if the time is \"Now\"."),
+             state.interpolate);
 }
 
 bool
@@ -143,6 +148,7 @@ RASPSettingsPanel::Save([[maybe_unused]] bool &_changed) noexcept
 
   state.map = GetValueEnum(ITEM);
   state.time = time;
+  state.interpolate = GetValueBoolean(INTERPOLATE);
 
   ActionInterface::SendUIState(true);
 
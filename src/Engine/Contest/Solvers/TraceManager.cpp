@@ -63,7 +63,7 @@ TraceManager::IsMasterUpdated(bool continuous) const noexcept
   const unsigned threshold_distance_trace = trace_master.GetAverageDeltaDistance();
 
   const TracePoint &last_master = trace_master.back();
-  const TracePoint &last_point = *trace.back();
+  const TracePoint &last_point = trace.back();
 
   // update trace if time and distance are greater than significance thresholds
 
@@ -76,7 +76,7 @@ TraceManager::ClearTrace() noexcept
 {
   append_serial = modify_serial = Serial();
   trace_dirty = true;
-  trace.clear();
+  trace = {};
   n_points = 0;
   predicted = TracePoint::Invalid();
 }
@@ -84,8 +84,7 @@ TraceManager::ClearTrace() noexcept
 void
 TraceManager::UpdateTraceFull() noexcept
 {
-  trace.reserve(trace_master.GetMaxSize());
-  trace_master.GetPoints(trace);
+  trace = trace_master.GetPoints();
   n_points = trace.size();
 
   if (n_points > 0 && predicted.IsDefined())
@@ -104,10 +103,17 @@ TraceManager::UpdateTraceTail() noexcept
   //assert(incremental == finished || force);
   assert(modify_serial == trace_master.GetModifySerial());
 
-  if (!trace_master.SyncPoints(trace))
+  const auto points = trace_master.GetPoints();
+  assert(points.size() >= trace.size());
+
+  if (points.size() == trace.size())
     /* no new points */
     return false;
 
+  /* appending does not move the existing points */
+  assert(trace.empty() || points.data() == trace.data());
+  trace = points;
+
   n_points = trace.size();
 
   if (n_points > 0 && predicted.IsDefined())
@@ -5,6 +5,7 @@
 #include "Cast.hpp"
 #include "Trace/Trace.hpp"
 #include "util/QuadTree.hxx"
+#include "util/Compiler.h"
 
 /*
  @todo potential to use 3d convex hull to speed search
@@ -242,73 +242,31 @@ GlidePolar::IsGlidePossible(const GlideState &task) const noexcept
   return true;
 }
 
-/**
- * Finds speed to fly for a given MacCready setting
- * Intended to be used temporarily.
- *
- * This finds the speed that maximises the glide angle over the ground
- */
-class GlidePolarSpeedToFly final : public ZeroFinder {
-  static constexpr double TOLERANCE_DOLPHIN = 0.0001;
-
-  const GlidePolar &polar;
-  const double m_net_sink_rate;
-  const double m_head_wind;
-
-public:
-  /**
-   * Constructor.
-   *
-   * @param _polar Glide polar to optimise
-   * @param net_sink_rate Instantaneous netto sink rate (m/s), positive down
-   * @param head_wind Head wind component (m/s)
-   * @param vmin Minimum speed to search (m/s)
-   * @param vmax Maximum speed to search (m/s)
-   *
-   * @return Initialised object (no search yet)
-   */
-  GlidePolarSpeedToFly(const GlidePolar &_polar, const double net_sink_rate,
-                       const double head_wind, const double vmin,
-                       const double vmax) :
-    ZeroFinder(std::max(1., vmin - head_wind), vmax - head_wind,
-               TOLERANCE_DOLPHIN),
-    polar(_polar),
-    m_net_sink_rate(net_sink_rate),
-    m_head_wind(head_wind)
-  {
-  }
-
-  /**
-   * Glide ratio over ground function
-   *
-   * @param V Speed over ground (m/s)
-   *
-   * @return MacCready-adjusted inverse glide ratio over ground
-   */
-  double f(const double V) noexcept override {
-    return (polar.MSinkRate(V + m_head_wind) + m_net_sink_rate) / V;
-  }
-
-  /**
-   * Find best speed to fly
-   *
-   * @param Vstart Initial search speed (m/s)
-   *
-   * @return Speed to fly (m/s)
-   */
-  double solve(const double Vstart) {
-    auto Vopt = find_min(Vstart);
-    return Vopt + m_head_wind;
-  }
-};
-
 double
 GlidePolar::SpeedToFly(const double stf_sink_rate,
                        const double head_wind) const noexcept
 {
   assert(IsValid());
-  GlidePolarSpeedToFly gp_stf(*this, stf_sink_rate, head_wind, Vmin, Vmax);
-  return gp_stf.solve(Vmax);
+
+  /* the speed to fly minimises the MacCready-adjusted inverse glide
+     ratio over ground:
+
+       f(V) = (MSinkRate(V) + stf_sink_rate) / (V - head_wind)
+
+     With the parabolic polar, f'(V)=0 is a quadratic equation with
+     the solution below (compare with GetBestGlideRatioSpeed()).  If
+     it has no solution, f is increasing, and the lower bound is the
+     optimum; else f is convex above the head wind, and clipping to
+     the allowed range yields the optimum in that range. */
+
+  const auto s = Square(head_wind) +
+    (mc + stf_sink_rate + polar.c + polar.b * head_wind) / polar.a;
+  const auto v = s > 0
+    ? head_wind + sqrt(s)
+    : head_wind;
+
+  /* the ground speed must be at least 1 m/s */
+  return std::min(std::max({v, Vmin, head_wind + 1}), Vmax);
 }
 
 double
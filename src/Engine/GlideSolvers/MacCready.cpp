@@ -6,6 +6,9 @@
 #include "GlidePolar.hpp"
 #include "GlideResult.hpp"
 #include "Math/ZeroFinder.hpp"
+#include "Math/Util.hpp"
+
+#include <algorithm>
 
 #include <cassert>
 
@@ -371,7 +374,59 @@ MacCready::OptimiseGlide(const GlideState &task, const bool allow_partial) const
                        glide_polar.GetVMin(), glide_polar.GetVMax(),
                        allow_partial);
 
-  return mc_vopt.Result(glide_polar.GetVMin());
+  return mc_vopt.Result(EstimateOptimalGlideSpeed(task));
+}
+
+inline double
+MacCready::EstimateOptimalGlideSpeed(const GlideState &task) const noexcept
+{
+  /* at MC=0, GlidePolar::GetBestGlideRatioSpeed() is the optimum if
+     there is no cross wind; the cruise efficiency scales the speed
+     over ground, which is equivalent to scaling the head wind */
+  auto v = glide_polar.GetBestGlideRatioSpeed(task.head_wind /
+                                              cruise_efficiency);
+
+  /* with cross wind, the speed over ground (see
+     GlideState::CalcAverageSpeed()) is not linear; replace it with
+     its tangent at the current estimate, which again is a "head
+     wind" problem, and repeat; this converges quickly */
+  const auto cross_wind_squared =
+    Square(task.wind.norm) - Square(task.head_wind);
+  if (cross_wind_squared > 0) {
+    for (unsigned i = 0; i < 3; ++i) {
+      const auto v_eff = v * cruise_efficiency;
+      const auto root_squared = Square(v_eff) - cross_wind_squared;
+      if (root_squared <= 0)
+        break;
+
+      const auto root = sqrt(root_squared);
+      const auto ground_speed = root - task.head_wind;
+      const auto slope = cruise_efficiency * v_eff / root;
+      v = glide_polar.GetBestGlideRatioSpeed(v - ground_speed / slope);
+    }
+  }
+
+  return std::clamp(v, glide_polar.GetVMin(), glide_polar.GetVMax());
+}
+
+void
+MacCready::Solve(std::span<const GlideState> tasks,
+                 std::span<GlideResult> results) const
+{
+  assert(results.size() == tasks.size());
+
+  auto result = results.begin();
+  for (const auto &task : tasks)
+    *result++ = Solve(task);
+}
+
+void
+MacCready::Solve(const GlideSettings &settings, const GlidePolar &glide_polar,
+                 std::span<const GlideState> tasks,
+                 std::span<GlideResult> results)
+{
+  const MacCready mac(settings, glide_polar);
+  mac.Solve(tasks, results);
 }
 
 /*
@@ -5,6 +5,8 @@
 
 #include "util/Compiler.h"
 
+#include <span>
+
 struct GlideSettings;
 struct GlideState;
 struct GlideResult;
@@ -85,6 +87,23 @@ public:
                            const GlidePolar &glide_polar,
                            const GlideState &task);
 
+  /**
+   * Calculates the glide solutions for many independent tasks with
+   * the same polar, e.g. all alternates.  This is equivalent to
+   * calling Solve() for each of them.
+   *
+   * @param tasks The tasks for which solutions are desired
+   * @param results Receives the glide results; must have the same
+   * size as #tasks
+   */
+  void Solve(std::span<const GlideState> tasks,
+             std::span<GlideResult> results) const;
+
+  static void Solve(const GlideSettings &settings,
+                    const GlidePolar &glide_polar,
+                    std::span<const GlideState> tasks,
+                    std::span<GlideResult> results);
+
   /**
    * Calculates the glide solution for a classical MacCready theory task
    * with no climb component (pure glide).  This is used internally to
@@ -137,6 +156,13 @@ private:
   GlideResult OptimiseGlide(const GlideState &task,
                             const bool allow_partial = false) const;
 
+  /**
+   * Returns a good initial value for the OptimiseGlide() search: the
+   * optimal speed without cross wind.
+   */
+  [[gnu::pure]]
+  double EstimateOptimalGlideSpeed(const GlideState &task) const noexcept;
+
   /**
    * Solve a task which is known to be pure climb (no distance
    * to travel other than that due to drift).
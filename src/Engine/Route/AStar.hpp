@@ -3,9 +3,13 @@
 
 #pragma once
 
-#include "util/ReservablePriorityQueue.hpp"
+#include "util/RadixQueue.hpp"
 
-#include <unordered_map>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <vector>
 
 struct AStarPriorityValue
 {
@@ -48,6 +52,11 @@ struct AStarPriorityValue
  * Modifications by John Wharington to track optimal solution
  * @see http://en.giswiki.net/wiki/Dijkstra%27s_algorithm
  *
+ * Node state lives in a flat arena which is indexed by an
+ * open-addressing hash table; both are kept (but invalidated) by
+ * Clear(), so repeated searches do not allocate once the containers
+ * have reached their working size.
+ *
  * @param m_min Whether this algorithm will search for min or max distance
  */
 template <class Node, class Hash=std::hash<Node>,
@@ -55,48 +64,69 @@ template <class Node, class Hash=std::hash<Node>,
           bool m_min=true>
 class AStar
 {
-  typedef std::unordered_map<Node, AStarPriorityValue, Hash, KeyEqual> node_value_map;
+  static constexpr unsigned NO_ENTRY = std::numeric_limits<unsigned>::max();
+
+  /**
+   * The value of nodes excluded by Rekey().  It is larger than any
+   * real value, but leaves room for adding edges without overflow.
+   */
+  static constexpr unsigned UNREACHABLE =
+    std::numeric_limits<unsigned>::max() / 2;
 
-  typedef typename node_value_map::iterator node_value_iterator;
+  /**
+   * The state of one node which has been reached by the search.
+   */
+  struct Entry {
+    Node node;
+
+    /**
+     * The best predecessor found so far; the start node is its own
+     * predecessor.
+     */
+    Node parent;
+
+    /**
+     * The best value found so far.  It is updated by Push(), if a
+     * value lower than the current one is found.
+     */
+    AStarPriorityValue value;
+  };
 
-  typedef std::unordered_map<Node, Node, Hash, KeyEqual> node_parent_map;
+  /**
+   * One slot of the hash table.  The slot is only valid if its
+   * #generation matches AStar::generation, which allows Clear() to
+   * invalidate the whole table without touching it.
+   */
+  struct Slot {
+    unsigned generation = 0;
+    unsigned entry;
+  };
 
   struct NodeValue {
     AStarPriorityValue priority;
 
-    node_value_iterator iterator;
-
-    constexpr
-    NodeValue(const AStarPriorityValue &_priority,
-              node_value_iterator _iterator) noexcept
-      :priority(_priority), iterator(_iterator) {}
-  };
-
-  struct Rank {
-    constexpr
-    bool operator()(const NodeValue &x, const NodeValue &y) const noexcept {
-      return x.priority.f() > y.priority.f();
-    }
+    unsigned entry;
   };
 
   /**
-   * Stores the value of each node.  It is updated by push(), if a
-   * value lower than the current one is found.
+   * All nodes reached by the current search, in order of discovery.
    */
-  node_value_map node_values;
+  std::vector<Entry> entries;
 
   /**
-   * Stores the predecessor of each node.  It is maintained by
-   * set_predecessor().
+   * Maps nodes to #entries indices.  The size is zero or a power of
+   * two, and it is always at least twice the size of #entries.
    */
-  node_parent_map node_parents;
+  std::vector<Slot> slots;
+
+  unsigned generation = 1;
 
   /**
    * A sorted list of all possible node paths, lowest distance first.
    */
-  reservable_priority_queue<NodeValue, std::vector<NodeValue>, Rank> q;
+  RadixQueue<NodeValue> q;
 
-  node_value_iterator cur;
+  unsigned cur = NO_ENTRY;
 
 public:
   static constexpr unsigned DEFAULT_QUEUE_SIZE = 1024;
@@ -126,15 +156,18 @@ public:
     Push(node, node, AStarPriorityValue(0));
   }
 
-  /** Clears the queues */
+  /** Clears the queues, but keeps their memory */
   void Clear() noexcept {
-    // Clear the search queue
     q.clear();
-
-    // Clear the node_parent_map
-    node_parents.clear();
-    // Clear the node_value_map
-    node_values.clear();
+    entries.clear();
+    cur = NO_ENTRY;
+
+    if (++generation == 0) {
+      /* the generation counter has wrapped; invalidate all slots
+         explicitly */
+      std::fill(slots.begin(), slots.end(), Slot{});
+      generation = 1;
+    }
   }
 
   /**
@@ -152,15 +185,16 @@ public:
    *
    * @return Node for processing
    */
-  const Node &Pop() noexcept {
-    cur = q.top().iterator;
+  Node Pop() noexcept {
+    cur = q.top().entry;
 
     do { // remove this item
       q.pop();
-    } while (!q.empty() && (q.top().priority > q.top().iterator->second));
+    } while (!q.empty() &&
+             q.top().priority > entries[q.top().entry].value);
     // and all lower rank than this
 
-    return cur->first;
+    return entries[cur].node;
   }
 
   /**
@@ -185,9 +219,8 @@ public:
    */
   [[gnu::pure]]
   Node GetPredecessor(const Node &node) const noexcept {
-    // Try to find the given node in the node_parent_map
-    const auto it = node_parents.find(node);
-    if (it == node_parents.end())
+    const unsigned i = Find(node);
+    if (i == NO_ENTRY)
       // first entry
       // If the node wasn't found
       // -> Return the given node itself
@@ -195,12 +228,45 @@ public:
 
     // If the node was found
     // -> Return the parent node
-    return it->second;
+    return entries[i].parent;
+  }
+
+  /**
+   * Prepare continuing the search towards a different goal.  The
+   * values of all known nodes (the cost from the start) remain
+   * valid, only the heuristic changes, so all of them are queued
+   * again with their new priority.
+   *
+   * @param f a function returning the new heuristic cost for the
+   * given node, or std::nullopt if the goal cannot be reached from
+   * there; such nodes are dropped from the search until a new link
+   * reaches them
+   */
+  template<typename F>
+  void Rekey(F &&f) noexcept {
+    q.clear();
+    cur = NO_ENTRY;
+
+    for (unsigned i = 0; i < entries.size(); ++i) {
+      Entry &entry = entries[i];
+      if (const auto h = f(entry.node)) {
+        entry.value.h = m_min ? *h : AStarPriorityValue::MINMAX_OFFSET - *h;
+        q.push(entry.value.f(), NodeValue{entry.value, i});
+      } else
+        /* make sure that any new link to this node replaces it */
+        entry.value = AStarPriorityValue(UNREACHABLE);
+    }
   }
 
   /** Reserve queue size (if available) */
   void Reserve(unsigned size) noexcept {
+    if (size <= entries.capacity())
+      return;
+
+    entries.reserve(size);
     q.reserve(size);
+    if (slots.size() < 2 * size)
+      Rehash(std::bit_ceil(2 * size));
   }
 
   /**
@@ -209,17 +275,63 @@ public:
    */
   [[gnu::pure]]
   AStarPriorityValue GetNodeValue(const Node &node) const noexcept {
-    if (cur->first == node)
-      return cur->second;
+    if (cur != NO_ENTRY && KeyEqual{}(entries[cur].node, node))
+      return entries[cur].value;
 
-    const auto it = node_values.find(node);
-    if (it == node_values.end())
+    const unsigned i = Find(node);
+    if (i == NO_ENTRY)
       return AStarPriorityValue(0);
 
-    return it->second;
+    return entries[i].value;
   }
 
 private:
+  [[gnu::pure]]
+  std::size_t GetSlotIndex(const Node &node) const noexcept {
+    return Hash{}(node) & (slots.size() - 1);
+  }
+
+  /**
+   * Look up the #entries index of the given node.
+   *
+   * @return the index or #NO_ENTRY
+   */
+  [[gnu::pure]]
+  unsigned Find(const Node &node) const noexcept {
+    if (slots.empty())
+      return NO_ENTRY;
+
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t i = GetSlotIndex(node);; i = (i + 1) & mask) {
+      const Slot &slot = slots[i];
+      if (slot.generation != generation)
+        return NO_ENTRY;
+
+      if (KeyEqual{}(entries[slot.entry].node, node))
+        return slot.entry;
+    }
+  }
+
+  /**
+   * Insert a reference to #entries into the hash table.  The caller
+   * must ensure that there is a free slot.
+   */
+  void InsertSlot(const Node &node, unsigned entry) noexcept {
+    const std::size_t mask = slots.size() - 1;
+    std::size_t i = GetSlotIndex(node);
+    while (slots[i].generation == generation)
+      i = (i + 1) & mask;
+
+    slots[i].generation = generation;
+    slots[i].entry = entry;
+  }
+
+  void Rehash(std::size_t new_size) noexcept {
+    slots.assign(new_size, Slot{});
+    for (std::size_t i = 0; i < entries.size(); ++i)
+      InsertSlot(entries[i].node, i);
+  }
+
   /**
    * Add node to search queue
    *
@@ -229,37 +341,29 @@ private:
    */
   void Push(const Node &node, const Node &parent,
             const AStarPriorityValue &edge_value) noexcept {
-    // Try to find the given node n in the node_value_map
-    const auto [it, inserted] = node_values.try_emplace(node, edge_value);
-    if (inserted) {
+    unsigned i = Find(node);
+    if (i == NO_ENTRY) {
       // first entry
       // If the node wasn't found
-      // -> Insert a new node into the node_value_map
-
-      // Remember the parent node
-      SetPredecessor(node, parent);
-    } else if (it->second > edge_value) {
+      // -> Insert a new node into the arena
+      i = entries.size();
+      entries.push_back({node, parent, edge_value});
+
+      // keep the load factor of the hash table at or below 50%
+      if (slots.size() < 2 * entries.size())
+        Rehash(std::max<std::size_t>(DEFAULT_QUEUE_SIZE, 2 * slots.size()));
+      else
+        InsertSlot(node, i);
+    } else if (entries[i].value > edge_value) {
       // If the node was found and the new value is smaller
-      // -> Replace the value with the new one
-      it->second = edge_value;
-      // replace, it's bigger
-
-      // Remember the new parent node
-      SetPredecessor(node, parent);
+      // -> Replace the value and the parent with the new one
+      entries[i].value = edge_value;
+      entries[i].parent = parent;
     } else
       // If the node was found but the value is higher or equal
       // -> Don't use this new leg
       return;
 
-    q.push(NodeValue(edge_value, it));
-  }
-
-  void SetPredecessor(const Node &node, const Node &parent) noexcept {
-    // Try to find the given node in the node_parent_map
-    auto result = node_parents.try_emplace(node, parent);
-    if (!result.second)
-      // If the node was found
-      // -> Replace the according parent node with the new one
-      result.first->second = parent;
+    q.push(edge_value.f(), NodeValue{edge_value, i});
   }
 };
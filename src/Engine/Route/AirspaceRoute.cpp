@@ -203,6 +203,8 @@ AirspaceRoute::Synchronise(const Airspaces &master,
                                      predicate)) {
     if (!m_airspaces.IsEmpty())
       dirty = true;
+
+    InvalidateSearch();
   }
 }
 
@@ -8,6 +8,10 @@
 #include "ReachFanParms.hpp"
 #include "util/GlobalSliceAllocator.hxx"
 #include "Geo/Flat/FlatProjection.hpp"
+#include "thread/WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <array>
 
 #define REACH_SWEEP (ROUTEPOLAR_Q1-BUFFER)
 
@@ -38,6 +42,24 @@ FlatTriangleFanTree::CalcBoundingBox() noexcept
   return bb_children;
 }
 
+/**
+ * One gap of a fan which shall be checked for a child fan.
+ */
+struct FlatTriangleFanTree::GapJob {
+  FlatTriangleFanTree *node;
+  RouteLink e_1, e_2;
+
+  /**
+   * The child which was found; only valid if #found is set.
+   */
+  FlatTriangleFan child;
+  bool found;
+
+  GapJob(FlatTriangleFanTree &_node,
+         const RouteLink &_e_1, const RouteLink &_e_2) noexcept
+    :node(&_node), e_1(_e_1), e_2(_e_2), found(false) {}
+};
+
 void
 FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin,
                                ReachFanParms &parms) noexcept
@@ -46,9 +68,14 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin,
 
   FillReach(origin, 0, ROUTEPOLAR_POINTS, parms);
 
+  /* one scratch fan per worker thread, reused for all gap checks */
+  std::vector<FlatTriangleFanTree> scratch(parms.pool != nullptr
+                                           ? parms.pool->GetWorkerCount()
+                                           : 1);
+
   for (parms.set_depth = 0; parms.set_depth < MAX_DEPTH;
       ++parms.set_depth)
-    if (!FillDepth(origin, parms))
+    if (!FillDepth(origin, parms, scratch))
       // stop searching
       break;
 
@@ -65,26 +92,88 @@ FlatTriangleFanTree::DummyReach(const AFlatGeoPoint &ao) noexcept
   CalcBoundingBox();
 }
 
+void
+FlatTriangleFanTree::CollectDepth(unsigned _depth,
+                                  std::vector<FlatTriangleFanTree *> &nodes) noexcept
+{
+  if (depth == _depth)
+    nodes.push_back(this);
+  else if (depth < _depth)
+    for (auto &child : children)
+      child.CollectDepth(_depth, nodes);
+}
+
 bool
 FlatTriangleFanTree::FillDepth(const AFlatGeoPoint &origin,
-                               ReachFanParms &parms) noexcept
+                               ReachFanParms &parms,
+                               std::span<FlatTriangleFanTree> scratch) noexcept
 {
-  if (depth == parms.set_depth) {
-    if (gaps_filled)
-      return true;
-    gaps_filled = true;
+  std::vector<FlatTriangleFanTree *> nodes;
+  CollectDepth(parms.set_depth, nodes);
+
+  /* without a pool, each node is checked against the limits before
+     its gaps are scanned; with a pool, a few nodes are scanned at a
+     time, which may waste some work on nodes beyond the limits */
+  const std::size_t chunk_size = parms.pool != nullptr
+    ? 4 * parms.pool->GetWorkerCount()
+    : 1;
+
+  std::vector<GapJob> jobs;
+
+  for (std::size_t chunk = 0; chunk < nodes.size(); chunk += chunk_size) {
+    const auto chunk_nodes =
+      std::span{nodes}.subspan(chunk, std::min(chunk_size,
+                                               nodes.size() - chunk));
+
+    jobs.clear();
+    if (parms.vertex_counter <= MAX_VERTICES &&
+        parms.fan_counter <= MAX_FANS)
+      for (auto *node : chunk_nodes)
+        if (!node->gaps_filled)
+          node->CollectGaps(origin, parms, jobs);
+
+    const auto check = [&jobs, &origin, &parms, scratch](std::size_t i,
+                                                         unsigned worker){
+      GapJob &job = jobs[i];
+      FlatTriangleFanTree &s = scratch[worker];
+      if (job.node->CheckGap(origin, job.e_1, job.e_2, parms, s)) {
+        job.child = s.fan;
+        job.found = true;
+      }
+    };
+
+    if (parms.pool != nullptr)
+      parms.pool->Run(jobs.size(), check);
+    else
+      for (std::size_t i = 0; i < jobs.size(); ++i)
+        check(i, 0);
+
+    /* merge the results in depth-first order */
+    auto job = jobs.begin();
+    for (auto *node : chunk_nodes) {
+      if (node->gaps_filled)
+        continue;
+      node->gaps_filled = true;
 
-    if (parms.vertex_counter > MAX_VERTICES)
-      return false;
-    if (parms.fan_counter > MAX_FANS)
-      return false;
+      if (parms.vertex_counter > MAX_VERTICES)
+        return false;
+      if (parms.fan_counter > MAX_FANS)
+        return false;
 
-    FillGaps(origin, parms);
-  } else if (depth < parms.set_depth) {
-    for (auto &child : children)
-      if (!child.FillDepth(origin, parms))
-        return false; // stop searching
+      for (; job != jobs.end() && job->node == node; ++job) {
+        if (!job->found)
+          continue;
+
+        parms.vertex_counter += job->child.GetVertices().size();
+        parms.fan_counter++;
+
+        FlatTriangleFanTree &child =
+          node->children.emplace_front(node->depth + 1);
+        child.fan = std::move(job->child);
+      }
+    }
   }
+
   return true;
 }
 
@@ -106,7 +195,8 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin, const int index_low,
   }
 
   fan.AddOrigin(origin, index_high - index_low);
-  for (int index = index_low; index < index_high; ++index) {
+
+  const auto intercept = [&origin, &geo_origin, &parms](int index){
     FlatGeoPoint x = parms.ReachIntercept(index, origin, geo_origin);
     /* if ReachIntercept() did not find anything reasonable it returns
        a FlatGeoPoint that is almost the same as origin, but differs
@@ -114,16 +204,35 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin, const int index_low,
        overlapping edges causing triangulation failures. */
     if (AlmostTheSame(origin, x))
       x = origin;
-
-    fan.AddPoint(x);
+    return x;
+  };
+
+  if (IsRoot() && parms.pool != nullptr) {
+    /* the root fan is the only one which is not filled inside a
+       pool job, so its terrain intersections are calculated in
+       parallel here */
+    std::array<FlatGeoPoint, ROUTEPOLAR_POINTS> points;
+    assert(std::size_t(index_high - index_low) <= points.size());
+
+    parms.pool->Run(index_high - index_low,
+                    [&points, &intercept, index_low](std::size_t i, unsigned){
+                      points[i] = intercept(index_low + i);
+                    });
+
+    for (int i = 0; i < index_high - index_low; ++i)
+      fan.AddPoint(points[i]);
+  } else {
+    for (int index = index_low; index < index_high; ++index)
+      fan.AddPoint(intercept(index));
   }
 
   return fan.CommitPoints(IsRoot());
 }
 
 void
-FlatTriangleFanTree::FillGaps(const AFlatGeoPoint &origin,
-                              ReachFanParms &parms) noexcept
+FlatTriangleFanTree::CollectGaps(const AFlatGeoPoint &origin,
+                                 const ReachFanParms &parms,
+                                 std::vector<GapJob> &jobs) noexcept
 {
   // worth checking for gaps?
   if (const auto vertices = fan.GetVertices();
@@ -139,7 +248,7 @@ FlatTriangleFanTree::FillGaps(const AFlatGeoPoint &origin,
 
       const RouteLink e(RoutePoint(*x, 0), origin, parms.projection);
       // check if children need to be added
-      CheckGap(origin, e_last, e, parms);
+      jobs.emplace_back(*this, e_last, e);
 
       e_last = e;
     }
@@ -176,7 +285,8 @@ FlatTriangleFanTree::UpdateTerrainBase(const FlatGeoPoint o,
 bool
 FlatTriangleFanTree::CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
                               const RouteLink &e_2,
-                              ReachFanParms &parms) noexcept
+                              const ReachFanParms &parms,
+                              FlatTriangleFanTree &scratch) const noexcept
 {
   const bool side = (e_1.d > e_2.d);
   const RouteLink &e_long = (side ? e_1 : e_2);
@@ -186,9 +296,6 @@ FlatTriangleFanTree::CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
 
   const FlatGeoPoint &p_long = e_long.first;
 
-  // return true if this gap was caught (applicable) whether or not it generated
-  // a change
-
   const auto f0 = e_short.d * e_long.inv_d;
   const int h_loss =
     parms.rpolars.CalcGlideArrival(n, p_long, parms.projection) - n.altitude;
@@ -214,13 +321,10 @@ FlatTriangleFanTree::CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
     // altitude calculated from pure glide from n to x
     const AFlatGeoPoint x(px, h);
 
-    FlatTriangleFanTree child(depth + 1);
-    if (child.FillReach(x, index_left, index_right, parms)) {
-      parms.vertex_counter += child.fan.GetVertices().size();
-      parms.fan_counter++;
-      children.emplace_front(std::move(child));
+    scratch.fan.Clear();
+    scratch.depth = depth + 1;
+    if (scratch.FillReach(x, index_left, index_right, parms))
       return true;
-    }
   }
 
   return false;
@@ -268,6 +372,67 @@ FlatTriangleFanTree::FindPositiveArrival(const FlatGeoPoint n,
   return retval;
 }
 
+void
+FlatTriangleFanTree::FindPositiveArrivals(ArrivalQueryVector &queries,
+                                          std::size_t begin, std::size_t end,
+                                          const ReachFanParms &parms) const noexcept
+{
+  /* the queries are sorted by x, which allows skipping those which
+     are left or right of the bounding box with a binary search */
+  const auto first =
+    std::lower_bound(queries.begin() + begin, queries.begin() + end,
+                     bb_children.GetLeft(),
+                     [](const ArrivalQuery *q, int x){
+                       return q->location.x < x;
+                     });
+  const auto last =
+    std::upper_bound(first, queries.begin() + end,
+                     bb_children.GetRight(),
+                     [](int x, const ArrivalQuery *q){
+                       return x < q->location.x;
+                     });
+
+  begin = std::distance(queries.begin(), first);
+  end = std::distance(queries.begin(), last);
+
+  /* the queries which are not inside this fan are appended to the
+     vector (preserving the sort order) and passed to the children */
+  const std::size_t children_begin = queries.size();
+
+  for (std::size_t i = begin; i < end; ++i) {
+    ArrivalQuery &q = *queries[i];
+
+    if (GetHeight() < q.arrival_height)
+      continue; // can't possibly improve
+
+    if (!bb_children.IsInside(q.location))
+      continue; // not in scope
+
+    if (fan.IsInside(q.location, IsRoot())) {
+      const int h = parms.rpolars.CalcGlideArrival(fan.GetOrigin(),
+                                                   q.location,
+                                                   parms.projection);
+      if (h > q.arrival_height) {
+        q.arrival_height = h;
+        q.found = true;
+      }
+
+      /* see FindPositiveArrival() */
+      continue;
+    }
+
+    queries.push_back(&q);
+  }
+
+  const std::size_t children_end = queries.size();
+  if (children_end > children_begin)
+    for (const auto &child : children)
+      child.FindPositiveArrivals(queries, children_begin, children_end,
+                                 parms);
+
+  queries.resize(children_begin);
+}
+
 void
 FlatTriangleFanTree::AcceptInRange(const FlatBoundingBox &bb,
                                    FlatTriangleFanVisitor &visitor) const noexcept
@@ -7,8 +7,11 @@
 #include "util/SliceAllocator.hxx"
 #include "FlatTriangleFan.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <forward_list>
+#include <span>
+#include <vector>
 
 class FlatProjection;
 struct GeoPoint;
@@ -16,6 +19,7 @@ struct RouteLink;
 struct AFlatGeoPoint;
 struct ReachFanParms;
 class FlatTriangleFanVisitor;
+class WorkStealingPool;
 
 class FlatTriangleFanTree
 {
@@ -28,6 +32,31 @@ public:
   static constexpr unsigned MIN_STEP = 25;
   static constexpr unsigned MAX_FANS = 300;
 
+  /**
+   * One destination of a batch FindPositiveArrivals() call.
+   */
+  struct ArrivalQuery {
+    FlatGeoPoint location;
+
+    /**
+     * The best arrival height found so far.  Initialise with the
+     * minimum acceptable height minus one.
+     */
+    int arrival_height;
+
+    /**
+     * The caller's index of this destination.
+     */
+    std::size_t index;
+
+    /**
+     * Set to true if #arrival_height has been improved.
+     */
+    bool found;
+  };
+
+  using ArrivalQueryVector = std::vector<ArrivalQuery *>;
+
 private:
   FlatTriangleFan fan;
 
@@ -83,6 +112,17 @@ public:
                            const ReachFanParms &parms,
                            int &arrival_height) const noexcept;
 
+  /**
+   * Batch version of FindPositiveArrival(): resolve all queries in
+   * the range [begin, end) of #queries with one walk of the tree.
+   * The range must be sorted by FlatGeoPoint::x; the method appends
+   * temporary items to the vector, but restores its original size
+   * before returning.
+   */
+  void FindPositiveArrivals(ArrivalQueryVector &queries,
+                            std::size_t begin, std::size_t end,
+                            const ReachFanParms &parms) const noexcept;
+
   void AcceptInRange(const FlatBoundingBox &bb,
                      FlatTriangleFanVisitor &visitor) const noexcept;
 
@@ -107,9 +147,39 @@ private:
                  const int index_low, const int index_high,
                  const ReachFanParms &parms) noexcept;
 
-  bool FillDepth(const AFlatGeoPoint &origin, ReachFanParms &parms) noexcept;
-  void FillGaps(const AFlatGeoPoint &origin, ReachFanParms &parms) noexcept;
+  /**
+   * Collect all nodes with the given depth, in depth-first order.
+   */
+  void CollectDepth(unsigned _depth,
+                    std::vector<FlatTriangleFanTree *> &nodes) noexcept;
+
+  /**
+   * Fill the gaps of all nodes at depth #ReachFanParms::set_depth.
+   *
+   * The gaps are independent of each other, so they are scanned in
+   * parallel if #ReachFanParms::pool is set.  The resulting children
+   * are merged (and the #MAX_VERTICES / #MAX_FANS limits are
+   * applied) in depth-first order, which makes the result identical
+   * to a serial scan.
+   *
+   * @return false to stop searching
+   */
+  bool FillDepth(const AFlatGeoPoint &origin, ReachFanParms &parms,
+                 std::span<FlatTriangleFanTree> scratch) noexcept;
 
+  struct GapJob;
+
+  void CollectGaps(const AFlatGeoPoint &origin, const ReachFanParms &parms,
+                   std::vector<GapJob> &jobs) noexcept;
+
+  /**
+   * Attempt to find a child fan which covers the gap between the two
+   * links.
+   *
+   * @param scratch a buffer owned by the calling thread
+   * @return true if a child was found (returned in #scratch)
+   */
   bool CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
-                const RouteLink &e_2, ReachFanParms &parms) noexcept;
+                const RouteLink &e_2, const ReachFanParms &parms,
+                FlatTriangleFanTree &scratch) const noexcept;
 };
@@ -6,6 +6,9 @@
 #include "ReachFanParms.hpp"
 #include "ReachResult.hpp"
 
+#include <algorithm>
+#include <cassert>
+
 static constexpr int MIN_FLOOR_CLEARANCE = 100;
 
 void
@@ -17,7 +20,8 @@ ReachFan::Reset() noexcept
 
 bool
 ReachFan::Solve(const AGeoPoint origin, const RoutePolars &rpolars,
-                const RasterMap* terrain, const bool do_solve) noexcept
+                const RasterMap* terrain, const bool do_solve,
+                WorkStealingPool *pool) noexcept
 {
   Reset();
 
@@ -30,6 +34,7 @@ ReachFan::Solve(const AGeoPoint origin, const RoutePolars &rpolars,
   const int h2 = h.GetValueOr0();
 
   ReachFanParms parms(rpolars, projection, terrain_base, terrain);
+  parms.pool = pool;
   const AFlatGeoPoint ao(projection.ProjectInteger(origin), origin.altitude);
 
   // immediate exit if starting below terrain, or starting below floor
@@ -98,6 +103,73 @@ ReachFan::FindPositiveArrival(const AGeoPoint dest,
   return result_r;
 }
 
+bool
+ReachFan::FindPositiveArrivals(std::span<const AGeoPoint> dests,
+                               std::span<ReachResult> results,
+                               const RoutePolars &rpolars) const noexcept
+{
+  assert(dests.size() == results.size());
+
+  if (root.IsEmpty())
+    return false;
+
+  const ReachFanParms parms(rpolars, projection, terrain_base);
+  const bool dummy = root.IsDummy();
+
+  std::vector<FlatTriangleFanTree::ArrivalQuery> queries;
+  if (!dummy)
+    queries.reserve(dests.size());
+
+  for (std::size_t i = 0; i < dests.size(); ++i) {
+    const AGeoPoint &dest = dests[i];
+    ReachResult &result = results[i];
+    const FlatGeoPoint d(projection.ProjectInteger(dest));
+
+    // see FindPositiveArrival()
+    result.Clear();
+    result.direct = root.DirectArrival(d, parms);
+
+    if (dummy)
+      continue;
+
+    if (std::min(root.GetHeight(), result.direct) < dest.altitude) {
+      result.terrain = result.direct;
+      result.terrain_valid = ReachResult::Validity::UNREACHABLE;
+      continue;
+    }
+
+    queries.push_back({d, int(dest.altitude - 1), i, false});
+  }
+
+  if (queries.empty())
+    return true;
+
+  /* sort by location, so the tree walk can skip destinations outside
+     each fan's bounding box quickly */
+  FlatTriangleFanTree::ArrivalQueryVector sorted;
+  sorted.reserve(queries.size() * 2);
+  for (auto &q : queries)
+    sorted.push_back(&q);
+
+  std::sort(sorted.begin(), sorted.end(), [](const auto *a, const auto *b){
+    return a->location.x != b->location.x
+      ? a->location.x < b->location.x
+      : a->location.y < b->location.y;
+  });
+
+  root.FindPositiveArrivals(sorted, 0, sorted.size(), parms);
+
+  for (const auto &q : queries) {
+    ReachResult &result = results[q.index];
+    result.terrain = q.arrival_height;
+    result.terrain_valid = q.found
+      ? ReachResult::Validity::VALID
+      : ReachResult::Validity::UNREACHABLE;
+  }
+
+  return true;
+}
+
 void
 ReachFan::AcceptInRange(const GeoBounds &bounds,
                         FlatTriangleFanVisitor &visitor) const noexcept
@@ -7,10 +7,12 @@
 #include "FlatTriangleFanTree.hpp"
 
 #include <optional>
+#include <span>
 
 class RoutePolars;
 class RasterMap;
 class GeoBounds;
+class WorkStealingPool;
 struct ReachResult;
 
 class ReachFan
@@ -32,8 +34,14 @@ public:
 
   void Reset() noexcept;
 
+  /**
+   * @param pool if not nullptr, then the terrain intersections are
+   * calculated in parallel on this pool; the result is the same as
+   * without a pool
+   */
   bool Solve(const AGeoPoint origin, const RoutePolars &rpolars,
-             const RasterMap *terrain, const bool do_solve = true) noexcept;
+             const RasterMap *terrain, const bool do_solve = true,
+             WorkStealingPool *pool = nullptr) noexcept;
 
   /**
    * Find arrival height at destination.
@@ -50,6 +58,22 @@ public:
   std::optional<ReachResult> FindPositiveArrival(const AGeoPoint dest,
                                                  const RoutePolars &rpolars) const noexcept;
 
+  /**
+   * Batch version of FindPositiveArrival().  The destinations are
+   * sorted spatially and resolved with a single walk of the fan
+   * tree.
+   *
+   * @param dests the destinations
+   * @param results the results for each destination (same size as
+   * #dests)
+   *
+   * @return false if no reach has been calculated (#results is
+   * undefined then)
+   */
+  bool FindPositiveArrivals(std::span<const AGeoPoint> dests,
+                            std::span<ReachResult> results,
+                            const RoutePolars &rpolars) const noexcept;
+
   /** Visit reach (working or terrain reach) */
   void AcceptInRange(const GeoBounds &bounds,
                      FlatTriangleFanVisitor &visitor) const noexcept;
@@ -7,11 +7,19 @@
 
 class FlatProjection;
 class RasterMap;
+class WorkStealingPool;
 
 struct ReachFanParms {
   const RoutePolars &rpolars;
   const FlatProjection &projection;
   const RasterMap *terrain;
+
+  /**
+   * If set, then the fan tree is constructed in parallel using this
+   * pool.
+   */
+  WorkStealingPool *pool = nullptr;
+
   int terrain_base;
   unsigned terrain_counter = 0;
   unsigned fan_counter = 0;
@@ -5,11 +5,33 @@
 #include "ReachResult.hpp"
 #include "Geo/Flat/FlatProjection.hpp"
 
+#include <optional>
+
 RoutePlanner::RoutePlanner() noexcept
 {
   Reset();
 }
 
+/**
+ * The retained search is only repaired if the destination has moved
+ * by less than this fraction (1/n) of the distance between origin and
+ * destination since the last full search.
+ */
+static constexpr unsigned REPAIR_DISTANCE_DIVISOR = 8;
+
+/**
+ * The retained search is only repaired if the cruise altitude and
+ * ceiling have dropped by no more than this (m); they must not rise.
+ */
+static constexpr int REPAIR_MAX_ALTITUDE_DROP = 50;
+
+[[gnu::const]]
+static bool
+IsSmallDrop(int value, int retained) noexcept
+{
+  return value <= retained && value >= retained - REPAIR_MAX_ALTITUDE_DROP;
+}
+
 void
 RoutePlanner::Reset() noexcept
 {
@@ -19,18 +41,68 @@ RoutePlanner::Reset() noexcept
   solution_route.clear();
   planner.Clear();
   unique_links.clear();
+  search_retained = false;
   h_min = -1;
   h_max = 0;
   search_hull.clear();
 }
 
+void
+RoutePlanner::InvalidateSearch() noexcept
+{
+  if (!search_retained)
+    return;
+
+  search_retained = false;
+  planner.Clear();
+  unique_links.clear();
+}
+
+bool
+RoutePlanner::CanRepair(const AGeoPoint &origin,
+                        const AGeoPoint &destination,
+                        const RoutePlannerConfig &config,
+                        const int cruise_altitude,
+                        const int h_ceiling) const noexcept
+{
+  if (!(config == rpolars_route.GetConfig()) ||
+      GetObstacleSerial() != retained_obstacle_serial)
+    return false;
+
+  /* the search is continued with the retained cruise altitude and
+     ceiling; tolerate a small descent, but no climb, which would
+     allow routes the retained search has rejected */
+  if (!IsSmallDrop(cruise_altitude, retained_cruise_altitude) ||
+      !IsSmallDrop(h_ceiling, retained_ceiling))
+    return false;
+
+  const AFlatGeoPoint s_origin(projection.ProjectInteger(origin),
+                               origin.altitude);
+  if (!(s_origin == origin_last))
+    return false;
+
+  const FlatGeoPoint s_destination = projection.ProjectInteger(destination);
+  return s_destination.Distance(retained_destination) * REPAIR_DISTANCE_DIVISOR
+    <= origin_last.Distance(retained_destination);
+}
+
 bool
 RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
                     const RoutePlannerConfig &config, const int h_ceiling) noexcept
 {
-  OnSolve(origin, destination);
-  rpolars_route.SetConfig(config, std::max(destination.altitude, origin.altitude),
-                          h_ceiling);
+  const int cruise_altitude = std::max(destination.altitude, origin.altitude);
+
+  const bool repair = search_retained &&
+    CanRepair(origin, destination, config, cruise_altitude, h_ceiling);
+  if (repair) {
+    // keep the projection and environment of the retained search
+    rpolars_route.SetConfig(config, retained_cruise_altitude,
+                            retained_ceiling);
+  } else {
+    InvalidateSearch();
+    OnSolve(origin, destination);
+    rpolars_route.SetConfig(config, cruise_altitude, h_ceiling);
+  }
 
   {
     const AFlatGeoPoint s_origin(projection.ProjectInteger(origin),
@@ -60,25 +132,119 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
   if (!rpolars_route.IsTerrainEnabled() && !rpolars_route.IsAirspaceEnabled())
     return false; // trivial
 
-  search_hull.clear();
-  search_hull.emplace_back(origin_last, projection);
-
-  RoutePoint start = origin_last;
+  const RoutePoint previous_goal = astar_goal;
   astar_goal = destination_last;
 
-  RouteLink e_test(start, astar_goal, projection);
-  if (e_test.IsShort())
-    return false;
-  if (!rpolars_route.IsAchievable(e_test))
+  RouteLink e_test(origin_last, astar_goal, projection);
+  if (e_test.IsShort() || !rpolars_route.IsAchievable(e_test)) {
+    InvalidateSearch();
     return false;
+  }
+
+  stats = {};
 
   bool retval = false;
-  planner.Restart(start);
+  if (repair) {
+    RekeySearch(previous_goal);
+    retval = stats.repaired = Search();
+
+    if (!retval) {
+      /* the retained search was a dead end; start afresh in its
+         projection, which differs from a new one by less than one
+         unit */
+      rpolars_route.SetConfig(config, cruise_altitude, h_ceiling);
+      h_max = std::max(h_max, rpolars_route.cruise_altitude);
+    }
+  }
+
+  if (!retval) {
+    StartSearch();
+    retval = Search();
+  }
+
+  if (retval) {
+    // correct solution for rounding
+    assert(solution_route.size()>=2);
+    for (auto &i : solution_route) {
+      FlatGeoPoint p(projection.ProjectInteger(i));
+      if (p == origin_last) {
+        i = AGeoPoint(origin, i.altitude);
+      } else if (p == destination_last) {
+        i = AGeoPoint(destination, i.altitude);
+      }
+    }
+
+  } else {
+    solution_route.clear();
+    solution_route.push_back(origin);
+    solution_route.push_back(destination);
+  }
 
+  if (retval && incremental) {
+    if (!stats.repaired) {
+      retained_cruise_altitude = cruise_altitude;
+      retained_ceiling = h_ceiling;
+      retained_destination = destination_last;
+      retained_obstacle_serial = GetObstacleSerial();
+    }
+
+    search_retained = true;
+  } else {
+    search_retained = false;
+    planner.Clear();
+    unique_links.clear();
+  }
+
+  // m_search_hull.clear();
+  return retval;
+}
+
+void
+RoutePlanner::StartSearch() noexcept
+{
+  unique_links.clear();
+  search_hull.clear();
+  search_hull.emplace_back(origin_last, projection);
+  planner.Restart(origin_last);
+}
+
+void
+RoutePlanner::RekeySearch(const RoutePoint &previous_goal) noexcept
+{
+  /* links to the goal must be tested again, because the goal
+     altitude may have changed */
+  std::erase_if(unique_links, [this](const RouteLinkBase &l){
+    return (FlatGeoPoint)l.second == (FlatGeoPoint)astar_goal;
+  });
+
+  planner.Rekey([this, &previous_goal](const RoutePoint &node)
+                -> std::optional<unsigned> {
+    if (node == previous_goal && !(node == astar_goal))
+      /* the previous goal is not a turn point, and its value
+         includes the rounding applied to final links */
+      return std::nullopt;
+
+    const RouteLink e_rem(node, astar_goal, projection);
+    if (!rpolars_route.IsAchievable(e_rem))
+      return std::nullopt;
+
+    const unsigned h = rpolars_route.CalcTime(e_rem);
+    if (h == UINT_MAX)
+      return std::nullopt;
+
+    return RoutePolars::RoundTime(h);
+  });
+}
+
+bool
+RoutePlanner::Search() noexcept
+{
+  bool retval = false;
   unsigned best_d = UINT_MAX;
 
   while (!planner.IsEmpty()) {
     const RoutePoint node = planner.Pop();
+    ++stats.expansions;
 
     h_min = std::min(h_min, node.altitude);
     h_max = std::max(h_max, node.altitude);
@@ -115,27 +281,6 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
 
   }
 
-  if (retval) {
-    // correct solution for rounding
-    assert(solution_route.size()>=2);
-    for (auto &i : solution_route) {
-      FlatGeoPoint p(projection.ProjectInteger(i));
-      if (p == origin_last) {
-        i = AGeoPoint(origin, i.altitude);
-      } else if (p == destination_last) {
-        i = AGeoPoint(destination, i.altitude);
-      }
-    }
-
-  } else {
-    solution_route.clear();
-    solution_route.push_back(origin);
-    solution_route.push_back(destination);
-  }
-
-  planner.Clear();
-  unique_links.clear();
-  // m_search_hull.clear();
   return retval;
 }
 
@@ -314,8 +459,13 @@ RoutePlanner::UpdatePolar(const GlideSettings &settings,
                           const GlidePolar &task_polar,
                           const SpeedVector &wind) noexcept
 {
+  const RoutePolars previous = rpolars_route;
+
   rpolars_route.SetConfig(config);
   rpolars_route.Initialise(settings, task_polar, wind);
+
+  if (!rpolars_route.IsEquivalent(previous))
+    InvalidateSearch();
 }
 
 void
@@ -9,7 +9,9 @@
 #include "AStar.hpp"
 #include "Geo/Flat/FlatProjection.hpp"
 #include "Geo/SearchPointVector.hpp"
+#include "util/Serial.hpp"
 
+#include <queue>
 #include <utility>
 #include <unordered_set>
 
@@ -44,7 +46,10 @@ class GlidePolar;
  * which is unrealistic.
  *
  * Replanning is not performed when the origin/destination or other properties
- * have not changed.
+ * have not changed.  In incremental mode (see SetIncremental()), the
+ * search state is kept after a successful solution; when only the
+ * destination (the aircraft) has moved a little, the next Solve() call
+ * continues that search instead of starting from scratch.
  *
  * Failures of the solver result in the route reverting to direct flight from
  * origin to destination.
@@ -77,6 +82,18 @@ class RoutePlanner {
     }
   };
 
+public:
+  /**
+   * Statistics about the last Solve() call.
+   */
+  struct SolveStats {
+    /** Number of nodes taken from the A* queue */
+    unsigned expansions = 0;
+
+    /** Was the retained search continued? */
+    bool repaired = false;
+  };
+
 protected:
   typedef std::pair<AFlatGeoPoint, AFlatGeoPoint> ClearingPair;
 
@@ -118,6 +135,26 @@ private:
   /** Destination at last call to solve() */
   AFlatGeoPoint destination_last;
 
+  /** Keep the search state for incremental solutions? */
+  bool incremental = false;
+
+  /**
+   * Does #planner (with #unique_links and #search_hull) still hold
+   * the state of the last successful search?
+   */
+  bool search_retained = false;
+
+  /** Cruise altitude of the retained search (m) */
+  int retained_cruise_altitude;
+  /** Ceiling of the retained search (m) */
+  int retained_ceiling;
+  /** Destination of the last full search */
+  FlatGeoPoint retained_destination;
+  /** GetObstacleSerial() at the time of the retained search */
+  Serial retained_obstacle_serial;
+
+  SolveStats stats;
+
 protected:
   RoutePoint astar_goal;
 
@@ -147,6 +184,25 @@ public:
              const RoutePlannerConfig &config,
              int h_ceiling = INT_MAX) noexcept;
 
+  /**
+   * Enable or disable incremental mode.  When enabled, a Solve() call
+   * whose origin, obstacles and performance model are unchanged, and
+   * whose destination has moved only a little, repairs the previous
+   * search instead of starting a new one.  This is cheaper, but the
+   * result may differ slightly from a full solution, because the
+   * search is continued with the previous cruise altitude and
+   * ceiling.  If the repair fails, a full solution is attempted.
+   */
+  void SetIncremental(bool _incremental) noexcept {
+    incremental = _incremental;
+    if (!incremental)
+      InvalidateSearch();
+  }
+
+  const SolveStats &GetSolveStats() const noexcept {
+    return stats;
+  }
+
   /**
    * Retrieve current solution.  If solver failed previously,
    * direct flight from origin to destination is produced.
@@ -258,6 +314,21 @@ protected:
   virtual void OnSolve(const AGeoPoint &origin,
                        const AGeoPoint &destination) noexcept;
 
+  /**
+   * Returns a serial which changes whenever the obstacles known to
+   * the subclass change; the retained search is discarded then.
+   */
+  [[gnu::pure]]
+  virtual Serial GetObstacleSerial() const noexcept {
+    return {};
+  }
+
+  /**
+   * Discard the retained search, e.g. because the obstacles have
+   * changed.
+   */
+  void InvalidateSearch() noexcept;
+
 private:
   /**
    * For a link known to not clear obstacles, generate whatever candidate edges
@@ -280,6 +351,34 @@ protected:
   bool IsHullExtended(const RoutePoint &p) noexcept;
 
 private:
+  /**
+   * Check whether the retained search may be continued for the given
+   * parameters.  Must be called before OnSolve(), because the retained
+   * search is only valid in its own projection.
+   */
+  [[gnu::pure]]
+  bool CanRepair(const AGeoPoint &origin, const AGeoPoint &destination,
+                 const RoutePlannerConfig &config,
+                 int cruise_altitude, int h_ceiling) const noexcept;
+
+  /**
+   * Start a new search from #origin_last.
+   */
+  void StartSearch() noexcept;
+
+  /**
+   * Prepare the retained search for continuing towards the new
+   * #astar_goal.
+   */
+  void RekeySearch(const RoutePoint &previous_goal) noexcept;
+
+  /**
+   * Run the A* search towards #astar_goal.
+   *
+   * @return True if a solution was found (stored in #solution_route)
+   */
+  bool Search() noexcept;
+
   /**
    * Backtrack solution from A* internal structure to construct a
    * Route.
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+
 class Angle;
 class GlidePolar;
 struct GlideSettings;
@@ -48,6 +51,13 @@ class RoutePolar
       else
         inv_gradient = 0;
     };
+
+    constexpr bool operator==(const RoutePolarPoint &other) const noexcept {
+      /* the other attributes of invalid points are undefined */
+      return valid == other.valid &&
+        (!valid || (slowness == other.slowness &&
+                    gradient == other.gradient));
+    }
   };
 
   RoutePolarPoint points[ROUTEPOLAR_POINTS];
@@ -86,6 +96,12 @@ public:
   [[gnu::const]]
   static FlatGeoPoint IndexToDXDY(int index);
 
+  [[gnu::pure]]
+  bool operator==(const RoutePolar &other) const noexcept {
+    return std::equal(std::begin(points), std::end(points),
+                      std::begin(other.points));
+  }
+
 private:
   GlideResult SolveTask(const GlideSettings &settings, const GlidePolar& polar,
                         const SpeedVector &wind,
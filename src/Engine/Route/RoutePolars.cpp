@@ -185,6 +185,16 @@ RoutePolars::SetConfig(const RoutePlannerConfig& _config,
     climb_ceiling = INT_MAX;
 }
 
+bool
+RoutePolars::IsEquivalent(const RoutePolars &other) const noexcept
+{
+  return polar_glide == other.polar_glide &&
+    polar_cruise == other.polar_cruise &&
+    inv_mc == other.inv_mc &&
+    height_min_working == other.height_min_working &&
+    config == other.config;
+}
+
 bool
 RoutePolars::CanClimb() const noexcept
 {
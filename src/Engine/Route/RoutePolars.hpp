@@ -168,6 +168,18 @@ public:
                  int _cruise_alt = INT_MAX,
                  int _ceiling_alt = INT_MAX) noexcept;
 
+  const RoutePlannerConfig &GetConfig() const noexcept {
+    return config;
+  }
+
+  /**
+   * Check whether the other object describes the same performance
+   * model and configuration.  The cruise altitude and the ceiling are
+   * not compared.
+   */
+  [[gnu::pure]]
+  bool IsEquivalent(const RoutePolars &other) const noexcept;
+
   /**
    * Check whether the configuration requires intersection tests with airspace.
    *
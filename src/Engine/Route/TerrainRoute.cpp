@@ -43,7 +43,7 @@ TerrainRoute::SolveReach(const AGeoPoint &origin,
   rpolars.SetConfig(config, origin.altitude, h_ceiling);
 
   ReachFan reach;
-  reach.Solve(origin, rpolars, terrain, do_solve);
+  reach.Solve(origin, rpolars, terrain, do_solve, reach_pool);
   return reach;
 }
 
@@ -69,6 +69,14 @@ TerrainRoute::Intersection(const AGeoPoint &origin,
   return rpolars_route.Intersection(origin, destination, terrain, proj);
 }
 
+Serial
+TerrainRoute::GetObstacleSerial() const noexcept
+{
+  /* the terrain tiles get loaded while the aircraft moves, and the
+     intersection tests of the retained search may be outdated then */
+  return terrain != nullptr ? terrain->GetSerial() : Serial{};
+}
+
 bool
 TerrainRoute::IsClear(const RouteLink &e) const noexcept
 {
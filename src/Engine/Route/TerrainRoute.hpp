@@ -6,6 +6,7 @@
 #include "RoutePlanner.hpp"
 
 class ReachFan;
+class WorkStealingPool;
 
 /**
  * Specialization of #RoutePlanner which implements terrain avoidance.
@@ -27,6 +28,9 @@ class TerrainRoute: public RoutePlanner
 
   mutable RoutePoint m_inx_terrain;
 
+  /** Optional thread pool for SolveReach() */
+  WorkStealingPool *reach_pool = nullptr;
+
 public:
   friend class PrintHelper;
 
@@ -36,6 +40,15 @@ public:
    */
   void SetTerrain(const RasterMap *_terrain) noexcept {
     terrain = _terrain;
+    InvalidateSearch();
+  }
+
+  /**
+   * Use the given thread pool to construct reach fans in parallel.
+   * Pass nullptr to disable.
+   */
+  void SetReachPool(WorkStealingPool *_pool) noexcept {
+    reach_pool = _pool;
   }
 
   const auto &GetReachPolar() const noexcept {
@@ -79,6 +92,7 @@ public:
 protected:
   bool IsClear(const RouteLink &e) const noexcept override;
   void AddNearby(const RouteLink &e) noexcept override;
+  Serial GetObstacleSerial() const noexcept override;
 
   /**
    * Check a second category of obstacle clearance.  This allows compound
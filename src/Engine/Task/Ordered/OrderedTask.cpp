@@ -6,6 +6,7 @@
 #include "Points/OrderedTaskPoint.hpp"
 #include "Points/StartPoint.hpp"
 #include "Points/FinishPoint.hpp"
+#include "Points/AATPoint.hpp"
 #include "Task/Solvers/TaskMacCreadyTravelled.hpp"
 #include "Task/Solvers/TaskMacCreadyRemaining.hpp"
 #include "Task/Solvers/TaskMacCreadyTotal.hpp"
@@ -15,6 +16,7 @@
 #include "Task/Solvers/TaskMinTarget.hpp"
 #include "Task/Solvers/TaskGlideRequired.hpp"
 #include "Task/Solvers/TaskOptTarget.hpp"
+#include "Task/Ordered/AATIsolineSegment.hpp"
 #include "Task/Visitors/TaskPointVisitor.hpp"
 #include "Task/Factory/Create.hpp"
 #include "Task/Factory/AbstractTaskFactory.hpp"
@@ -596,7 +598,10 @@ OrderedTask::UpdateIdle(const AircraftState &state,
                   GetOrderedTaskSettings().aat_min_time + task_behaviour.optimise_targets_margin);
 
     if (task_behaviour.optimise_targets_bearing &&
-        task_points[active_task_point]->GetType() == TaskPointType::AAT) {
+        background_target_optimisation) {
+      RestoreOptimisedTargets(state);
+    } else if (task_behaviour.optimise_targets_bearing &&
+               task_points[active_task_point]->GetType() == TaskPointType::AAT) {
       TaskPointList tps(task_points);
       AATPoint *ap = (AATPoint *)task_points[active_task_point].get();
       // very nasty hack
@@ -611,6 +616,93 @@ OrderedTask::UpdateIdle(const AircraftState &state,
   return retval;
 }
 
+bool
+OrderedTask::OptimiseTargets(const AircraftState &state,
+                             const GlidePolar &glide_polar) noexcept
+{
+  /* the plan must be better by at least this much to be published */
+  static constexpr FloatDuration MIN_IMPROVEMENT = std::chrono::seconds{1};
+
+  if (!HasStart() || !stats.has_targets ||
+      !task_behaviour.optimise_targets_range ||
+      !task_behaviour.optimise_targets_bearing ||
+      GetOrderedTaskSettings().aat_min_time.count() <= 0 ||
+      !state.location.IsValid() ||
+      active_task_point >= task_points.size())
+    return false;
+
+  TaskPointList tps(task_points);
+  TaskMacCreadyRemaining tm(tps.begin(), tps.end(), active_task_point,
+                            task_behaviour.glide, glide_polar,
+                            /* ignore the travel to the start point */
+                            false);
+
+  taskpoint_start->ScanDistanceRemaining(state.location);
+  const GlideResult before = tm.glide_solution(state);
+  if (!before.IsOk())
+    return false;
+
+  tm.target_save();
+  std::vector<double> saved_parameters(task_points.size(), -1);
+
+  for (unsigned i = active_task_point; i < task_points.size(); ++i) {
+    if (task_points[i]->GetType() != TaskPointType::AAT)
+      continue;
+
+    AATPoint &ap = (AATPoint &)*task_points[i];
+    saved_parameters[i] = ap.GetIsolineParameter();
+
+    TaskOptTarget tot(tps, active_task_point, state,
+                      task_behaviour.glide, glide_polar,
+                      ap, task_projection, *taskpoint_start);
+    const double t = tot.search(saved_parameters[i] >= 0
+                                ? saved_parameters[i]
+                                : 0.5);
+    if (t >= 0)
+      ap.SetIsolineParameter(t);
+  }
+
+  taskpoint_start->ScanDistanceRemaining(state.location);
+  const GlideResult after = tm.glide_solution(state);
+  if (after.IsOk() &&
+      after.time_elapsed + MIN_IMPROVEMENT < before.time_elapsed)
+    return true;
+
+  /* no improvement: keep the current plan */
+  tm.target_restore();
+  for (unsigned i = active_task_point; i < task_points.size(); ++i)
+    if (task_points[i]->GetType() == TaskPointType::AAT)
+      ((AATPoint &)*task_points[i]).SetIsolineParameter(saved_parameters[i]);
+
+  taskpoint_start->ScanDistanceRemaining(state.location);
+  return false;
+}
+
+void
+OrderedTask::RestoreOptimisedTargets(const AircraftState &state) noexcept
+{
+  bool moved = false;
+
+  for (unsigned i = active_task_point; i < task_points.size(); ++i) {
+    if (task_points[i]->GetType() != TaskPointType::AAT)
+      continue;
+
+    AATPoint &ap = (AATPoint &)*task_points[i];
+    const double t = ap.GetIsolineParameter();
+    if (t < 0 || ap.IsTargetLocked())
+      continue;
+
+    const AATIsolineSegment iso(ap, task_projection);
+    if (iso.IsValid()) {
+      ap.SetTarget(iso.Parametric(t));
+      moved = true;
+    }
+  }
+
+  if (moved)
+    taskpoint_start->ScanDistanceRemaining(state.location);
+}
+
 bool
 OrderedTask::UpdateSample(const AircraftState &state,
                           [[maybe_unused]] const GlidePolar &glide_polar,
@@ -72,6 +72,12 @@ private:
   std::unique_ptr<TaskDijkstraMin> dijkstra_min;
   std::unique_ptr<TaskDijkstraMax> dijkstra_max;
 
+  /**
+   * Are the targets optimised by OptimiseTargets() in a background
+   * thread?  See SetBackgroundTargetOptimisation().
+   */
+  bool background_target_optimisation = false;
+
   StaticString<64> name;
 
 public:
@@ -634,6 +640,41 @@ public:
     name.clear();
   }
 
+  /**
+   * Move the targets of all remaining AAT points along their isolines
+   * to minimise the estimated time remaining.  This is one sweep of a
+   * coordinate descent; call it again until it returns false.  The
+   * new targets are only kept if they beat the current plan.
+   *
+   * On long tasks, this is too expensive for UpdateIdle(); it is meant
+   * to be called from a background thread, see
+   * SetBackgroundTargetOptimisation().
+   *
+   * @param state Aircraft state
+   *
+   * @return true if the targets were moved
+   */
+  bool OptimiseTargets(const AircraftState &state,
+                       const GlidePolar &glide_polar) noexcept;
+
+  /**
+   * Enable or disable background target optimisation.  While enabled,
+   * UpdateIdle() does not search the active AAT point's isoline
+   * itself; after the target ranges have been recalculated, it only
+   * moves the targets back to the isoline positions found by the last
+   * OptimiseTargets() call.
+   */
+  void SetBackgroundTargetOptimisation(bool enable) noexcept {
+    background_target_optimisation = enable;
+  }
+
+private:
+  /**
+   * Move all remaining AAT targets to their isoline positions found
+   * by OptimiseTargets().
+   */
+  void RestoreOptimisedTargets(const AircraftState &state) noexcept;
+
 public:
   /* virtual methods from class TaskInterface */
   unsigned TaskSize() const noexcept override {
@@ -140,6 +140,10 @@ AATPoint::SetTarget(RangeAndRadial rar, const FlatProjection &proj) noexcept
   const auto ftarget2 = floc + ftarget1;
   const auto targetG = proj.Unproject(ftarget2);
 
+  /* the user has chosen a target; don't let the optimiser move it
+     back to its previous position on the isoline */
+  isoline_parameter = -1;
+
   SetTarget(targetG, true);
 }
 
@@ -37,6 +37,13 @@ class AATPoint final : public IntermediateTaskPoint {
   /** Whether target can float */
   bool target_locked;
 
+  /**
+   * The position of the target on its isoline (0-1) chosen by
+   * OrderedTask::OptimiseTargets(), or negative if the target has not
+   * been optimised.
+   */
+  double isoline_parameter = -1;
+
 public:
   /**
    * Constructor.  Initialises to unlocked target, target is
@@ -100,6 +107,24 @@ public:
   [[gnu::pure]]
   RangeAndRadial GetTargetRangeRadial(double old_range=0) const noexcept;
 
+  /**
+   * @return the isoline parameter stored by SetIsolineParameter(), or
+   * negative if there is none
+   */
+  double GetIsolineParameter() const noexcept {
+    return isoline_parameter;
+  }
+
+  /**
+   * Remember the position of the target on its isoline, to be able to
+   * restore it after the target range has been changed.
+   *
+   * @param t Isoline parameter (0-1), or negative to forget it
+   */
+  void SetIsolineParameter(double t) noexcept {
+    isoline_parameter = t;
+  }
+
   /**
    * Accessor to get target location
    *
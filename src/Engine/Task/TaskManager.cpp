@@ -299,6 +299,19 @@ TaskManager::UpdateIdle(const AircraftState &state) noexcept
   return retval;
 }
 
+bool
+TaskManager::OptimiseTargets(const AircraftState &state) noexcept
+{
+  return active_task == ordered_task.get() &&
+    ordered_task->OptimiseTargets(state, glide_polar);
+}
+
+void
+TaskManager::SetBackgroundTargetOptimisation(bool enable) noexcept
+{
+  ordered_task->SetBackgroundTargetOptimisation(enable);
+}
+
 const TaskStats &
 TaskManager::GetStats() const noexcept
 {
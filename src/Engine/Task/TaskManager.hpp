@@ -166,6 +166,22 @@ public:
    */
   bool UpdateIdle(const AircraftState &state) noexcept;
 
+  /**
+   * Perform one sweep of the joint optimisation of all remaining AAT
+   * targets of the ordered task; see OrderedTask::OptimiseTargets().
+   *
+   * @param state Current aircraft state
+   *
+   * @return True if the targets were moved
+   */
+  bool OptimiseTargets(const AircraftState &state) noexcept;
+
+  /**
+   * Declare that OptimiseTargets() is called by a background thread;
+   * see OrderedTask::SetBackgroundTargetOptimisation().
+   */
+  void SetBackgroundTargetOptimisation(bool enable) noexcept;
+
   /** 
    * Update auto MC.  Internally uses TaskBehaviour to determine settings
    * 
@@ -3,10 +3,29 @@
 
 #pragma once
 
+#include <cassert>
+#include <span>
+
 struct AGeoPoint;
 
 class AbortIntersectionTest {
 public:
   [[gnu::pure]]
   virtual bool Intersects(const AGeoPoint &destination) const noexcept = 0;
+
+  /**
+   * Batch version of Intersects().  Implementations may override
+   * this to test all destinations at once; the default
+   * implementation calls Intersects() for each one.
+   *
+   * @param results receives the result for each destination (same
+   * size as #destinations)
+   */
+  virtual void Intersects(std::span<const AGeoPoint> destinations,
+                          std::span<bool> results) const noexcept {
+    assert(destinations.size() == results.size());
+
+    for (std::size_t i = 0; i < destinations.size(); ++i)
+      results[i] = Intersects(destinations[i]);
+  }
 };
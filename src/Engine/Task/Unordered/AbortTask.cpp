@@ -6,9 +6,15 @@
 #include "AlternateList.hpp"
 #include "Navigation/Aircraft.hpp"
 #include "Task/Visitors/TaskPointVisitor.hpp"
-#include "Task/Solvers/TaskSolution.hpp"
 #include "GlideSolvers/GlidePolar.hpp"
+#include "GlideSolvers/GlideState.hpp"
+#include "GlideSolvers/GlideResult.hpp"
+#include "GlideSolvers/MacCready.hpp"
 #include "Waypoint/Waypoints.hpp"
+#include "Geo/GeoPoint.hpp"
+
+#include <memory>
+#include <vector>
 
 /** min search range in m */
 static constexpr double min_search_range = 50000;
@@ -106,42 +112,75 @@ AbortTask::FillReachable(const AircraftState &state,
   if (IsTaskFull() || approx_waypoints.empty())
     return false;
 
-  const AGeoPoint p_start(state.location, state.altitude);
+  /* first pass: calculate the glide solutions and collect the
+     destinations which need an intersection test, so they can be
+     resolved with one batch call */
+  std::vector<GlideState> states;
+  states.reserve(approx_waypoints.size());
+  std::vector<std::size_t> state_indices;
+  state_indices.reserve(approx_waypoints.size());
+
+  for (std::size_t i = 0; i < approx_waypoints.size(); ++i) {
+    const auto &v = approx_waypoints[i];
+    if (only_airfield && !v.waypoint->IsAirport())
+      continue;
+
+    UnorderedTaskPoint t(v.waypoint, task_behaviour);
+    states.push_back(GlideState::Remaining(t, state, 0));
+    state_indices.push_back(i);
+  }
+
+  std::vector<GlideResult> solutions(states.size());
+  MacCready::Solve(task_behaviour.glide, polar, states, solutions);
+
+  std::vector<GlideResult> results(approx_waypoints.size());
+  std::vector<AGeoPoint> test_destinations;
+  std::vector<std::size_t> test_indices;
 
+  for (std::size_t j = 0; j < state_indices.size(); ++j) {
+    const std::size_t i = state_indices[j];
+    const GlideResult &result = results[i] = solutions[j];
+
+    if (intersection_test && final_glide && IsReachable(result, true)) {
+      test_destinations.emplace_back(approx_waypoints[i].waypoint->location,
+                                     result.min_arrival_altitude);
+      test_indices.push_back(i);
+    }
+  }
+
+  std::vector<char> intersects(approx_waypoints.size(), false);
+  if (!test_destinations.empty()) {
+    const std::unique_ptr<bool[]> test_results(new bool[test_destinations.size()]);
+    intersection_test->Intersects(test_destinations,
+                                  {test_results.get(), test_destinations.size()});
+    for (std::size_t i = 0; i < test_indices.size(); ++i)
+      intersects[test_indices[i]] = test_results[i];
+  }
+
+  /* second pass: move the reachable waypoints to the list */
   bool found_final_glide = false;
   AlternateList q;
   q.reserve(32);
 
-  for (auto v = approx_waypoints.begin(); v != approx_waypoints.end();) {
+  std::size_t i = 0;
+  for (auto v = approx_waypoints.begin(); v != approx_waypoints.end(); ++i) {
     if (only_airfield && !v->waypoint->IsAirport()) {
       ++v;
       continue;
     }
 
-    UnorderedTaskPoint t(v->waypoint, task_behaviour);
-    GlideResult result =
-        TaskSolution::GlideSolutionRemaining(t, state,
-                                             task_behaviour.glide, polar);
+    const GlideResult &result = results[i];
 
-    if (IsReachable(result, final_glide)) {
-      bool intersects = false;
-      const bool is_reachable_final = IsReachable(result, true);
+    if (IsReachable(result, final_glide) && !intersects[i]) {
+      q.emplace_back(v->waypoint, result);
+      // remove it since it's already in the list now
+      v = approx_waypoints.erase(v);
 
-      if (intersection_test && final_glide && is_reachable_final)
-        intersects = intersection_test->Intersects(
-            AGeoPoint(v->waypoint->location, result.min_arrival_altitude));
+      if (IsReachable(result, true))
+        found_final_glide = true;
 
-      if (!intersects) {
-        q.emplace_back(v->waypoint, result);
-        // remove it since it's already in the list now      
-        v = approx_waypoints.erase(v);
-
-        if (is_reachable_final)
-          found_final_glide = true;
-
-        continue; // skip incrementing v since we just erased it
-      }
-    } 
+      continue; // skip incrementing v since we just erased it
+    }
 
     ++v;
   }
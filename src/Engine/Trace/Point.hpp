@@ -112,6 +112,14 @@ public:
     return time - previous.time;
   }
 
+  /**
+   * Returns the thermal drift factor (256 = drift rate equal to wind
+   * speed).
+   */
+  constexpr unsigned GetDriftFactor() const noexcept {
+    return drift_factor;
+  }
+
   constexpr double CalculateDrift(TimeStamp now) const noexcept {
     const double dt = (now.ToDuration() - std::chrono::duration_cast<FloatDuration>(time)).count();
     return dt * drift_factor / 256;
@@ -3,37 +3,35 @@
 
 #include "Trace.hpp"
 #include "Vector.hpp"
-#include "util/GlobalSliceAllocator.hxx"
 
 #include <algorithm>
 #include <iterator>
 
 Trace::Trace(const Time _no_thin_time, const Time max_time,
              const unsigned max_size) noexcept
-  :cached_size(0),
-   max_time(max_time),
+  :max_time(max_time),
    no_thin_time(_no_thin_time),
    max_size(max_size),
    opt_size((3 * max_size) / 4)
 {
   assert(max_size >= 4);
+
+  /* leave some headroom for points erased at the start by the time
+     window, so they do not need to be reclaimed on every append */
+  const std::size_t capacity = max_size + max_size / 4;
+  points.reserve(capacity);
+  deltas.reserve(capacity);
 }
 
 void
 Trace::clear() noexcept
 {
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
-
   average_delta_distance = 0;
   average_delta_time = {};
 
-  delta_list.clear();
-  chronological_list.clear_and_dispose(MakeDisposer());
-  cached_size = 0;
-
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
+  points.clear();
+  deltas.clear();
+  head = 0;
 
   ++modify_serial;
   ++append_serial;
@@ -53,101 +51,128 @@ Trace::GetRecentTime(const Time t) const noexcept
 }
 
 void
-Trace::UpdateDelta(TraceDelta &td) noexcept
+Trace::UpdateDelta(const unsigned i, const Time recent_time) noexcept
 {
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
-
-  if (&td == &chronological_list.front() ||
-      &td == &chronological_list.back())
+  const unsigned previous = link_previous[i], next = link_next[i];
+  if (previous == NO_INDEX || next == NO_INDEX)
+    /* the first and the last point are never thinned */
     return;
 
-  const auto ci = chronological_list.iterator_to(td);
-  const TraceDelta &previous = *std::prev(ci);
-  const TraceDelta &next = *std::next(ci);
+  TraceDelta &td = deltas[i];
+  td.Update(points[previous], points[i], points[next]);
 
-  delta_list.erase(delta_list.iterator_to(td));
-  td.Update(previous.point, next.point);
-  delta_list.insert(td);
+  if (points[i].GetTime() < recent_time) {
+    delta_heap.push_back({td.elim_distance, td.elim_time,
+                          points[i].GetTime(), i});
+    std::push_heap(delta_heap.begin(), delta_heap.end(),
+                   DeltaHeapItem::Greater());
+  }
 }
 
 void
-Trace::EraseInside(DeltaList::iterator it) noexcept
+Trace::EraseInside(const unsigned i, const Time recent_time) noexcept
 {
-  assert(cached_size > 0);
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
-  assert(it != delta_list.end());
-
-  const TraceDelta &td = *it;
-  assert(!td.IsEdge());
+  assert(!deltas[i].IsEdge());
 
-  const auto ci = chronological_list.iterator_to(td);
-  TraceDelta &previous = const_cast<TraceDelta &>(*std::prev(ci));
-  TraceDelta &next = const_cast<TraceDelta &>(*std::next(ci));
+  const unsigned previous = link_previous[i], next = link_next[i];
+  assert(previous != NO_INDEX);
+  assert(next != NO_INDEX);
 
   // now delete the item
-  chronological_list.erase(chronological_list.iterator_to(td));
-  delta_list.erase_and_dispose(it, MakeDisposer());
-  --cached_size;
+  link_next[previous] = next;
+  link_previous[next] = previous;
+
+  /* this invalidates all of its entries in the candidate heap */
+  deltas[i] = TraceDelta();
 
   // and update the deltas
-  UpdateDelta(previous);
-  UpdateDelta(next);
+  UpdateDelta(previous, recent_time);
+  UpdateDelta(next, recent_time);
 }
 
 bool
 Trace::EraseDelta(const unsigned target_size, const Time recent) noexcept
 {
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
-
   if (size() <= 2)
     return false;
 
-  bool modified = false;
-
   const Time recent_time = GetRecentTime(recent);
 
-  auto candidate = delta_list.begin();
-  while (size() > target_size) {
-    const TraceDelta &td = *candidate;
-    if (!td.IsEdge() && td.point.GetTime() < recent_time) {
-      EraseInside(candidate);
-      candidate = delta_list.begin(); // find new top
-      modified = true;
-    } else {
-      ++candidate;
-      // suppressed removal, skip it.
-    }
+  /* link all points and queue the candidates */
+  const unsigned n = points.size();
+  link_previous.resize(n);
+  link_next.resize(n);
+  delta_heap.clear();
+
+  for (unsigned i = head; i < n; ++i) {
+    link_previous[i] = i > head ? i - 1 : NO_INDEX;
+    link_next[i] = i + 1 < n ? i + 1 : NO_INDEX;
+
+    const TraceDelta &td = deltas[i];
+    if (!td.IsEdge() && points[i].GetTime() < recent_time)
+      delta_heap.push_back({td.elim_distance, td.elim_time,
+                            points[i].GetTime(), i});
+  }
+
+  std::make_heap(delta_heap.begin(), delta_heap.end(),
+                 DeltaHeapItem::Greater());
+
+  unsigned remaining = size();
+  while (remaining > target_size && !delta_heap.empty()) {
+    std::pop_heap(delta_heap.begin(), delta_heap.end(),
+                  DeltaHeapItem::Greater());
+    const DeltaHeapItem item = delta_heap.back();
+    delta_heap.pop_back();
+
+    const TraceDelta &td = deltas[item.index];
+    if (td.elim_distance != item.elim_distance ||
+        td.elim_time != item.elim_time)
+      /* stale entry: the point was erased or its metrics were
+         updated and queued again */
+      continue;
+
+    EraseInside(item.index, recent_time);
+    --remaining;
+  }
+
+  if (remaining == size())
+    return false;
+
+  /* move the surviving points together; the first point is never
+     erased */
+  unsigned dest = 0;
+  for (unsigned i = head; i != NO_INDEX; i = link_next[i], ++dest) {
+    points[dest] = points[i];
+    deltas[dest] = deltas[i];
   }
 
-  return modified;
+  assert(dest == remaining);
+  points.resize(dest);
+  deltas.resize(dest);
+  head = 0;
+
+  return true;
 }
 
 bool
 Trace::EraseEarlierThan(const Time p_time) noexcept
 {
-  if (p_time == Time{} || empty() || GetFront().point.GetTime() >= p_time)
+  if (p_time == Time{} || empty() || front().GetTime() >= p_time)
     // there will be nothing to remove
     return false;
 
   do {
-    auto ci = chronological_list.begin();
-    TraceDelta &td = *ci;
-    chronological_list.erase(ci);
-
-    auto i = delta_list.find(td);
-    assert(i != delta_list.end());
-    delta_list.erase_and_dispose(i, MakeDisposer());
+    ++head;
+  } while (!empty() && front().GetTime() < p_time);
 
-    --cached_size;
-  } while (!empty() && GetFront().point.GetTime() < p_time);
-
-  // need to set deltas for first point, only one of these
-  // will occur (have to search for this point)
+  // need to set deltas for first point
   if (!empty())
-    EraseStart(GetFront());
+    EraseStart(head);
+  else {
+    points.clear();
+    deltas.clear();
+    head = 0;
+  }
 
   ++modify_serial;
   ++append_serial;
@@ -160,44 +185,38 @@ Trace::EraseLaterThan(const Time min_time) noexcept
   assert(min_time.count() > 0);
   assert(!empty());
 
-  while (!empty() && GetBack().point.GetTime() > min_time) {
-    TraceDelta &td = GetBack();
-
-    chronological_list.erase(chronological_list.iterator_to(td));
-
-    auto i = delta_list.find(td);
-    assert(i != delta_list.end());
-    delta_list.erase_and_dispose(i, MakeDisposer());
-
-    --cached_size;
+  while (!empty() && back().GetTime() > min_time) {
+    points.pop_back();
+    deltas.pop_back();
   }
 
-  /* need to set deltas for first point, only one of these will occur
-     (have to search for this point) */
+  /* need to set deltas for the last point */
   if (!empty())
-    EraseStart(GetBack());
+    EraseStart(points.size() - 1);
 }
 
-/**
- * Update start node (and neighbour) after min time pruning
- */
 void
-Trace::EraseStart(TraceDelta &td) noexcept
+Trace::EraseStart(const unsigned i) noexcept
 {
-  delta_list.erase(delta_list.iterator_to(td));
+  /* the delta distance is kept, it is still used by
+     CalcAverageDeltaDistance() */
+  deltas[i].elim_distance = null_delta;
+  deltas[i].elim_time = null_time;
+}
 
-  td.elim_distance = null_delta;
-  td.elim_time = null_time;
+void
+Trace::Compact() noexcept
+{
+  points.erase(points.begin(), std::next(points.begin(), head));
+  deltas.erase(deltas.begin(), std::next(deltas.begin(), head));
+  head = 0;
 
-  delta_list.insert(td);
+  ++modify_serial;
 }
 
 void
 Trace::push_back(const TracePoint &point) noexcept
 {
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
-
   const Time min_delta = std::chrono::seconds{2};
 
   if (empty()) {
@@ -230,17 +249,19 @@ Trace::push_back(const TracePoint &point) noexcept
 
   assert(size() < max_size);
 
-  TraceDelta *td = allocator.allocate(1);
-  std::allocator_traits<Allocator>::construct(allocator, td, point);
-  td->point.Project(task_projection);
-
-  delta_list.insert(*td);
-  chronological_list.push_back(*td);
+  if (points.size() == points.capacity())
+    /* reclaim the space of points erased by the time window instead
+       of reallocating, which would move all points */
+    Compact();
 
-  ++cached_size;
+  points.push_back(point);
+  points.back().Project(task_projection);
+  deltas.emplace_back();
 
-  if (td != &chronological_list.front())
-    UpdateDelta(*std::prev(chronological_list.iterator_to(*td)));
+  const unsigned n = points.size();
+  if (n - head >= 3)
+    /* the previous point is no longer the last one */
+    deltas[n - 2].Update(points[n - 3], points[n - 2], points[n - 1]);
 
   ++append_serial;
 }
@@ -252,10 +273,9 @@ Trace::CalcAverageDeltaDistance(const Time no_thin) const noexcept
   unsigned acc = 0;
   unsigned counter = 0;
 
-  const auto end = chronological_list.end();
-  for (auto it = chronological_list.begin();
-       it != end && it->point.GetTime() < r; ++it, ++counter)
-    acc += it->delta_distance;
+  for (unsigned i = head; i < points.size() && points[i].GetTime() < r;
+       ++i, ++counter)
+    acc += deltas[i].delta_distance;
 
   if (counter)
     return acc / counter;
@@ -270,19 +290,17 @@ Trace::CalcAverageDeltaTime(const Time no_thin) const noexcept
   unsigned counter = 0;
 
   /* find the last item before the "r" timestamp */
-  const auto end = chronological_list.end();
-  ChronologicalList::const_iterator it;
-  for (it = chronological_list.begin(); it != end && it->point.GetTime() < r; ++it)
+  const auto points = GetPoints();
+  while (counter < points.size() && points[counter].GetTime() < r)
     ++counter;
 
   if (counter < 2)
     return {};
 
-  --it;
   --counter;
 
   Time start_time = front().GetTime();
-  Time end_time = it->point.GetTime();
+  Time end_time = points[counter].GetTime();
   return (end_time - start_time) / counter;
 }
 
@@ -323,8 +341,6 @@ Trace::Thin2() noexcept
 void
 Trace::Thin() noexcept
 {
-  assert(cached_size == delta_list.size());
-  assert(cached_size == chronological_list.size());
   assert(size() == max_size);
 
   Thin2();
@@ -341,74 +357,8 @@ Trace::Thin() noexcept
 void
 Trace::GetPoints(TracePointVector& iov) const noexcept
 {
-  iov.clear();
-  iov.reserve(size());
-  std::copy(begin(), end(), std::back_inserter(iov));
-}
-
-template<typename I>
-class PointerIterator {
-  I i;
-
-public:
-  typedef typename I::iterator_category iterator_category;
-  typedef typename I::pointer value_type;
-  typedef typename I::pointer *pointer;
-  typedef value_type &reference;
-  typedef typename I::difference_type difference_type;
-
-  PointerIterator() = default;
-  explicit PointerIterator(I _i) noexcept:i(_i) {}
-
-  PointerIterator<I> &operator--() noexcept {
-    --i;
-    return *this;
-  }
-
-  PointerIterator<I> &operator++() noexcept {
-    ++i;
-    return *this;
-  }
-
-  typename I::pointer operator*() noexcept {
-    return &*i;
-  }
-
-  bool operator==(const PointerIterator<I> &other) const noexcept {
-    return i == other.i;
-  }
-
-  bool operator!=(const PointerIterator<I> &other) const noexcept {
-    return i != other.i;
-  }
-};
-
-void
-Trace::GetPoints(TracePointerVector &v) const noexcept
-{
-  v.clear();
-  v.reserve(size());
-  std::copy(PointerIterator<decltype(begin())>(begin()),
-            PointerIterator<decltype(end())>(end()),
-            std::back_inserter(v));
-}
-
-bool
-Trace::SyncPoints(TracePointerVector &v) const noexcept
-{
-  assert(v.size() <= size());
-
-  if (v.size() == size())
-    /* no news */
-    return false;
-
-  v.reserve(size());
-
-  PointerIterator<decltype(end())> e(end());
-  std::copy(std::prev(e, size() - v.size()), e,
-            std::back_inserter(v));
-  assert(v.size() == size());
-  return true;
+  const auto src = GetPoints();
+  iov.assign(src.begin(), src.end());
 }
 
 void
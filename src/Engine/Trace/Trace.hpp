@@ -5,21 +5,19 @@
 
 #include "Point.hpp"
 #include "util/NonCopyable.hpp"
-#include "util/Sanitizer.hxx"
-#include "util/SliceAllocator.hxx"
 #include "util/Serial.hpp"
 #include "Geo/Flat/TaskProjection.hpp"
 #include "time/Stamp.hpp"
 
-#include <boost/intrusive/list.hpp>
-#include <boost/intrusive/set.hpp>
 #include <algorithm>
 #include <cassert>
-#include <type_traits>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
 #include <stdlib.h>
 
 class TracePointVector;
-class TracePointerVector;
 
 /**
  * This class uses a smart thinning algorithm to limit the number of items
@@ -30,76 +28,32 @@ class TracePointerVector;
  * the candidate point removed.  In this version, time differences is also a
  * secondary factor, such that thinning attempts to remove points such that,
  * for equal distance ranking, smaller time step details are removed first.
+ *
+ * The points are stored in chronological order in one contiguous
+ * array, which is allocated once by the constructor.  Appending a
+ * point never moves the others; thinning removes points by
+ * compacting the array, and points dropped at the start by the time
+ * window are reclaimed the next time the end of the array is reached.
+ * Both bump the modify serial, so consumers may hold on to the span
+ * returned by GetPoints() as long as GetModifySerial() is unchanged.
  */
 class Trace : private NonCopyable
 {
   using Time = TracePoint::Time;
 
-  struct TraceDelta
-    : boost::intrusive::set_base_hook<boost::intrusive::link_mode<boost::intrusive::normal_link>>,
-      boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::normal_link>> {
-
-    /**
-     * Function used to points for sorting by deltas.
-     * Ranking is primarily by distance delta; for equal distances, rank by
-     * time delta.
-     * This is like a modified Douglas-Peuker algorithm
-     */
-    [[gnu::pure]]
-    static constexpr bool DeltaRank(const TraceDelta &x,
-                                    const TraceDelta &y) noexcept {
-      // distance is king
-      if (x.elim_distance < y.elim_distance)
-        return true;
-
-      if (x.elim_distance > y.elim_distance)
-        return false;
-
-      // distance is equal, so go by time error
-      if (x.elim_time < y.elim_time)
-        return true;
-
-      if (x.elim_time > y.elim_time)
-        return false;
-
-      // all else fails, go by age
-      if (x.point.IsOlderThan(y.point))
-        return true;
-
-      if (x.point.IsNewerThan(y.point))
-        return false;
-
-      return false;
-    }
-
-    struct DeltaRankOp {
-      constexpr bool operator()(const TraceDelta &s1,
-                                const TraceDelta &s2) const noexcept {
-        return DeltaRank(s1, s2);
-      }
-    };
-
-    TracePoint point;
-
+  /**
+   * The thinning metrics of one point.  These are kept in an array
+   * parallel to #points.
+   */
+  struct TraceDelta {
     Time elim_time;
     unsigned elim_distance;
     unsigned delta_distance;
 
-    explicit TraceDelta(const TracePoint &p) noexcept
-      :point(p),
-       elim_time(null_time), elim_distance(null_delta),
+    constexpr TraceDelta() noexcept
+      :elim_time(null_time), elim_distance(null_delta),
        delta_distance(0) {}
 
-    TraceDelta(const TracePoint &p_last, const TracePoint &p,
-               const TracePoint &p_next) noexcept
-      :point(p),
-       elim_time(TimeMetric(p_last, p, p_next)),
-       elim_distance(DistanceMetric(p_last, p, p_next)),
-       delta_distance(p.FlatDistanceTo(p_last))
-    {
-      assert(elim_distance != null_delta);
-    }
-
     /**
      * Is this the first or the last point?
      */
@@ -107,10 +61,12 @@ class Trace : private NonCopyable
       return elim_time == null_time;
     }
 
-    void Update(const TracePoint &p_last, const TracePoint &p_next) noexcept {
-      elim_time = TimeMetric(p_last, point, p_next);
-      elim_distance = DistanceMetric(p_last, point, p_next);
-      delta_distance = point.FlatDistanceTo(p_last);
+    void Update(const TracePoint &p_last, const TracePoint &p,
+                const TracePoint &p_next) noexcept {
+      elim_time = TimeMetric(p_last, p, p_next);
+      elim_distance = DistanceMetric(p_last, p, p_next);
+      delta_distance = p.FlatDistanceTo(p_last);
+      assert(elim_distance != null_delta);
     }
 
     /**
@@ -152,31 +108,72 @@ class Trace : private NonCopyable
     }
   };
 
-  /* using multiset, not because we need multiple values (we don't),
-     but to avoid set's overhead for duplicate elimination */
-  typedef boost::intrusive::multiset<TraceDelta,
-                                     boost::intrusive::compare<TraceDelta::DeltaRankOp>,
-                                     boost::intrusive::constant_time_size<false>> DeltaList;
+  /**
+   * An entry of the thinning candidate heap: the index of a point
+   * and a copy of its ranking key at the time it was queued.  The
+   * entry is stale if the point's metrics have changed since.
+   */
+  struct DeltaHeapItem {
+    unsigned elim_distance;
+    Time elim_time;
+    Time time;
+
+    unsigned index;
+
+    /**
+     * Function used to points for sorting by deltas.
+     * Ranking is primarily by distance delta; for equal distances, rank by
+     * time delta.
+     * This is like a modified Douglas-Peuker algorithm
+     */
+    [[gnu::pure]]
+    static constexpr bool DeltaRank(const DeltaHeapItem &x,
+                                    const DeltaHeapItem &y) noexcept {
+      // distance is king
+      if (x.elim_distance != y.elim_distance)
+        return x.elim_distance < y.elim_distance;
+
+      // distance is equal, so go by time error
+      if (x.elim_time != y.elim_time)
+        return x.elim_time < y.elim_time;
+
+      // all else fails, go by age
+      return x.time < y.time;
+    }
+
+    /**
+     * Heap comparison which puts the lowest rank at the top.
+     */
+    struct Greater {
+      constexpr bool operator()(const DeltaHeapItem &a,
+                                const DeltaHeapItem &b) const noexcept {
+        return DeltaRank(b, a);
+      }
+    };
+  };
+
+  static constexpr unsigned NO_INDEX = -1;
 
-  typedef boost::intrusive::list<TraceDelta,
-                                 boost::intrusive::constant_time_size<false>> ChronologicalList;
+  /**
+   * All points; the ones before #head have been erased by
+   * EraseEarlierThan() and will be reclaimed by Compact().
+   */
+  std::vector<TracePoint> points;
 
   /**
-   * Use a SliceAllocator for allocating TraceDelta instances.  This
-   * reduces a lot of allocation overhead (both CPU and memory),
-   * because there will be lots of these objects.  Fall back to
-   * std::allocator when compiled with AddressSanitizer, because that
-   * avoids hiding memory errors.
+   * The thinning metrics, one for each element of #points.
    */
-  using Allocator = std::conditional_t<HaveAddressSanitizer(),
-                                       std::allocator<TraceDelta>,
-                                       SliceAllocator<TraceDelta, 128u>>;
+  std::vector<TraceDelta> deltas;
 
-  Allocator allocator;
+  unsigned head = 0;
 
-  DeltaList delta_list;
-  ChronologicalList chronological_list;
-  unsigned cached_size;
+  /**
+   * Scratch buffers for EraseDelta(): a doubly linked list over
+   * #points and the candidate heap.  They are kept to avoid
+   * allocating on every thinning pass.
+   */
+  std::vector<unsigned> link_previous, link_next;
+  std::vector<DeltaHeapItem> delta_heap;
 
   TaskProjection task_projection;
 
@@ -190,25 +187,6 @@ class Trace : private NonCopyable
 
   Serial append_serial, modify_serial;
 
-  template<typename Alloc>
-  struct Disposer {
-    Alloc &alloc;
-
-    void operator()(typename std::allocator_traits<Alloc>::pointer td) {
-      std::allocator_traits<Alloc>::destroy(alloc, td);
-      alloc.deallocate(td, 1);
-    }
-  };
-
-  template<typename Alloc>
-  static Disposer<Alloc> MakeDisposer(Alloc &alloc) {
-    return {alloc};
-  }
-
-  Disposer<decltype(allocator)> MakeDisposer() {
-    return MakeDisposer(allocator);
-  }
-
 public:
   /**
    * Constructor.  Task projection is updated after first call to append().
@@ -222,10 +200,6 @@ public:
                  const Time max_time = null_time,
                  const unsigned max_size = 1000) noexcept;
 
-  ~Trace() noexcept {
-    clear();
-  }
-
 protected:
   /**
    * Find recent time after which points should not be culled
@@ -239,25 +213,23 @@ protected:
   Time GetRecentTime(Time t) const noexcept;
 
   /**
-   * Update delta values for specified item in the delta list and the
-   * tree.  This repositions the item after into its sorted position.
+   * Update delta values for the specified point from its current
+   * neighbours in the linked list, and queue it as a thinning
+   * candidate if it was not recorded after #recent_time.
    *
-   * @param it Item to update
-   * @param tree Tree containing leaf
-   *
-   * @return Iterator to updated item
+   * @param i Index of the point to update
+   * @param recent_time Time after which points are not candidates
    */
-  void UpdateDelta(TraceDelta &td) noexcept;
+  void UpdateDelta(unsigned i, Time recent_time) noexcept;
 
   /**
-   * Erase a non-edge item from delta list and tree, updating
-   * deltas in the process.  This Invalidates the calling iterator.
-   *
-   * @param it Item to erase
-   * @param tree Tree to remove from
+   * Unlink a non-edge point from the linked list, updating the
+   * deltas of its neighbours in the process.
    *
+   * @param i Index of the point to erase
+   * @param recent_time Time after which points are not candidates
    */
-  void EraseInside(DeltaList::iterator it) noexcept;
+  void EraseInside(unsigned i, Time recent_time) noexcept;
 
   /**
    * Erase elements based on delta metric until the size is
@@ -268,7 +240,6 @@ protected:
    * fail to set the target size.
    *
    * @param target_size Size of desired list.
-   * @param tree Tree to remove from
    * @param recent Time window for which to not remove points
    *
    * @return True if items were erased
@@ -277,11 +248,10 @@ protected:
                   Time recent = {}) noexcept;
 
   /**
-   * Erase elements older than specified time from delta and tree,
-   * and update earliest item to become the new start
+   * Erase elements older than specified time, and update earliest
+   * item to become the new start
    *
    * @param p_time Time to remove
-   * @param tree Tree to remove from
    *
    * @return True if items were erased
    */
@@ -294,9 +264,10 @@ protected:
   void EraseLaterThan(Time min_time) noexcept;
 
   /**
-   * Update start node (and neighbour) after min time pruning
+   * Turn the specified point into an edge after the points before or
+   * after it have been erased.
    */
-  void EraseStart(TraceDelta &td_start) noexcept;
+  void EraseStart(unsigned i) noexcept;
 
 public:
   /**
@@ -331,7 +302,7 @@ public:
    * @return Number of traces in tree
    */
   unsigned size() const noexcept {
-    return cached_size;
+    return points.size() - head;
   }
 
   /**
@@ -340,7 +311,7 @@ public:
    * @return True if no traces stored
    */
   bool empty() const noexcept {
-    return cached_size == 0;
+    return points.size() == head;
   }
 
   /**
@@ -372,18 +343,14 @@ public:
   void GetPoints(TracePointVector& iov) const noexcept;
 
   /**
-   * Retrieve a vector of trace points sorted by time
-   */
-  void GetPoints(TracePointerVector &v) const noexcept;
-
-  /**
-   * Update the given #TracePointVector after points were appended to
-   * this object.  This must not be called after thinning has
-   * occurred, see GetModifySerial().
-   *
-   * @return true if new points were added
+   * Obtain a read-only view of all trace points sorted by time,
+   * without copying them.  The span remains valid (and keeps its
+   * elements) until GetModifySerial() changes; appended points are
+   * obtained by calling this method again.
    */
-  bool SyncPoints(TracePointerVector &v) const noexcept;
+  std::span<const TracePoint> GetPoints() const noexcept {
+    return {points.data() + head, size()};
+  }
 
   /**
    * Fill the vector with trace points, not before #min_time, minimum
@@ -395,13 +362,13 @@ public:
   const TracePoint &front() const noexcept {
     assert(!empty());
 
-    return chronological_list.front().point;
+    return points[head];
   }
 
   const TracePoint &back() const noexcept {
     assert(!empty());
 
-    return chronological_list.back().point;
+    return points.back();
   }
 
 private:
@@ -428,17 +395,11 @@ private:
    */
   void Thin() noexcept;
 
-  TraceDelta &GetFront() noexcept {
-    assert(!empty());
-
-    return chronological_list.front();
-  }
-
-  TraceDelta &GetBack() noexcept {
-    assert(!empty());
-
-    return chronological_list.back();
-  }
+  /**
+   * Move all points to the start of the arrays, reclaiming the space
+   * of the ones erased by EraseEarlierThan().
+   */
+  void Compact() noexcept;
 
   [[gnu::pure]]
   unsigned CalcAverageDeltaDistance(Time no_thin) const noexcept;
@@ -460,31 +421,51 @@ public:
   }
 
 public:
-  class const_iterator : public ChronologicalList::const_iterator {
+  class const_iterator {
     friend class Trace;
 
-    const_iterator(ChronologicalList::const_iterator &&_iterator) noexcept
-      :ChronologicalList::const_iterator(std::move(_iterator)) {}
+    const TracePoint *p;
+
+    explicit constexpr const_iterator(const TracePoint *_p) noexcept
+      :p(_p) {}
 
   public:
-    using ChronologicalList::const_iterator::iterator_category;
-    using ChronologicalList::const_iterator::difference_type;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
     typedef const TracePoint value_type;
     typedef const TracePoint *pointer;
     typedef const TracePoint &reference;
 
     const_iterator() = default;
 
-    const TracePoint &operator*() const noexcept {
-      const TraceDelta &td = ChronologicalList::const_iterator::operator*();
-      return td.point;
+    constexpr const TracePoint &operator*() const noexcept {
+      return *p;
+    }
+
+    constexpr const TracePoint *operator->() const noexcept {
+      return p;
+    }
+
+    constexpr const_iterator &operator++() noexcept {
+      ++p;
+      return *this;
+    }
+
+    constexpr const_iterator operator++(int) noexcept {
+      return const_iterator(p++);
     }
 
-    const TracePoint *operator->() const noexcept {
-      const TraceDelta &td = ChronologicalList::const_iterator::operator*();
-      return &td.point;
+    constexpr const_iterator &operator--() noexcept {
+      --p;
+      return *this;
     }
 
+    constexpr const_iterator operator--(int) noexcept {
+      return const_iterator(p--);
+    }
+
+    constexpr bool operator==(const const_iterator &) const noexcept = default;
+
     const_iterator &NextSquareRange(unsigned sq_resolution,
                                     const const_iterator &end) noexcept {
       const TracePoint &previous = **this;
@@ -494,19 +475,18 @@ public:
         if (*this == end)
           return *this;
 
-        const TraceDelta &td = ChronologicalList::const_iterator::operator*();
-        if (td.point.FlatSquareDistanceTo(previous) >= sq_resolution)
+        if (p->FlatSquareDistanceTo(previous) >= sq_resolution)
           return *this;
       }
     }
   };
 
   const_iterator begin() const noexcept {
-    return chronological_list.begin();
+    return const_iterator(points.data() + head);
   }
 
   const_iterator end() const noexcept {
-    return chronological_list.end();
+    return const_iterator(points.data() + points.size());
   }
 
   const TaskProjection &GetProjection() const noexcept {
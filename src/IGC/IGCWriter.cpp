@@ -11,12 +11,14 @@
 
 #include <cassert>
 
-IGCWriter::IGCWriter(Path path)
+IGCWriter::IGCWriter(Path path,
+                     std::chrono::steady_clock::duration sync_interval)
   :file(path,
         /* we use CREATE_VISIBLE here so the user can recover partial
            IGC files after a crash/battery failure/etc. */
         FileOutputStream::Mode::CREATE_VISIBLE),
-   buffered(file)
+   async(file, sync_interval),
+   buffered(async)
 {
   fix.Clear();
 
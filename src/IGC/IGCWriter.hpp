@@ -4,11 +4,13 @@
 #pragma once
 
 #include "Logger/GRecord.hpp"
+#include "Logger/AsyncLogWriter.hpp"
 #include "IGCFix.hpp"
 #include "io/FileOutputStream.hxx"
 #include "io/BufferedOutputStream.hxx"
 
 #include <array>
+#include <chrono>
 #include <string_view>
 
 #include <tchar.h>
@@ -19,8 +21,14 @@ struct BrokenDateTime;
 struct NMEAInfo;
 struct GeoPoint;
 
+/**
+ * Writes an IGC file.  The records are passed to an #AsyncLogWriter,
+ * which writes them to the file in a separate thread, therefore
+ * logging a record does not block on storage I/O.
+ */
 class IGCWriter {
   FileOutputStream file;
+  AsyncLogWriter async;
   BufferedOutputStream buffered;
 
   GRecord grecord;
@@ -32,13 +40,36 @@ class IGCWriter {
 public:
   /**
    * Throws on error.
+   *
+   * @param sync_interval the maximum time records may stay in memory
+   * before they are written to the file and synced
    */
-  explicit IGCWriter(Path path);
+  explicit IGCWriter(Path path,
+                     std::chrono::steady_clock::duration sync_interval=std::chrono::seconds{5});
 
+  /**
+   * Pass all records to the #AsyncLogWriter.  This does not wait for
+   * them to be written; see Sync().
+   */
   void Flush() {
     buffered.Flush();
   }
 
+  /**
+   * Write all records to the file and wait until they have been
+   * synced to storage.
+   *
+   * Throws on error.
+   */
+  void Sync() {
+    buffered.Flush();
+    async.Sync();
+  }
+
+  AsyncLogWriter::Statistics GetWriterStatistics() const noexcept {
+    return async.GetStatistics();
+  }
+
   void Sign();
 
 private:
@@ -148,6 +148,7 @@ void eventPan(const TCHAR *misc);
 void eventPlaySound(const TCHAR *misc);
 void eventProfileLoad(const TCHAR *misc);
 void eventProfileSave(const TCHAR *misc);
+void eventProfiler(const TCHAR *misc);
 void eventRepeatStatusMessage(const TCHAR *misc);
 void eventRun(const TCHAR *misc);
 void eventScreenModes(const TCHAR *misc);
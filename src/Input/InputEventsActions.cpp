@@ -58,6 +58,9 @@ doc/html/advanced/input/ALL  http://xcsoar.sourceforge.net/advanced/input/
 #include "Waypoint/WaypointGlue.hpp"
 #include "Task/ProtectedTaskManager.hpp"
 #include "UtilsSettings.hpp"
+#include "Profiler/Profiler.hpp"
+#include "Profiler/Glue.hpp"
+#include "system/Path.hpp"
 #include "PageActions.hpp"
 #include "MapWindow/GlueMapWindow.hpp"
 #include "Simulator.hpp"
@@ -227,6 +230,36 @@ try {
   ShowError(std::current_exception(), _("Logger Error"));
 }
 
+// Profiler
+// Controls the runtime profiler
+//  on: starts measuring
+//  off: stops measuring
+//  toggle: toggles between on and off
+//  clear: discards all measurements
+//  dump: writes the statistics to the log file and a trace to profile.json
+void
+InputEvents::eventProfiler(const TCHAR *misc)
+try {
+  if (StringIsEqual(misc, _T("on")))
+    Profiler::SetEnabled(true);
+  else if (StringIsEqual(misc, _T("off")))
+    Profiler::SetEnabled(false);
+  else if (StringIsEqual(misc, _T("toggle"))) {
+    Profiler::SetEnabled(!Profiler::IsEnabled());
+    if (Profiler::IsEnabled())
+      Message::AddMessage(_("Profiler on"));
+    else
+      Message::AddMessage(_("Profiler off"));
+  } else if (StringIsEqual(misc, _T("clear")))
+    Profiler::Clear();
+  else if (StringIsEqual(misc, _T("dump"))) {
+    const auto path = Profiler::Dump();
+    Message::AddMessage(_("Profile saved"), path.c_str());
+  }
+} catch (...) {
+  ShowError(std::current_exception(), _("Profiler"));
+}
+
 void
 InputEvents::eventScreenModes(const TCHAR *misc)
 {
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "AsyncLogWriter.hpp"
+#include "io/FileOutputStream.hxx"
+#include "Profiler/Profiler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+static constinit Profiler::Zone write_zone{"LogWrite"};
+
+AsyncLogWriter::AsyncLogWriter(FileOutputStream &_file,
+                               Clock::duration _latency)
+  :Thread("LogWriter"),
+   file(_file), latency(_latency)
+{
+  pending.reserve(BATCH_SIZE);
+
+  Start();
+  SetLowPriority();
+}
+
+AsyncLogWriter::~AsyncLogWriter() noexcept
+{
+  {
+    const std::lock_guard lock{mutex};
+    stop = true;
+    cond.notify_one();
+  }
+
+  Join();
+}
+
+inline void
+AsyncLogWriter::RethrowError()
+{
+  if (error)
+    std::rethrow_exception(std::exchange(error, {}));
+}
+
+void
+AsyncLogWriter::Write(std::span<const std::byte> src)
+{
+  std::unique_lock lock{mutex};
+  RethrowError();
+
+  done_cond.wait(lock, [this, &src]{
+    return pending.empty() || pending.size() + src.size() <= MAX_PENDING;
+  });
+
+  if (pending.empty())
+    pending_since = Clock::now();
+
+  pending.insert(pending.end(), src.begin(), src.end());
+  statistics.max_pending_bytes = std::max(statistics.max_pending_bytes,
+                                          pending.size());
+
+  if (pending.size() == src.size() || pending.size() >= BATCH_SIZE)
+    /* wake up the thread to start the latency timer or to write a
+       full batch */
+    cond.notify_one();
+}
+
+void
+AsyncLogWriter::Sync()
+{
+  std::unique_lock lock{mutex};
+
+  if (!pending.empty()) {
+    sync_requested = true;
+    cond.notify_one();
+  }
+
+  done_cond.wait(lock, [this]{
+    return (pending.empty() && !busy) || error;
+  });
+
+  RethrowError();
+}
+
+AsyncLogWriter::Statistics
+AsyncLogWriter::GetStatistics() const noexcept
+{
+  const std::lock_guard lock{mutex};
+  Statistics result = statistics;
+  result.pending_bytes = pending.size();
+  return result;
+}
+
+void
+AsyncLogWriter::Run() noexcept
+{
+  std::vector<std::byte> batch;
+  batch.reserve(BATCH_SIZE);
+
+  std::unique_lock lock{mutex};
+
+  while (true) {
+    if (pending.empty()) {
+      if (stop)
+        break;
+
+      cond.wait(lock);
+      continue;
+    }
+
+    if (!stop && !sync_requested && pending.size() < BATCH_SIZE) {
+      const auto remaining = pending_since + latency - Clock::now();
+      if (remaining > Clock::duration::zero()) {
+        cond.wait_for(lock, remaining);
+        continue;
+      }
+    }
+
+    pending.swap(batch);
+    sync_requested = false;
+    busy = true;
+    lock.unlock();
+
+    const auto start = Clock::now();
+    std::exception_ptr batch_error;
+
+    try {
+      const Profiler::Scope profile{write_zone};
+      file.Write(batch);
+      file.Sync();
+    } catch (...) {
+      batch_error = std::current_exception();
+    }
+
+    const auto duration = Clock::now() - start;
+    batch.clear();
+
+    lock.lock();
+    busy = false;
+
+    if (batch_error && !error)
+      error = std::move(batch_error);
+
+    ++statistics.batches;
+    statistics.max_write_duration = std::max(statistics.max_write_duration,
+                                             duration);
+
+    done_cond.notify_all();
+  }
+}
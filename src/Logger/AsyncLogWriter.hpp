@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "io/OutputStream.hxx"
+#include "thread/Thread.hpp"
+#include "thread/Mutex.hxx"
+#include "thread/Cond.hxx"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+class FileOutputStream;
+
+/**
+ * An #OutputStream which appends to a #FileOutputStream in a
+ * dedicated thread.  Write() only copies the data into a memory
+ * buffer; the thread writes the buffer to the file in batches and
+ * syncs the file to storage after each batch.  A batch is written
+ * when the oldest data in the buffer has waited for the latency
+ * budget, when the buffer grows large, or when Sync() is called.
+ *
+ * Errors are reported by the next Write() or Sync() call.
+ */
+class AsyncLogWriter final : public OutputStream, Thread {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Statistics {
+    /**
+     * The number of bytes waiting to be written.
+     */
+    std::size_t pending_bytes;
+
+    /**
+     * The largest value of #pending_bytes so far.
+     */
+    std::size_t max_pending_bytes;
+
+    /**
+     * The number of batches written to the file.
+     */
+    unsigned long batches;
+
+    /**
+     * The time it took to write and sync the slowest batch.
+     */
+    Clock::duration max_write_duration;
+  };
+
+private:
+  /**
+   * Write a batch before the latency budget expires when this many
+   * bytes are waiting.
+   */
+  static constexpr std::size_t BATCH_SIZE = 16 * 1024;
+
+  /**
+   * Write() blocks while this many bytes are waiting; this happens
+   * only if the storage is much slower than the data rate.
+   */
+  static constexpr std::size_t MAX_PENDING = 256 * 1024;
+
+  FileOutputStream &file;
+
+  const Clock::duration latency;
+
+  mutable Mutex mutex;
+
+  /**
+   * Wakes up the thread.
+   */
+  Cond cond;
+
+  /**
+   * Signalled by the thread after each batch.
+   */
+  Cond done_cond;
+
+  std::vector<std::byte> pending;
+
+  /**
+   * When did the oldest byte in #pending arrive?
+   */
+  Clock::time_point pending_since;
+
+  bool busy = false, sync_requested = false, stop = false;
+
+  std::exception_ptr error;
+
+  Statistics statistics{};
+
+public:
+  /**
+   * Throws on error.
+   *
+   * @param latency the maximum time data may stay in memory before
+   * it is written and synced
+   */
+  AsyncLogWriter(FileOutputStream &_file, Clock::duration _latency);
+
+  /**
+   * Writes the remaining data (ignoring errors) and stops the thread.
+   */
+  ~AsyncLogWriter() noexcept;
+
+  AsyncLogWriter(const AsyncLogWriter &) = delete;
+  AsyncLogWriter &operator=(const AsyncLogWriter &) = delete;
+
+  /* virtual methods from class OutputStream */
+  void Write(std::span<const std::byte> src) override;
+
+  /**
+   * Write all data passed to Write() to the file, and wait until it
+   * has been synced.
+   *
+   * Throws on error.
+   */
+  void Sync();
+
+  [[gnu::pure]]
+  Statistics GetStatistics() const noexcept;
+
+private:
+  void RethrowError();
+
+  /* virtual methods from class Thread */
+  void Run() noexcept override;
+};
@@ -10,6 +10,8 @@
 #include "system/Path.hpp"
 #include "util/Macros.hpp"
 
+#include <array>
+#include <span>
 #include <stdexcept>
 
 #include <string.h>
@@ -50,27 +52,34 @@ GRecord::AppendRecordToBuffer(std::string_view in) noexcept
   return true;
 }
 
-/**
- * @param ignore_comma if true, then the comma is ignored, even though
- * it's a valid IGC character
- */
-static void
-AppendIGCString(MD5 &md5, std::string_view s, bool ignore_comma) noexcept
+void
+GRecord::AppendStringToBuffer(std::string_view in) noexcept
 {
-  for (const char ch : s) {
+  /* filter the record only once and feed the valid characters to
+     all MD5 instances in chunks */
+  std::array<std::byte, 256> chunk;
+  std::size_t n = 0;
+
+  const auto flush = [this, &chunk, &n]() noexcept {
+    for (auto &i : md5)
+      i.Append(std::span{chunk}.first(n));
+    n = 0;
+  };
+
+  for (const char ch : in) {
     if (ignore_comma && ch == ',')
       continue;
 
-    if (IsValidIGCChar(ch))
-      md5.Append(static_cast<std::byte>(ch));
+    if (!IsValidIGCChar(ch))
+      continue;
+
+    chunk[n++] = static_cast<std::byte>(ch);
+    if (n == chunk.size())
+      flush();
   }
-}
 
-void
-GRecord::AppendStringToBuffer(std::string_view in) noexcept
-{
-  for (auto &i : md5)
-    AppendIGCString(i, in, ignore_comma);
+  if (n > 0)
+    flush();
 }
 
 void
@@ -169,17 +178,28 @@ GRecord::ReadGRecordFromFile(Path path,
 }
 
 void
-GRecord::VerifyGRecordInFile(Path path)
+GRecord::Verify(NLineReader &reader)
 {
-  // assumes FileName member is set
-  // Load File into Buffer (assume name is already set)
-  LoadFileToBuffer(path);
-
-  // load Existing Digest "old"
+  /* hash the records and collect the G record in one pass */
   char old_g_record[DIGEST_LENGTH + 1];
-  ReadGRecordFromFile(path, old_g_record, ARRAY_SIZE(old_g_record));
+  std::size_t old_length = 0;
+
+  char *line;
+  while ((line = reader.ReadLine()) != nullptr) {
+    if (line[0] != 'G') {
+      AppendRecordToBuffer(line);
+      continue;
+    }
+
+    for (const char *p = line + 1; *p != '\0'; ++p) {
+      old_g_record[old_length++] = *p;
+      if (old_length >= ARRAY_SIZE(old_g_record))
+        throw std::runtime_error("G record too large");
+    }
+  }
+
+  old_g_record[old_length] = '\0';
 
-  // recalculate digest from buffer
   FinalizeBuffer();
 
   char new_g_record[DIGEST_LENGTH + 1];
@@ -188,3 +208,10 @@ GRecord::VerifyGRecordInFile(Path path)
   if (strcmp(old_g_record, new_g_record) != 0)
     throw std::runtime_error("Invalid G record");
 }
+
+void
+GRecord::VerifyGRecordInFile(Path path)
+{
+  FileLineReaderA reader(path);
+  Verify(reader);
+}
@@ -11,6 +11,7 @@
 
 class Path;
 class BufferedOutputStream;
+class NLineReader;
 
 class GRecord
 {
@@ -76,6 +77,17 @@ public:
   static void ReadGRecordFromFile(Path path,
                                   char *buffer, size_t max_length);
 
+  /**
+   * Read an IGC file from the given reader, calculate its digest and
+   * compare it with the G record in it.  Unlike calling
+   * LoadFileToBuffer() and ReadGRecordFromFile(), this needs only one
+   * pass over the file.  Initialize() must have been called.
+   *
+   * Throws std::runtime_errror on error or if the G record does not
+   * match.
+   */
+  void Verify(NLineReader &reader);
+
   /**
    * Throws std::runtime_errror on error.
    */
@@ -70,10 +70,15 @@ LoggerImpl::StopLogger([[maybe_unused]] const NMEAInfo &gps_info)
   if (!simulator)
     writer->Sign();
 
-  writer->Flush();
+  writer->Sync();
 
   LogFormat(_T("Logger stopped: %s"), filename.c_str());
 
+  const auto statistics = writer->GetWriterStatistics();
+  LogFormat("IGC writer: %lu batches, max %zu bytes pending, slowest write %u ms",
+            statistics.batches, statistics.max_pending_bytes,
+            (unsigned)std::chrono::duration_cast<std::chrono::milliseconds>(statistics.max_write_duration).count());
+
   // Logger off
   writer.reset();
 
@@ -191,7 +196,7 @@ LoggerImpl::WritePoint(const NMEAInfo &gps_info)
 
 bool
 LoggerImpl::StartLogger(const NMEAInfo &gps_info,
-                        [[maybe_unused]] const LoggerSettings &settings,
+                        const LoggerSettings &settings,
                         const char *logger_id)
 {
   assert(logger_id != nullptr);
@@ -220,7 +225,7 @@ LoggerImpl::StartLogger(const NMEAInfo &gps_info,
   frecord.Reset();
 
   try {
-    writer = std::make_unique<IGCWriter>(filename);
+    writer = std::make_unique<IGCWriter>(filename, settings.sync_interval);
   } catch (...) {
     LogError(std::current_exception());
     return false;
@@ -2,6 +2,7 @@
 // Copyright The XCSoar Project
 
 #include "Logger/NMEALogger.hpp"
+#include "Logger/AsyncLogWriter.hpp"
 #include "io/FileOutputStream.hxx"
 #include "LocalPath.hpp"
 #include "time/BrokenDateTime.hpp"
@@ -9,13 +10,19 @@
 #include "util/SpanCast.hxx"
 #include "util/StaticString.hxx"
 
+/**
+ * The NMEA log is a debugging aid; it does not need to be synced as
+ * often as the IGC file.
+ */
+static constexpr auto SYNC_INTERVAL = std::chrono::seconds{10};
+
 NMEALogger::NMEALogger() noexcept {}
 NMEALogger::~NMEALogger() noexcept = default;
 
 inline void
 NMEALogger::Start()
 {
-  if (file != nullptr)
+  if (writer != nullptr)
     return;
 
   BrokenDateTime dt = BrokenDateTime::NowUTC();
@@ -31,6 +38,7 @@ NMEALogger::Start()
   const auto path = AllocatedPath::Build(logs_path, name);
   file = std::make_unique<FileOutputStream>(path,
                                             FileOutputStream::Mode::APPEND_OR_CREATE);
+  writer = std::make_unique<AsyncLogWriter>(*file, SYNC_INTERVAL);
 }
 
 static void
@@ -52,7 +60,7 @@ NMEALogger::Log(const char *text) noexcept
 
   try {
     Start();
-    WriteLine(*file, text);
+    WriteLine(*writer, text);
   } catch (...) {
   }
 }
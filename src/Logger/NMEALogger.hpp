@@ -8,10 +8,16 @@
 #include <memory>
 
 class FileOutputStream;
+class AsyncLogWriter;
 
+/**
+ * Writes all received NMEA lines to a file.  The file is written by
+ * an #AsyncLogWriter, therefore Log() does not block on storage I/O.
+ */
 class NMEALogger {
   Mutex mutex;
   std::unique_ptr<FileOutputStream> file;
+  std::unique_ptr<AsyncLogWriter> writer;
 
   bool enabled = false;
 
@@ -27,6 +27,12 @@ struct LoggerSettings {
   /** Logger interval in circling mode */
   std::chrono::duration<unsigned> time_step_circling;
 
+  /**
+   * The maximum time logged records may stay in memory before they
+   * are written to the file and synced to storage.
+   */
+  std::chrono::duration<unsigned> sync_interval;
+
   enum class AutoLogger: uint8_t {
     ON,
     START_ONLY,
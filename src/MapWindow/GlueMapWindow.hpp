@@ -205,6 +205,9 @@ public:
 protected:
   /* virtual methods from class MapWindow */
   void Render(Canvas &canvas, const PixelRect &rc) noexcept override;
+  void OnRaspLoaded() noexcept override {
+    InjectRedraw();
+  }
   void DrawThermalEstimate(Canvas &canvas) const noexcept override;
   void RenderTrail(Canvas &canvas,
                    const PixelPoint aircraft_pos) noexcept override;
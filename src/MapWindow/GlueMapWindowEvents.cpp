@@ -14,6 +14,7 @@
 #include "Asset.hpp"
 #include "Components.hpp"
 #include "BackendComponents.hpp"
+#include "Profiler/Profiler.hpp"
 
 #ifdef USE_X11
 #include "ui/event/Globals.hpp"
@@ -437,13 +438,15 @@ GlueMapWindow::OnKineticTimer() noexcept
 
 #endif
 
+static constinit Profiler::Zone glue_misc_zone{"DrawGlueMisc"};
+
 void
 GlueMapWindow::Render(Canvas &canvas, const PixelRect &rc) noexcept
 {
   MapWindow::Render(canvas, rc);
 
   if (IsNearSelf()) {
-    draw_sw.Mark("DrawGlueMisc");
+    const Profiler::Scope profile{glue_misc_zone};
     if (GetMapSettings().show_thermal_profile)
       DrawThermalBand(canvas, rc);
     DrawStallRatio(canvas, rc);
@@ -9,11 +9,14 @@
 #include "Terrain/RasterTerrain.hpp"
 #include "Weather/Rasp/RaspRenderer.hpp"
 #include "Computer/GlideComputer.hpp"
+#include "Profiler/Profiler.hpp"
 
 #ifdef ENABLE_OPENGL
 #include "ui/canvas/opengl/Scissor.hpp"
 #endif
 
+static constinit Profiler::Zone paint_zone{"MapWindow"};
+
 /**
  * Constructor of the MapWindow class
  */
@@ -121,8 +124,8 @@ MapWindow::OnPaintBuffer(Canvas &canvas) noexcept
 #endif
 
     // Render the moving map
+    const Profiler::Scope profile{paint_zone};
     Render(canvas, GetClientRect());
-    draw_sw.Finish();
   }
 
 #ifndef ENABLE_OPENGL
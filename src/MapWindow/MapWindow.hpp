@@ -10,7 +10,6 @@
 #include "ui/canvas/BufferCanvas.hpp"
 #endif
 #include "Renderer/LabelBlock.hpp"
-#include "Screen/StopWatch.hpp"
 #include "MapWindowBlackboard.hpp"
 #include "Renderer/AirspaceLabelRenderer.hpp"
 #include "Renderer/BackgroundRenderer.hpp"
@@ -160,12 +159,6 @@ protected:
   unsigned scale_buffer = 0;
 #endif
 
-  /**
-   * The #StopWatch used to benchmark the DrawThread,
-   * i.e. OnPaintBuffer().
-   */
-  ScreenStopWatch draw_sw;
-
   friend class DrawThread;
 
 public:
@@ -306,6 +299,12 @@ protected:
    */
   virtual void Render(Canvas &canvas, const PixelRect &rc) noexcept;
 
+  /**
+   * Called by the RASP loader thread after new weather maps have
+   * been loaded.  Implementations must be thread-safe.
+   */
+  virtual void OnRaspLoaded() noexcept {}
+
   unsigned UpdateTopography(unsigned max_update=1024) noexcept;
 
   /**
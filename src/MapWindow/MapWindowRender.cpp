@@ -9,13 +9,30 @@
 #include "Topography/CachedTopographyRenderer.hpp"
 #include "Renderer/AircraftRenderer.hpp"
 #include "Renderer/WaveRenderer.hpp"
-#include "Operation/Operation.hpp"
 #include "Tracking/SkyLines/Data.hpp"
+#include "Profiler/Profiler.hpp"
 
 #ifdef HAVE_NOAA
 #include "Weather/NOAAStore.hpp"
 #endif
 
+static constinit Profiler::Zone terrain_zone{"RenderTerrain"};
+static constinit Profiler::Zone rasp_zone{"RenderRasp"};
+static constinit Profiler::Zone topography_zone{"RenderTopography"};
+static constinit Profiler::Zone overlays_zone{"RenderOverlays"};
+static constinit Profiler::Zone noaa_zone{"DrawNOAAStations"};
+static constinit Profiler::Zone final_glide_zone{"RenderFinalGlideShading"};
+static constinit Profiler::Zone airspace_zone{"RenderAirspace"};
+static constinit Profiler::Zone contest_zone{"DrawContest"};
+static constinit Profiler::Zone task_zone{"DrawTask"};
+static constinit Profiler::Zone waypoints_zone{"DrawWaypoints"};
+static constinit Profiler::Zone trail_zone{"RenderTrail"};
+static constinit Profiler::Zone topography_labels_zone{"RenderTopographyLabels"};
+static constinit Profiler::Zone glide_zone{"RenderGlide"};
+static constinit Profiler::Zone misc1_zone{"RenderMisc1"};
+static constinit Profiler::Zone track_bearing_zone{"DrawTrackBearing"};
+static constinit Profiler::Zone misc2_zone{"RenderMisc2"};
+
 void
 MapWindow::RenderTrackBearing(Canvas &canvas,
                               const PixelPoint aircraft_pos) noexcept
@@ -54,15 +71,13 @@ MapWindow::RenderRasp(Canvas &canvas) noexcept
 #ifndef ENABLE_OPENGL
     const std::lock_guard lock{mutex};
 #endif
-    rasp_renderer.reset(new RaspRenderer(*rasp_store, state.map));
+    rasp_renderer.reset(new RaspRenderer(*rasp_store, state.map,
+                                         [this]{ OnRaspLoaded(); }));
   }
 
   rasp_renderer->SetTime(state.time);
-
-  {
-    QuietOperationEnvironment operation;
-    rasp_renderer->Update(Calculated().date_time_local, operation);
-  }
+  rasp_renderer->SetInterpolate(state.interpolate);
+  rasp_renderer->Update(Calculated().date_time_local);
 
   const auto &terrain_settings = GetMapSettings().terrain;
   if (rasp_renderer->Generate(render_projection, terrain_settings))
@@ -187,46 +202,47 @@ MapWindow::Render(Canvas &canvas, const PixelRect &rc) noexcept
   //////////////////////////////////////////////// items on ground
 
   // Render terrain, groundline and topography
-  draw_sw.Mark("RenderTerrain");
+  Profiler::Scope profile{terrain_zone};
   RenderTerrain(canvas);
 
-  draw_sw.Mark("RenderRasp");
+  profile.Next(rasp_zone);
   RenderRasp(canvas);
 
-  draw_sw.Mark("RenderTopography");
+  profile.Next(topography_zone);
   RenderTopography(canvas);
 
-  draw_sw.Mark("RenderOverlays");
+  profile.Next(overlays_zone);
   RenderOverlays(canvas);
 
-  draw_sw.Mark("DrawNOAAStations");
+  profile.Next(noaa_zone);
   RenderNOAAStations(canvas);
 
   //////////////////////////////////////////////// glide range info
 
-  draw_sw.Mark("RenderFinalGlideShading");
+  profile.Next(final_glide_zone);
   RenderFinalGlideShading(canvas);
 
   //////////////////////////////////////////////// airspace
 
   // Render airspace
-  draw_sw.Mark("RenderAirspace");
+  profile.Next(airspace_zone);
   RenderAirspace(canvas);
 
   //////////////////////////////////////////////// task
 
   // Render task, waypoints
-  draw_sw.Mark("DrawContest");
+  profile.Next(contest_zone);
   DrawContest(canvas);
 
-  draw_sw.Mark("DrawTask");
+  profile.Next(task_zone);
   DrawTask(canvas);
 
-  draw_sw.Mark("DrawWaypoints");
+  profile.Next(waypoints_zone);
   DrawWaypoints(canvas);
 
   //////////////////////////////////////////////// aircraft level items
   // Render the snail trail
+  profile.Next(trail_zone);
   RenderTrail(canvas, aircraft_pos);
 
   DrawWaves(canvas);
@@ -236,23 +252,23 @@ MapWindow::Render(Canvas &canvas, const PixelRect &rc) noexcept
 
   //////////////////////////////////////////////// text items
   // Render topography on top of airspace, to keep the text readable
-  draw_sw.Mark("RenderTopographyLabels");
+  profile.Next(topography_labels_zone);
   RenderTopographyLabels(canvas);
 
   //////////////////////////////////////////////// navigation overlays
   // Render glide through terrain range
-  draw_sw.Mark("RenderGlide");
+  profile.Next(glide_zone);
   RenderGlide(canvas);
 
-  draw_sw.Mark("RenderMisc1");
+  profile.Next(misc1_zone);
   // Render weather/terrain max/min values
   DrawTaskOffTrackIndicator(canvas);
 
   // Render track bearing (projected track ground/air relative)
-  draw_sw.Mark("DrawTrackBearing");
+  profile.Next(track_bearing_zone);
   RenderTrackBearing(canvas, aircraft_pos);
 
-  draw_sw.Mark("RenderMisc2");
+  profile.Next(misc2_zone);
   DrawBestCruiseTrack(canvas, aircraft_pos);
 
   // Draw wind vector at aircraft
@@ -76,6 +76,8 @@ DerivedInfo::Reset()
   airspace_warnings.Clear();
 
   planned_route.clear();
+
+  stage_timing.Clear();
 }
 
 void
@@ -24,6 +24,7 @@
 #include "Atmosphere/Pressure.hpp"
 #include "Engine/Route/Route.hpp"
 #include "Computer/WaveResult.hpp"
+#include "Computer/StageTiming.hpp"
 
 #include <type_traits>
 
@@ -236,6 +237,9 @@ struct DerivedInfo:
    */
   double next_leg_eq_thermal;
 
+  /** Execution time of the #GlideComputer stages */
+  StageTimingInfo stage_timing;
+
   /**
    * @todo Reset to cleared state
    */
@@ -15,6 +15,13 @@ class NMEAInputLine: public CSVLine {
 public:
   explicit NMEAInputLine(const char* line) noexcept;
 
+  /**
+   * Construct an instance for a range which has already been split
+   * (e.g. by #NMEASentence); it must not include the checksum.
+   */
+  constexpr NMEAInputLine(const char *_data, const char *_end) noexcept
+    :CSVLine(_data, _end) {}
+
   /**
    * Parses non-negative floating-point angle value in degrees.
    */
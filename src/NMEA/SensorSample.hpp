@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "Math/Angle.hpp"
+#include "time/Stamp.hpp"
+
+#include <vector>
+
+/**
+ * One attitude record received from an AHRS.  Fields which were not
+ * part of the record are flagged as unavailable.
+ */
+struct AttitudeSample {
+  /** the reception time (NMEAInfo::clock) */
+  TimeStamp time;
+
+  Angle bank_angle, pitch_angle, heading;
+
+  bool bank_angle_available, pitch_angle_available, heading_available;
+};
+
+struct AccelerationSample {
+  /** the reception time (NMEAInfo::clock) */
+  TimeStamp time;
+
+  double g_load;
+};
+
+struct VarioSample {
+  /** the reception time (NMEAInfo::clock) */
+  TimeStamp time;
+
+  /** total energy vario [m/s] */
+  double total_energy_vario;
+};
+
+/**
+ * All sensor samples which have been received since the last
+ * calculation, oldest first.  The samples come from only one device
+ * per stream (the same priority as NMEAInfo::Complement() uses), so
+ * different sources are never interleaved.
+ */
+struct SensorSampleBatch {
+  std::vector<AttitudeSample> attitude;
+  std::vector<AccelerationSample> acceleration;
+  std::vector<VarioSample> vario;
+
+  /**
+   * Clear the batch, but keep the allocated memory.
+   */
+  void Clear() noexcept {
+    attitude.clear();
+    acceleration.clear();
+    vario.clear();
+  }
+};
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "SensorStreams.hpp"
+#include "Info.hpp"
+
+/**
+ * A validity marker which no parser writes: it is the smallest
+ * non-zero time stamp, and NMEAInfo::clock is far beyond that.
+ */
+static constexpr Validity UNTOUCHED{TimeStamp{FloatDuration{1. / 64}}};
+
+static_assert(UNTOUCHED.IsValid());
+
+/**
+ * Replace the validity with #UNTOUCHED and return the old one.
+ */
+static constexpr Validity
+Mark(Validity &v) noexcept
+{
+  const Validity old = v;
+  v = UNTOUCHED;
+  return old;
+}
+
+/**
+ * If the validity is still #UNTOUCHED, restore the saved value and
+ * return false.  Otherwise, return true if it was updated (and false
+ * if it was cleared).
+ */
+static constexpr bool
+Check(Validity &v, Validity saved) noexcept
+{
+  if (v == UNTOUCHED) {
+    v = saved;
+    return false;
+  }
+
+  return v.IsValid();
+}
+
+void
+SensorStreams::BeginCapture(NMEAInfo &info) noexcept
+{
+  saved_bank_angle_available = Mark(info.attitude.bank_angle_available);
+  saved_pitch_angle_available = Mark(info.attitude.pitch_angle_available);
+  saved_heading_available = Mark(info.attitude.heading_available);
+  saved_vario_available = Mark(info.total_energy_vario_available);
+
+  saved_acceleration = info.acceleration;
+  info.acceleration.available = false;
+}
+
+void
+SensorStreams::EndCapture(NMEAInfo &info) noexcept
+{
+  AttitudeSample a;
+  a.time = info.clock;
+  a.bank_angle = info.attitude.bank_angle;
+  a.pitch_angle = info.attitude.pitch_angle;
+  a.heading = info.attitude.heading;
+  a.bank_angle_available = Check(info.attitude.bank_angle_available,
+                                 saved_bank_angle_available);
+  a.pitch_angle_available = Check(info.attitude.pitch_angle_available,
+                                  saved_pitch_angle_available);
+  a.heading_available = Check(info.attitude.heading_available,
+                              saved_heading_available);
+  if (a.bank_angle_available || a.pitch_angle_available ||
+      a.heading_available)
+    Push(attitude, a);
+
+  if (info.acceleration.available)
+    Push(acceleration, {info.clock, info.acceleration.g_load});
+  else
+    info.acceleration = saved_acceleration;
+
+  if (Check(info.total_energy_vario_available, saved_vario_available))
+    Push(vario, {info.clock, info.total_energy_vario});
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "SensorSample.hpp"
+#include "Attitude.hpp"
+#include "Acceleration.hpp"
+#include "Validity.hpp"
+#include "util/SPSCRing.hpp"
+
+#include <atomic>
+#include <vector>
+
+struct NMEAInfo;
+
+/**
+ * Per-device queues of high-rate sensor samples (attitude,
+ * acceleration, total energy vario).  NMEAInfo only holds the latest
+ * value, which is what survives until the calculation thread copies
+ * the blackboard; these queues keep every sample received in the
+ * meantime.
+ *
+ * The producer is the thread which parses the device's data (one per
+ * device), the consumer is the calculation thread.  Neither of them
+ * needs to lock the #DeviceBlackboard to access the queues.
+ */
+class SensorStreams {
+  /**
+   * Enough for more than one second of 100 Hz data, which covers
+   * the calculation thread's period.
+   */
+  static constexpr std::size_t CAPACITY = 128;
+
+  SPSCRing<AttitudeSample, CAPACITY> attitude;
+  SPSCRing<AccelerationSample, CAPACITY> acceleration;
+  SPSCRing<VarioSample, CAPACITY> vario;
+
+  /**
+   * The number of samples which were discarded because the consumer
+   * did not keep up.
+   */
+  std::atomic<unsigned> n_dropped{0};
+
+  /* producer state for BeginCapture() and EndCapture() */
+  Validity saved_bank_angle_available, saved_pitch_angle_available,
+    saved_heading_available, saved_vario_available;
+  AccelerationState saved_acceleration;
+
+public:
+  /**
+   * Producer: call this before data is written into the given
+   * #NMEAInfo (e.g. before parsing one NMEA line).  It replaces the
+   * validity of the sensor fields with markers, so EndCapture() can
+   * tell which of them were written, even if the clock has not
+   * advanced since the previous sample.
+   */
+  void BeginCapture(NMEAInfo &info) noexcept;
+
+  /**
+   * Producer: queue all sensor fields which were written since
+   * BeginCapture(), and restore the validity of the others.
+   */
+  void EndCapture(NMEAInfo &info) noexcept;
+
+  /**
+   * Consumer: remove all attitude samples and append them to the
+   * given vector (or discard them if it is nullptr).
+   *
+   * @return the number of samples
+   */
+  std::size_t ConsumeAttitude(std::vector<AttitudeSample> *dest) noexcept {
+    return Consume(attitude, dest);
+  }
+
+  std::size_t ConsumeAcceleration(std::vector<AccelerationSample> *dest) noexcept {
+    return Consume(acceleration, dest);
+  }
+
+  std::size_t ConsumeVario(std::vector<VarioSample> *dest) noexcept {
+    return Consume(vario, dest);
+  }
+
+  /**
+   * Consumer: remove all samples.
+   */
+  void Discard() noexcept {
+    ConsumeAttitude(nullptr);
+    ConsumeAcceleration(nullptr);
+    ConsumeVario(nullptr);
+  }
+
+  unsigned GetDropped() const noexcept {
+    return n_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  template<typename T>
+  void Push(SPSCRing<T, CAPACITY> &ring, const T &sample) noexcept {
+    if (!ring.Push(sample))
+      n_dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  static std::size_t Consume(SPSCRing<T, CAPACITY> &ring,
+                             std::vector<T> *dest) noexcept {
+    if (dest == nullptr)
+      return ring.Consume([](const T &){});
+
+    return ring.Consume([dest](const T &sample){
+      dest->push_back(sample);
+    });
+  }
+};
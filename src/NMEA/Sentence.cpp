@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Sentence.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+
+NMEASentence::NMEASentence(const char *line) noexcept
+  :begin(line), type_end(nullptr), fields_end(nullptr)
+{
+  assert(line != nullptr);
+
+  const char *p = line;
+
+  /* skip the dollar sign at the beginning (the exclamation mark is
+     used by CAI302) */
+  if (*p == '$' || *p == '!')
+    ++p;
+
+  /* the checksum covers everything up to the last asterisk; it is
+     accumulated in one pass together with the positions of the first
+     comma and the first and last asterisk */
+  uint8_t checksum = 0, checksum_at_asterisk = 0;
+  const char *last_asterisk = nullptr;
+
+  for (; *p != 0; ++p) {
+    const char ch = *p;
+    if (ch == '*') {
+      if (fields_end == nullptr)
+        fields_end = p;
+      last_asterisk = p;
+      checksum_at_asterisk = checksum;
+    } else if (ch == ',' && type_end == nullptr && fields_end == nullptr)
+      type_end = p;
+
+    checksum ^= static_cast<uint8_t>(ch);
+  }
+
+  if (fields_end == nullptr)
+    fields_end = p;
+
+  if (type_end == nullptr)
+    type_end = fields_end;
+
+  if (last_asterisk == nullptr) {
+    checksum_valid = false;
+    return;
+  }
+
+  const char *checksum_string = last_asterisk + 1;
+  char *endptr;
+  const unsigned long value = strtoul(checksum_string, &endptr, 16);
+  checksum_valid = endptr != checksum_string && *endptr == 0 &&
+    value == checksum_at_asterisk;
+}
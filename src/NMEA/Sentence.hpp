@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "InputLine.hpp"
+
+#include <string_view>
+
+/**
+ * Splits a NMEA sentence into its type, its fields and the checksum
+ * in one pass over the string, and verifies the checksum while doing
+ * so.  This replaces the sequence VerifyNMEAChecksum(), NMEAInputLine
+ * constructor and NMEAInputLine::ReadView(), which scanned the line
+ * three times.
+ *
+ * The object keeps pointers into the given string; it must remain
+ * valid as long as this object and the #NMEAInputLine obtained from
+ * it are used.
+ */
+class NMEASentence {
+  /**
+   * The beginning of the sentence, i.e. the dollar sign.
+   */
+  const char *begin;
+
+  /**
+   * The end of the sentence type, i.e. the first comma or
+   * #fields_end.
+   */
+  const char *type_end;
+
+  /**
+   * The end of the last field, i.e. the first asterisk or the null
+   * terminator.
+   */
+  const char *fields_end;
+
+  bool checksum_valid;
+
+public:
+  explicit NMEASentence(const char *line) noexcept;
+
+  /**
+   * Returns the first column, e.g. "$GPRMC".
+   */
+  std::string_view GetType() const noexcept {
+    return {begin, std::size_t(type_end - begin)};
+  }
+
+  /**
+   * Was there a well-formed checksum after the last asterisk, and
+   * does it match the contents?  This is equivalent to
+   * VerifyNMEAChecksum().
+   */
+  bool IsChecksumValid() const noexcept {
+    return checksum_valid;
+  }
+
+  /**
+   * Returns a #NMEAInputLine which is positioned after the sentence
+   * type and ends before the checksum.
+   */
+  NMEAInputLine GetLine() const noexcept {
+    return {type_end < fields_end ? type_end + 1 : fields_end, fields_end};
+  }
+};
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+template<typename T>
+struct NMEASentenceEntry {
+  std::string_view id;
+  T value;
+};
+
+/**
+ * A map from NMEA sentence identifiers (e.g. "$PFLAU") to a value
+ * (usually an enum for a switch statement), implemented as a perfect
+ * hash table which is built at compile time.  A lookup costs one hash
+ * over the identifier and at most one string comparison, regardless
+ * of the number of entries.
+ *
+ * Use MakeNMEASentenceTable() to construct an instance.
+ */
+template<typename T, std::size_t N>
+class NMEASentenceTable {
+  /**
+   * A sparse table makes it easy to find a collision-free seed.
+   */
+  static constexpr std::size_t SIZE = std::bit_ceil(N * 4);
+
+  struct Slot {
+    std::string_view id;
+    T value{};
+  };
+
+  std::array<Slot, SIZE> slots{};
+
+  uint32_t seed = 0;
+
+  /**
+   * A seeded FNV-1a hash.
+   */
+  static constexpr std::size_t Hash(std::string_view id,
+                                    uint32_t seed) noexcept {
+    uint32_t h = 2166136261U ^ seed;
+    for (char ch : id) {
+      h ^= static_cast<uint8_t>(ch);
+      h *= 16777619U;
+    }
+
+    return h & (SIZE - 1);
+  }
+
+  constexpr bool TryBuild(const NMEASentenceEntry<T> (&entries)[N]) noexcept {
+    slots = {};
+
+    for (const auto &i : entries) {
+      Slot &slot = slots[Hash(i.id, seed)];
+      if (!slot.id.empty())
+        return false;
+
+      slot.id = i.id;
+      slot.value = i.value;
+    }
+
+    return true;
+  }
+
+public:
+  consteval NMEASentenceTable(const NMEASentenceEntry<T> (&entries)[N]) {
+    for (const auto &i : entries)
+      if (i.id.empty())
+        throw "Empty NMEA sentence identifier";
+
+    while (!TryBuild(entries))
+      if (++seed == 0x10000)
+        throw "No perfect hash found";
+  }
+
+  /**
+   * @return a pointer to the value or nullptr if the identifier is
+   * not in the table
+   */
+  [[gnu::pure]]
+  constexpr const T *Find(std::string_view id) const noexcept {
+    const Slot &slot = slots[Hash(id, seed)];
+    return !slot.id.empty() && slot.id == id
+      ? &slot.value
+      : nullptr;
+  }
+};
+
+template<typename T, std::size_t N>
+consteval auto
+MakeNMEASentenceTable(const NMEASentenceEntry<T> (&entries)[N])
+{
+  return NMEASentenceTable<T, N>(entries);
+}
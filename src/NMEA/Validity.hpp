@@ -61,6 +61,14 @@ public:
     last = Import(now);
   }
 
+  /**
+   * Returns the time stamp of the last Update() call, with a
+   * resolution of 1/64 second.
+   */
+  constexpr TimeStamp GetTimeStamp() const noexcept {
+    return Export(last);
+  }
+
   /**
    * Cast this object to an integer.  This integer should only be used
    * for equality comparisons with other integers from this method,
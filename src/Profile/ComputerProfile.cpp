@@ -11,6 +11,8 @@
 #include "Map.hpp"
 #include "Computer/Settings.hpp"
 
+#include <iterator>
+
 namespace Profile {
   static void Load(const ProfileMap &map, WindSettings &settings);
   static void Load(const ProfileMap &map, PolarSettings &settings);
@@ -21,6 +23,7 @@ namespace Profile {
   static void Load(const ProfileMap &map, CirclingSettings &settings);
   static void Load(const ProfileMap &map, WaveSettings &settings);
   static void Load(const ProfileMap &map, WeGlideSettings &settings);
+  static void Load(const ProfileMap &map, StageBudgetSettings &settings);
 };
 
 void
@@ -49,6 +52,7 @@ Profile::Load(const ProfileMap &map, LoggerSettings &settings)
 {
   map.Get(ProfileKeys::LoggerTimeStepCruise, settings.time_step_cruise);
   map.Get(ProfileKeys::LoggerTimeStepCircling, settings.time_step_circling);
+  map.Get(ProfileKeys::LoggerSyncInterval, settings.sync_interval);
 
   if (!map.GetEnum(ProfileKeys::AutoLogger, settings.auto_logger)) {
     // Legacy
@@ -121,6 +125,28 @@ Profile::Load(const ProfileMap &map, WaveSettings &settings)
   map.Get(ProfileKeys::WaveAssistant, settings.enabled);
 }
 
+void
+Profile::Load(const ProfileMap &map, StageBudgetSettings &settings)
+{
+  static constexpr std::string_view keys[] = {
+    ProfileKeys::StageBudgetAirData,
+    ProfileKeys::StageBudgetTrace,
+    ProfileKeys::StageBudgetTask,
+    ProfileKeys::StageBudgetRoute,
+    ProfileKeys::StageBudgetCu,
+    ProfileKeys::StageBudgetStats,
+    ProfileKeys::StageBudgetMonitors,
+    ProfileKeys::StageBudgetContest,
+    ProfileKeys::StageBudgetWarning,
+    ProfileKeys::StageBudgetLog,
+  };
+
+  static_assert(std::size(keys) == NUM_COMPUTER_STAGES);
+
+  for (std::size_t i = 0; i < NUM_COMPUTER_STAGES; ++i)
+    map.Get(keys[i], settings.budget_ms[i]);
+}
+
 static bool
 LoadUTCOffset(const ProfileMap &map, RoughTimeDelta &value_r)
 {
@@ -173,4 +199,5 @@ Profile::Load(const ProfileMap &map, ComputerSettings &settings)
 #endif
 
   Load(map, settings.weather);
+  Load(map, settings.stage_budget);
 }
@@ -174,6 +174,7 @@ constexpr std::string_view EnableNavBaroAltitude = "EnableNavBaroAltitude";
 
 constexpr std::string_view LoggerTimeStepCruise = "LoggerTimeStepCruise";
 constexpr std::string_view LoggerTimeStepCircling = "LoggerTimeStepCircling";
+constexpr std::string_view LoggerSyncInterval = "LoggerSyncInterval";
 
 constexpr std::string_view SafetyMacCready = "SafetyMacCready";
 constexpr std::string_view AbortTaskMode = "AbortTaskMode";
@@ -282,6 +283,17 @@ constexpr std::string_view PagesDistinctZoom = "PagesDistinctZoom";
 
 constexpr std::string_view WaveAssistant = "WaveAssistant";
 
+constexpr std::string_view StageBudgetAirData = "StageBudgetAirData";
+constexpr std::string_view StageBudgetTrace = "StageBudgetTrace";
+constexpr std::string_view StageBudgetTask = "StageBudgetTask";
+constexpr std::string_view StageBudgetRoute = "StageBudgetRoute";
+constexpr std::string_view StageBudgetCu = "StageBudgetCu";
+constexpr std::string_view StageBudgetStats = "StageBudgetStats";
+constexpr std::string_view StageBudgetMonitors = "StageBudgetMonitors";
+constexpr std::string_view StageBudgetContest = "StageBudgetContest";
+constexpr std::string_view StageBudgetWarning = "StageBudgetWarning";
+constexpr std::string_view StageBudgetLog = "StageBudgetLog";
+
 constexpr std::string_view MasterAudioVolume = "MasterAudioVolume";
 
 constexpr std::string_view RaspFile = "RaspFile";
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "ChromeTrace.hpp"
+#include "Profiler.hpp"
+#include "io/BufferedOutputStream.hxx"
+
+namespace Profiler {
+
+void
+WriteChromeTrace(BufferedOutputStream &os)
+{
+  using Microseconds = std::chrono::duration<double, std::micro>;
+
+  const auto events = GetEvents();
+
+  os.Write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+  bool first = true;
+  for (const auto &event : events) {
+    if (!first)
+      os.Write(',');
+    first = false;
+
+    /* zone names are string literals without special characters,
+       they don't need to be escaped */
+    os.Fmt("\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},"
+           "\"ts\":{:.1f},\"dur\":{:.1f}}}",
+           event.zone->name, event.thread,
+           Microseconds(event.start - events.front().start).count(),
+           Microseconds(event.duration).count());
+  }
+
+  os.Write("\n]}\n");
+}
+
+} // namespace Profiler
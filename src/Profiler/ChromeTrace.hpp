@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+class BufferedOutputStream;
+
+namespace Profiler {
+
+/**
+ * Write the contents of the trace buffer in the Chrome "Trace Event
+ * Format" (JSON), which can be loaded into chrome://tracing or
+ * Perfetto.
+ *
+ * Throws on I/O error.
+ */
+void
+WriteChromeTrace(BufferedOutputStream &os);
+
+} // namespace Profiler
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Glue.hpp"
+#include "Profiler.hpp"
+#include "ChromeTrace.hpp"
+#include "LocalPath.hpp"
+#include "LogFile.hpp"
+#include "system/Path.hpp"
+#include "io/FileOutputStream.hxx"
+#include "io/BufferedOutputStream.hxx"
+
+AllocatedPath
+Profiler::Dump()
+{
+  for (const auto &i : GetStatistics())
+    LogFormat("Profiler '%s': count=%lu p50=%uus p95=%uus max=%uus",
+              i.name, (unsigned long)i.count, i.p50, i.p95, i.max);
+
+  auto path = LocalPath(_T("profile.json"));
+
+  FileOutputStream file(path);
+  BufferedOutputStream buffered(file);
+  WriteChromeTrace(buffered);
+  buffered.Flush();
+  file.Commit();
+
+  return path;
+}
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+class AllocatedPath;
+
+namespace Profiler {
+
+/**
+ * Write the zone statistics to the log file and the trace buffer to
+ * "profile.json" in the data directory.
+ *
+ * Throws on I/O error.
+ *
+ * @return the path of the trace file
+ */
+AllocatedPath
+Dump();
+
+} // namespace Profiler
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Profiler.hpp"
+#include "thread/Mutex.hxx"
+
+#include <algorithm>
+
+namespace Profiler {
+
+std::atomic_bool enabled{false};
+
+/**
+ * Protects all zones and the trace buffer.  Measurements are rare
+ * enough (a few hundred per second) that this lock is practically
+ * never contended.
+ */
+static Mutex mutex;
+
+/**
+ * Linked list of all zones which have recorded a measurement.
+ */
+static Zone *zones = nullptr, **zones_tail = &zones;
+
+static std::vector<Event> events;
+
+/**
+ * The position in #events where the next event will be written once
+ * the buffer is full.
+ */
+static std::size_t events_head = 0;
+
+static unsigned
+GetThreadIndex() noexcept
+{
+  static std::atomic_uint next_thread{1};
+  static thread_local const unsigned thread =
+    next_thread.fetch_add(1, std::memory_order_relaxed);
+  return thread;
+}
+
+void
+SetEnabled(bool _enabled) noexcept
+{
+  if (_enabled) {
+    const std::lock_guard lock{mutex};
+    /* allocate the whole trace buffer now, and not while
+       measuring */
+    events.reserve(MAX_EVENTS);
+  }
+
+  enabled.store(_enabled, std::memory_order_relaxed);
+}
+
+void
+Clear() noexcept
+{
+  const std::lock_guard lock{mutex};
+
+  for (Zone *zone = zones; zone != nullptr; zone = zone->next) {
+    zone->window_size = zone->window_head = 0;
+    zone->count = 0;
+  }
+
+  events.clear();
+  events_head = 0;
+}
+
+void
+Record(Zone &zone, Clock::time_point start, Clock::time_point end) noexcept
+{
+  using std::chrono::duration_cast, std::chrono::microseconds;
+
+  const auto duration = end - start;
+  const auto us = duration_cast<microseconds>(duration).count();
+  const unsigned thread = GetThreadIndex();
+
+  const std::lock_guard lock{mutex};
+
+  if (!zone.registered) {
+    zone.registered = true;
+    *zones_tail = &zone;
+    zones_tail = &zone.next;
+  }
+
+  zone.window[zone.window_head] =
+    std::clamp<decltype(us)>(us, 0, UINT_LEAST32_MAX);
+  zone.window_head = (zone.window_head + 1) % Zone::WINDOW;
+  if (zone.window_size < Zone::WINDOW)
+    ++zone.window_size;
+
+  ++zone.count;
+
+  const Event event{&zone, thread, start, duration};
+  if (events.size() < MAX_EVENTS)
+    events.push_back(event);
+  else {
+    events[events_head] = event;
+    events_head = (events_head + 1) % MAX_EVENTS;
+  }
+}
+
+std::vector<ZoneStatistics>
+GetStatistics() noexcept
+{
+  std::vector<ZoneStatistics> result;
+
+  const std::lock_guard lock{mutex};
+
+  for (const Zone *zone = zones; zone != nullptr; zone = zone->next) {
+    if (zone->window_size == 0)
+      continue;
+
+    std::array<uint_least32_t, Zone::WINDOW> sorted;
+    const auto begin = sorted.begin(), end = begin + zone->window_size;
+    std::copy_n(zone->window.begin(), zone->window_size, begin);
+    std::sort(begin, end);
+
+    const auto n = zone->window_size;
+    result.push_back({
+      zone->name,
+      zone->count,
+      begin[(n - 1) / 2],
+      begin[(n - 1) * 95 / 100],
+      end[-1],
+    });
+  }
+
+  return result;
+}
+
+std::vector<Event>
+GetEvents() noexcept
+{
+  const std::lock_guard lock{mutex};
+
+  std::vector<Event> result;
+  result.reserve(events.size());
+  result.insert(result.end(), events.begin() + events_head, events.end());
+  result.insert(result.end(), events.begin(), events.begin() + events_head);
+  return result;
+}
+
+} // namespace Profiler
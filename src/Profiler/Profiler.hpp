@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A lightweight profiler which can be switched on at runtime.  Code
+ * declares a static #Zone for each operation to be measured, and
+ * wraps the operation in a #Scope.  While the profiler is disabled,
+ * a #Scope costs one relaxed atomic load.
+ *
+ * While it is enabled, each zone keeps a rolling window of recent
+ * durations (for percentiles), and all measurements are appended to
+ * a ring buffer which can be exported as a trace (see ChromeTrace.hpp).
+ */
+namespace Profiler {
+
+using Clock = std::chrono::steady_clock;
+
+extern std::atomic_bool enabled;
+
+[[gnu::pure]]
+inline bool
+IsEnabled() noexcept
+{
+  return enabled.load(std::memory_order_relaxed);
+}
+
+void
+SetEnabled(bool _enabled) noexcept;
+
+/**
+ * Discard all measurements.
+ */
+void
+Clear() noexcept;
+
+struct ZoneStatistics;
+
+/**
+ * A named operation whose durations are measured.  Instances must
+ * have static storage duration; they register themselves with the
+ * profiler when they record their first measurement.
+ */
+class Zone {
+  friend void Record(Zone &zone, Clock::time_point start,
+                     Clock::time_point end) noexcept;
+  friend void Clear() noexcept;
+  friend std::vector<ZoneStatistics> GetStatistics() noexcept;
+
+public:
+  /**
+   * The number of recent durations used to calculate percentiles.
+   */
+  static constexpr unsigned WINDOW = 256;
+
+  const char *const name;
+
+private:
+  Zone *next = nullptr;
+
+  bool registered = false;
+
+  /**
+   * Ring buffer of recent durations in microseconds.
+   */
+  std::array<uint_least32_t, WINDOW> window{};
+
+  unsigned window_size = 0, window_head = 0;
+
+  /**
+   * The total number of measurements since the last Clear().
+   */
+  uint_least64_t count = 0;
+
+public:
+  explicit constexpr Zone(const char *_name) noexcept
+    :name(_name) {}
+
+  Zone(const Zone &) = delete;
+  Zone &operator=(const Zone &) = delete;
+};
+
+void
+Record(Zone &zone, Clock::time_point start,
+       Clock::time_point end) noexcept;
+
+/**
+ * Measure the time from construction to destruction (or to Next())
+ * and record it in a #Zone.  This does nothing if the profiler was
+ * disabled at construction.
+ */
+class Scope {
+  Zone *zone;
+  Clock::time_point start;
+
+public:
+  explicit Scope(Zone &_zone) noexcept
+    :zone(IsEnabled() ? &_zone : nullptr)
+  {
+    if (zone != nullptr)
+      start = Clock::now();
+  }
+
+  ~Scope() noexcept {
+    if (zone != nullptr)
+      Record(*zone, start, Clock::now());
+  }
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+  /**
+   * Finish the current measurement and begin measuring another
+   * zone.  This allows timing a sequence of steps without nesting a
+   * block for each one.
+   */
+  void Next(Zone &_zone) noexcept {
+    if (zone == nullptr)
+      return;
+
+    const auto now = Clock::now();
+    Record(*zone, start, now);
+    zone = &_zone;
+    start = now;
+  }
+};
+
+struct ZoneStatistics {
+  const char *name;
+
+  /**
+   * The total number of measurements.
+   */
+  uint_least64_t count;
+
+  /**
+   * Percentiles and maximum of the recent durations in
+   * microseconds.
+   */
+  unsigned p50, p95, max;
+};
+
+/**
+ * Obtain the statistics of all zones which have recorded at least
+ * one measurement, in order of registration.
+ */
+std::vector<ZoneStatistics>
+GetStatistics() noexcept;
+
+/**
+ * One measurement in the trace buffer.
+ */
+struct Event {
+  const Zone *zone;
+
+  /**
+   * A small number identifying the thread which recorded the
+   * measurement.
+   */
+  unsigned thread;
+
+  Clock::time_point start;
+
+  Clock::duration duration;
+};
+
+/**
+ * The capacity of the trace buffer; older events are overwritten.
+ */
+static constexpr std::size_t MAX_EVENTS = 65536;
+
+/**
+ * Returns a copy of the trace buffer, oldest event first.
+ */
+std::vector<Event>
+GetEvents() noexcept;
+
+} // namespace Profiler
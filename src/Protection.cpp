@@ -9,6 +9,7 @@
 #include "Computer/GlideComputer.hpp"
 #include "CalculationThread.hpp"
 #include "MergeThread.hpp"
+#include "TargetOptimiserThread.hpp"
 #include "Blackboard/DeviceBlackboard.hpp"
 
 #include <cassert>
@@ -63,6 +64,13 @@ TriggerCalculatedUpdate() noexcept
   CommonInterface::main_window->SendCalculatedUpdate();
 }
 
+void
+TriggerTargetOptimiser() noexcept
+{
+  if (backend_components->target_optimiser_thread)
+    backend_components->target_optimiser_thread->Trigger();
+}
+
 void
 CreateCalculationThread() noexcept
 {
@@ -96,6 +104,10 @@ CreateCalculationThread() noexcept
 
   backend_components->calculation_thread = std::make_unique<CalculationThread>(device_blackboard, glide_computer);
   backend_components->calculation_thread->SetComputerSettings(CommonInterface::GetComputerSettings());
+
+  backend_components->target_optimiser_thread =
+    std::make_unique<TargetOptimiserThread>(device_blackboard,
+                                            *backend_components->protected_task_manager);
 }
 
 void
@@ -38,6 +38,13 @@ TriggerMapUpdate() noexcept;
 void
 TriggerCalculatedUpdate() noexcept;
 
+/**
+ * Called by the calculation thread after the slow calculations have
+ * been updated.  This wakes up the #TargetOptimiserThread.
+ */
+void
+TriggerTargetOptimiser() noexcept;
+
 void
 CreateCalculationThread() noexcept;
 
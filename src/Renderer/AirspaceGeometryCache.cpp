@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#ifdef ENABLE_OPENGL
+
+#include "AirspaceGeometryCache.hpp"
+#include "Airspace/Airspaces.hpp"
+#include "Airspace/AbstractAirspace.hpp"
+#include "Geo/GeoBounds.hpp"
+#include "ui/canvas/opengl/Buffer.hpp"
+#include "ui/canvas/opengl/Triangulate.hpp"
+
+#include <algorithm>
+#include <vector>
+
+AirspaceGeometryCache::AirspaceGeometryCache() noexcept = default;
+AirspaceGeometryCache::~AirspaceGeometryCache() noexcept = default;
+
+static FloatPoint2D
+ToFloat(const GeoPoint &p, const GeoPoint &reference) noexcept
+{
+  const GeoPoint delta = p - reference;
+  return {float(delta.longitude.Native()), float(delta.latitude.Native())};
+}
+
+void
+AirspaceGeometryCache::Update(const Airspaces &_airspaces) noexcept
+{
+  if (buffer != nullptr && airspaces == &_airspaces &&
+      serial == _airspaces.GetSerial())
+    return;
+
+  airspaces = &_airspaces;
+  serial = _airspaces.GetSerial();
+  entries.clear();
+
+  std::vector<const AbstractAirspace *> polygons;
+  GeoBounds bounds = GeoBounds::Invalid();
+
+  for (const auto &i : _airspaces.QueryAll()) {
+    const AbstractAirspace &airspace = i.GetAirspace();
+    if (airspace.GetShape() != AbstractAirspace::Shape::POLYGON)
+      continue;
+
+    polygons.push_back(&airspace);
+    for (const auto &p : airspace.GetPoints())
+      bounds.Extend(p.GetLocation());
+  }
+
+  reference = bounds.IsValid()
+    ? bounds.GetCenter()
+    : GeoPoint(Angle::Zero(), Angle::Zero());
+
+  std::vector<FloatPoint2D> vertices, polygon;
+  std::vector<GLushort> triangles;
+
+  /* the interiors, sorted by the class which determines the fill
+     colour */
+
+  std::stable_sort(polygons.begin(), polygons.end(),
+                   [](const AbstractAirspace *a, const AbstractAirspace *b){
+                     return a->GetClass() < b->GetClass();
+                   });
+
+  for (const AbstractAirspace *airspace : polygons) {
+    Entry &entry = entries[airspace];
+
+    polygon.clear();
+    for (const auto &p : airspace->GetPoints())
+      polygon.push_back(ToFloat(p.GetLocation(), reference));
+
+    entry.fill.first = vertices.size();
+
+    /* the triangle indices are 16 bit; larger polygons are not
+       filled */
+    if (polygon.size() < 0x10000) {
+      triangles.resize(3 * polygon.size());
+
+      /* no thinning: the geometry must look right at every map
+         scale */
+      const unsigned n = PolygonToTriangles(polygon.data(), polygon.size(),
+                                            triangles.data(), 0);
+      for (unsigned i = 0; i < n; ++i)
+        vertices.push_back(polygon[triangles[i]]);
+    }
+
+    entry.fill.count = vertices.size() - entry.fill.first;
+  }
+
+  /* the outlines, sorted by the class which determines the pen */
+
+  std::stable_sort(polygons.begin(), polygons.end(),
+                   [](const AbstractAirspace *a, const AbstractAirspace *b){
+                     return a->GetClassType() < b->GetClassType();
+                   });
+
+  for (const AbstractAirspace *airspace : polygons) {
+    Entry &entry = entries[airspace];
+    const auto &points = airspace->GetPoints();
+
+    /* the polygon is closed implicitly */
+    unsigned n = points.size();
+    if (n > 1 && points.front().GetLocation() == points.back().GetLocation())
+      --n;
+
+    entry.outline.first = vertices.size();
+
+    for (unsigned i = 0; i < n; ++i) {
+      vertices.push_back(ToFloat(points[i].GetLocation(), reference));
+      vertices.push_back(ToFloat(points[(i + 1) % n].GetLocation(),
+                                 reference));
+    }
+
+    entry.outline.count = vertices.size() - entry.outline.first;
+  }
+
+  if (buffer == nullptr)
+    buffer = std::make_unique<GLArrayBuffer>();
+
+  buffer->Load(vertices.size() * sizeof(vertices.front()), vertices.data());
+}
+
+void
+AirspaceGeometryCache::Clear() noexcept
+{
+  airspaces = nullptr;
+  entries.clear();
+  buffer.reset();
+}
+
+#endif /* ENABLE_OPENGL */
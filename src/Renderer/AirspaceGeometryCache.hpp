@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "Geo/GeoPoint.hpp"
+#include "util/Serial.hpp"
+#include "ui/opengl/System.hpp"
+
+#include <memory>
+#include <unordered_map>
+
+class Airspaces;
+class AbstractAirspace;
+class GLArrayBuffer;
+
+/**
+ * Keeps the geometry of all polygon airspaces in one OpenGL vertex
+ * buffer: the triangulated interior and the outline of each one, in
+ * geographic coordinates relative to a reference point (to be
+ * transformed with ToGLM()).  The buffer is rebuilt only when the
+ * #Airspaces serial changes.
+ *
+ * Interiors are stored as #GL_TRIANGLES and outlines as #GL_LINES,
+ * both sorted by airspace class, so the ranges of neighbouring
+ * airspaces of the same class can be merged into one draw call.
+ */
+class AirspaceGeometryCache {
+public:
+  /**
+   * A range of vertices in the buffer.
+   */
+  struct Range {
+    GLint first;
+    GLsizei count;
+  };
+
+  struct Entry {
+    /**
+     * The interior triangles; empty if triangulation has failed.
+     */
+    Range fill;
+
+    /**
+     * The outline segments.
+     */
+    Range outline;
+  };
+
+private:
+  const Airspaces *airspaces = nullptr;
+  Serial serial;
+
+  GeoPoint reference;
+
+  std::unique_ptr<GLArrayBuffer> buffer;
+
+  std::unordered_map<const AbstractAirspace *, Entry> entries;
+
+public:
+  AirspaceGeometryCache() noexcept;
+  ~AirspaceGeometryCache() noexcept;
+
+  AirspaceGeometryCache(const AirspaceGeometryCache &) = delete;
+  AirspaceGeometryCache &operator=(const AirspaceGeometryCache &) = delete;
+
+  /**
+   * Rebuild the buffer if the given object or its contents differ
+   * from the ones it was built from.
+   */
+  void Update(const Airspaces &_airspaces) noexcept;
+
+  /**
+   * Free the buffer; the next Update() call will rebuild it.
+   */
+  void Clear() noexcept;
+
+  const GeoPoint &GetReference() const noexcept {
+    return reference;
+  }
+
+  GLArrayBuffer &GetBuffer() noexcept {
+    return *buffer;
+  }
+
+  /**
+   * Look up the vertex ranges of a polygon airspace.
+   *
+   * @return nullptr if the airspace is not a polygon or was not
+   * known when the buffer was built
+   */
+  [[gnu::pure]]
+  const Entry *Find(const AbstractAirspace &airspace) const noexcept {
+    const auto i = entries.find(&airspace);
+    return i != entries.end() ? &i->second : nullptr;
+  }
+};
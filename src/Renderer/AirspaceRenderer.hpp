@@ -7,7 +7,9 @@
 #include "util/StaticArray.hxx"
 #include "Geo/GeoPoint.hpp"
 
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+#include "AirspaceGeometryCache.hpp"
+#else
 #include "TransparentRendererCache.hpp"
 #include "util/Serial.hpp"
 #endif
@@ -32,7 +34,17 @@ class AirspaceRenderer
 
   StaticArray<GeoPoint,32> intersections;
 
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+  /**
+   * The triangulated polygons of #airspaces in a vertex buffer.
+   */
+  AirspaceGeometryCache geometry_cache;
+
+  /**
+   * The number of OpenGL draw calls issued by the last Draw() call.
+   */
+  unsigned draw_calls = 0;
+#else
   /**
    * This object caches the airspace fill.  This avoids drawing it
    * again and again each frame when nothing has changed.
@@ -69,8 +81,17 @@ public:
   void Clear() {
     airspaces = nullptr;
     warning_manager = nullptr;
+#ifdef ENABLE_OPENGL
+    geometry_cache.Clear();
+#endif
   }
 
+#ifdef ENABLE_OPENGL
+  unsigned GetDrawCalls() const {
+    return draw_calls;
+  }
+#endif
+
   void Flush() {
 #ifndef ENABLE_OPENGL
     fill_cache.Invalidate();
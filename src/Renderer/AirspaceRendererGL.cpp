@@ -10,12 +10,31 @@
 #include "MapWindow/MapCanvas.hpp"
 #include "Look/AirspaceLook.hpp"
 #include "Airspace/Airspaces.hpp"
-#include "Airspace/AirspacePolygon.hpp"
 #include "Airspace/AirspaceCircle.hpp"
 #include "Airspace/AirspaceWarningCopy.hpp"
 #include "Engine/Airspace/Predicate/AirspacePredicate.hpp"
 #include "ui/canvas/opengl/Scope.hpp"
-
+#include "ui/canvas/opengl/Buffer.hpp"
+#include "ui/canvas/opengl/Dynamic.hpp"
+#include "ui/canvas/opengl/Geo.hpp"
+#include "ui/canvas/opengl/Program.hpp"
+#include "ui/canvas/opengl/Shaders.hpp"
+#include "ui/canvas/opengl/Triangulate.hpp"
+#include "ui/canvas/opengl/VertexPointer.hpp"
+#include "util/AllocatedArray.hxx"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <cassert>
+
+/**
+ * Draws circles in the "padding" fill mode.  Polygons are drawn by
+ * #AirspaceBatchRenderer.
+ */
 class AirspaceVisitorRenderer final
   : protected MapCanvas
 {
@@ -23,14 +42,18 @@ class AirspaceVisitorRenderer final
   const AirspaceWarningCopy &warning_manager;
   const AirspaceRendererSettings &settings;
 
+  unsigned &draw_calls;
+
 public:
   AirspaceVisitorRenderer(Canvas &_canvas, const WindowProjection &_projection,
                           const AirspaceLook &_look,
                           const AirspaceWarningCopy &_warnings,
-                          const AirspaceRendererSettings &_settings)
+                          const AirspaceRendererSettings &_settings,
+                          unsigned &_draw_calls)
     :MapCanvas(_canvas, _projection,
                _projection.GetScreenBounds().Scale(1.1)),
-     look(_look), warning_manager(_warnings), settings(_settings)
+     look(_look), warning_manager(_warnings), settings(_settings),
+     draw_calls(_draw_calls)
   {
     glStencilMask(0xff);
     glClear(GL_STENCIL_BUFFER_BIT);
@@ -41,8 +64,7 @@ public:
     glStencilMask(0xff);
   }
 
-private:
-  void VisitCircle(const AirspaceCircle &airspace) {
+  void Visit(const AirspaceCircle &airspace) {
     const AirspaceClassRendererSettings &class_settings =
       settings.classes[airspace.GetClass()];
     const AirspaceClassLook &class_look = look.classes[airspace.GetClass()];
@@ -72,67 +94,14 @@ private:
         canvas.DrawCircle(screen_center,
                           screen_radius - look.thick_pen.GetWidth() / 4);
       }
-    }
-
-    // draw outline
-    if (SetupOutline(airspace))
-      canvas.DrawCircle(screen_center, screen_radius);
-  }
-
-  void VisitPolygon(const AirspacePolygon &airspace) {
-    if (!PreparePolygon(airspace.GetPoints()))
-      return;
-
-    const AirspaceClassRendererSettings &class_settings =
-      settings.classes[airspace.GetClass()];
-
-    bool fill_airspace = warning_manager.HasWarning(airspace) ||
-      warning_manager.IsInside(airspace) ||
-      class_settings.fill_mode ==
-      AirspaceClassRendererSettings::FillMode::ALL;
-
-    if (!warning_manager.IsAcked(airspace) &&
-        class_settings.fill_mode !=
-        AirspaceClassRendererSettings::FillMode::NONE) {
-      const GLEnable<GL_STENCIL_TEST> stencil;
-
-      if (!fill_airspace) {
-        // set stencil for filling (bit 0)
-        SetFillStencil();
-        DrawPrepared();
-        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-      }
 
-      // fill interior without overpainting any previous outlines
-      {
-        SetupInterior(airspace, !fill_airspace);
-        const GLEnable<GL_BLEND> blend;
-        DrawPrepared();
-      }
-
-      if (!fill_airspace) {
-        // clear fill stencil (bit 0)
-        ClearFillStencil();
-        DrawPrepared();
-        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-      }
+      ++draw_calls;
     }
 
     // draw outline
-    if (SetupOutline(airspace))
-      DrawPrepared();
-  }
-
-public:
-  void Visit(const AbstractAirspace &airspace) {
-    switch (airspace.GetShape()) {
-    case AbstractAirspace::Shape::CIRCLE:
-      VisitCircle((const AirspaceCircle &)airspace);
-      break;
-
-    case AbstractAirspace::Shape::POLYGON:
-      VisitPolygon((const AirspacePolygon &)airspace);
-      break;
+    if (SetupOutline(airspace)) {
+      canvas.DrawCircle(screen_center, screen_radius);
+      ++draw_calls;
     }
   }
 
@@ -158,42 +127,22 @@ private:
     return true;
   }
 
-  void SetupInterior(const AbstractAirspace &airspace,
-                     bool check_fillstencil = false) {
+  void SetupInterior(const AbstractAirspace &airspace) {
     const AirspaceClassLook &class_look = look.classes[airspace.GetClass()];
 
-    // restrict drawing area and don't paint over previously drawn outlines
-    if (check_fillstencil)
-      glStencilFunc(GL_EQUAL, 1, 3);
-    else
-      glStencilFunc(GL_EQUAL, 0, 2);
+    // don't paint over previously drawn outlines
+    glStencilFunc(GL_EQUAL, 0, 2);
     glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
 
     canvas.Select(Brush(class_look.fill_color.WithAlpha(90)));
     canvas.SelectNullPen();
   }
-
-  void SetFillStencil() {
-    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-    glStencilFunc(GL_ALWAYS, 3, 3);
-    glStencilMask(1);
-    glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-
-    canvas.SelectHollowBrush();
-    canvas.Select(look.thick_pen);
-  }
-
-  void ClearFillStencil() {
-    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-    glStencilFunc(GL_ALWAYS, 3, 3);
-    glStencilMask(1);
-    glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO);
-
-    canvas.SelectHollowBrush();
-    canvas.Select(look.thick_pen);
-  }
 };
 
+/**
+ * Draws circles in the "all" and "none" fill modes.  Polygons are
+ * drawn by #AirspaceBatchRenderer.
+ */
 class AirspaceFillRenderer final
   : protected MapCanvas
 {
@@ -201,58 +150,36 @@ class AirspaceFillRenderer final
   const AirspaceWarningCopy &warning_manager;
   const AirspaceRendererSettings &settings;
 
+  unsigned &draw_calls;
+
 public:
   AirspaceFillRenderer(Canvas &_canvas, const WindowProjection &_projection,
                        const AirspaceLook &_look,
                        const AirspaceWarningCopy &_warnings,
-                       const AirspaceRendererSettings &_settings)
+                       const AirspaceRendererSettings &_settings,
+                       unsigned &_draw_calls)
     :MapCanvas(_canvas, _projection,
                _projection.GetScreenBounds().Scale(1.1)),
-     look(_look), warning_manager(_warnings), settings(_settings)
+     look(_look), warning_manager(_warnings), settings(_settings),
+     draw_calls(_draw_calls)
   {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
   }
 
-private:
-  void VisitCircle(const AirspaceCircle &airspace) {
+  void Visit(const AirspaceCircle &airspace) {
     auto screen_center = projection.GeoToScreen(airspace.GetReferenceLocation());
     unsigned screen_radius = projection.GeoToScreenDistance(airspace.GetRadius());
 
     if (!warning_manager.IsAcked(airspace) && SetupInterior(airspace)) {
       const GLEnable<GL_BLEND> blend;
       canvas.DrawCircle(screen_center, screen_radius);
+      ++draw_calls;
     }
 
     // draw outline
-    if (SetupOutline(airspace))
+    if (SetupOutline(airspace)) {
       canvas.DrawCircle(screen_center, screen_radius);
-  }
-
-  void VisitPolygon(const AirspacePolygon &airspace) {
-    if (!PreparePolygon(airspace.GetPoints()))
-      return;
-
-    if (!warning_manager.IsAcked(airspace) && SetupInterior(airspace)) {
-      // fill interior without overpainting any previous outlines
-      GLEnable<GL_BLEND> blend;
-      DrawPrepared();
-    }
-
-    // draw outline
-    if (SetupOutline(airspace))
-      DrawPrepared();
-  }
-
-public:
-  void Visit(const AbstractAirspace &airspace) {
-    switch (airspace.GetShape()) {
-    case AbstractAirspace::Shape::CIRCLE:
-      VisitCircle((const AirspaceCircle &)airspace);
-      break;
-
-    case AbstractAirspace::Shape::POLYGON:
-      VisitPolygon((const AirspacePolygon &)airspace);
-      break;
+      ++draw_calls;
     }
   }
 
@@ -286,6 +213,287 @@ private:
   }
 };
 
+/**
+ * Draws polygons from the #AirspaceGeometryCache.  The visible
+ * airspaces are first sorted into groups which share the same OpenGL
+ * state (by class and fill mode), and then each group is drawn with
+ * one glMultiDrawArrays() call, instead of triangulating and drawing
+ * each airspace separately.
+ *
+ * All interiors are drawn before all outlines.
+ */
+class AirspaceBatchRenderer final
+  : protected MapCanvas
+{
+  using Range = AirspaceGeometryCache::Range;
+  using Entry = AirspaceGeometryCache::Entry;
+  using AirspaceList = std::vector<const AbstractAirspace *>;
+
+  const WindowProjection &window_projection;
+  const AirspaceLook &look;
+  const AirspaceWarningCopy &warning_manager;
+  const AirspaceRendererSettings &settings;
+
+  AirspaceGeometryCache &cache;
+
+  unsigned &draw_calls;
+
+  /**
+   * Draw only a band along the inside of the border (the "padding"
+   * fill mode), unless the class or a warning demands a full fill.
+   */
+  const bool padding;
+
+  const uint8_t alpha;
+
+  struct Group {
+    /**
+     * Airspaces of this class whose interior is filled completely.
+     */
+    AirspaceList fill;
+
+    /**
+     * Airspaces of this class whose interior is filled only along
+     * the border.
+     */
+    AirspaceList padding;
+
+    /**
+     * Airspaces of this class type which get an outline.
+     */
+    AirspaceList outline;
+  };
+
+  std::array<Group, AIRSPACECLASSCOUNT> groups;
+
+  std::vector<Range> ranges;
+  std::vector<GLint> firsts;
+  std::vector<GLsizei> counts;
+
+  std::vector<BulkPixelPoint> strip;
+  AllocatedArray<BulkPixelPoint> line_buffer;
+
+public:
+  AirspaceBatchRenderer(Canvas &_canvas, const WindowProjection &_projection,
+                        const AirspaceLook &_look,
+                        const AirspaceWarningCopy &_warnings,
+                        const AirspaceRendererSettings &_settings,
+                        AirspaceGeometryCache &_cache,
+                        unsigned &_draw_calls,
+                        bool _padding)
+    :MapCanvas(_canvas, _projection,
+               _projection.GetScreenBounds().Scale(1.1)),
+     window_projection(_projection),
+     look(_look), warning_manager(_warnings), settings(_settings),
+     cache(_cache), draw_calls(_draw_calls),
+     padding(_padding), alpha(_padding ? 90 : 48) {}
+
+  void Add(const AbstractAirspace &airspace) {
+    if (!warning_manager.IsAcked(airspace)) {
+      Group &group = groups[airspace.GetClass()];
+
+      if (!padding) {
+        if (settings.fill_mode != AirspaceRendererSettings::FillMode::NONE)
+          group.fill.push_back(&airspace);
+      } else {
+        const auto fill_mode = settings.classes[airspace.GetClass()].fill_mode;
+        if (fill_mode == AirspaceClassRendererSettings::FillMode::ALL ||
+            warning_manager.HasWarning(airspace) ||
+            warning_manager.IsInside(airspace))
+          group.fill.push_back(&airspace);
+        else if (fill_mode != AirspaceClassRendererSettings::FillMode::NONE)
+          group.padding.push_back(&airspace);
+      }
+    }
+
+    const AirspaceClass type = airspace.GetClassType();
+    if (settings.black_outline || settings.classes[type].border_width > 0)
+      groups[type].outline.push_back(&airspace);
+  }
+
+  void Draw() {
+    OpenGL::solid_shader->Use();
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    ScopeVertexPointer vp;
+    BeginGeo(vp);
+
+    for (unsigned i = 0; i < groups.size(); ++i) {
+      const Group &group = groups[i];
+      const Color color = look.classes[i].fill_color.WithAlpha(alpha);
+
+      if (!group.fill.empty()) {
+        const GLEnable<GL_BLEND> blend;
+        color.Bind();
+        DrawRanges(GL_TRIANGLES, group.fill, &Entry::fill);
+      }
+
+      if (!group.padding.empty())
+        DrawPadding(vp, group.padding, color);
+    }
+
+    static constexpr Pen black_pen(1, COLOR_BLACK);
+
+    for (unsigned i = 0; i < groups.size(); ++i) {
+      const Group &group = groups[i];
+      if (group.outline.empty())
+        continue;
+
+      const Pen &pen = settings.black_outline
+        ? black_pen
+        : look.classes[i].border_pen;
+
+      if (pen.GetWidth() <= 2) {
+        pen.Bind();
+        DrawRanges(GL_LINES, group.outline, &Entry::outline);
+        pen.Unbind();
+      } else {
+        pen.GetColor().Bind();
+        DrawLines(vp, group.outline, pen.GetWidth());
+      }
+    }
+
+    EndGeo();
+  }
+
+private:
+  void BeginGeo(ScopeVertexPointer &vp) {
+    cache.GetBuffer().Bind();
+    vp.Update(GL_FLOAT, nullptr);
+
+    glUniformMatrix4fv(OpenGL::solid_modelview, 1, GL_FALSE,
+                       glm::value_ptr(ToGLM(window_projection,
+                                                cache.GetReference())));
+  }
+
+  void EndGeo() {
+    glUniformMatrix4fv(OpenGL::solid_modelview, 1, GL_FALSE,
+                       glm::value_ptr(glm::mat4(1)));
+    GLArrayBuffer::Unbind();
+  }
+
+  /**
+   * Draw the given vertex range of each airspace.  Adjacent ranges
+   * are merged, and the rest is submitted in one call.
+   */
+  void DrawRanges(GLenum mode, const AirspaceList &list, Range Entry::*member) {
+    ranges.clear();
+    for (const AbstractAirspace *airspace : list) {
+      const Entry *entry = cache.Find(*airspace);
+      assert(entry != nullptr);
+
+      const Range &range = entry->*member;
+      if (range.count > 0)
+        ranges.push_back(range);
+    }
+
+    if (ranges.empty())
+      return;
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const Range &a, const Range &b){
+                return a.first < b.first;
+              });
+
+    firsts.clear();
+    counts.clear();
+    for (const Range &range : ranges) {
+      if (!firsts.empty() && firsts.back() + counts.back() == range.first)
+        counts.back() += range.count;
+      else {
+        firsts.push_back(range.first);
+        counts.push_back(range.count);
+      }
+    }
+
+#ifdef GL_EXT_multi_draw_arrays
+    if (GLExt::HaveMultiDrawArrays()) {
+      GLExt::MultiDrawArrays(mode, firsts.data(), counts.data(),
+                             GLsizei(firsts.size()));
+      ++draw_calls;
+      return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < firsts.size(); ++i)
+      glDrawArrays(mode, firsts[i], counts[i]);
+    draw_calls += firsts.size();
+  }
+
+  /**
+   * Draw thick outlines of the given airspaces in screen
+   * coordinates, joined into one triangle strip.
+   */
+  void DrawLines(ScopeVertexPointer &vp, const AirspaceList &list,
+                 unsigned width) {
+    strip.clear();
+
+    for (const AbstractAirspace *airspace : list) {
+      if (!PreparePolygon(airspace->GetPoints()))
+        continue;
+
+      const unsigned n = LineToTriangles(raster_points.data(),
+                                         num_raster_points, line_buffer,
+                                         width, true);
+      if (n == 0)
+        continue;
+
+      if (!strip.empty()) {
+        /* connect to the previous strip with two degenerate
+           triangles */
+        strip.push_back(strip.back());
+        strip.push_back(line_buffer[0]);
+      }
+
+      strip.insert(strip.end(), line_buffer.data(), line_buffer.data() + n);
+    }
+
+    if (strip.empty())
+      return;
+
+    EndGeo();
+
+    vp.Update(strip.data());
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, strip.size());
+    ++draw_calls;
+
+    BeginGeo(vp);
+  }
+
+  /**
+   * Fill a band along the inside of the border of each airspace: the
+   * band is marked in stencil bit 0 with the thick pen, and then the
+   * interiors are drawn where the mark is set.  Each filled pixel
+   * clears its mark, so overlapping airspaces of the same class tint
+   * it only once.
+   */
+  void DrawPadding(ScopeVertexPointer &vp, const AirspaceList &list,
+                   Color color) {
+    const GLEnable<GL_STENCIL_TEST> stencil;
+
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glStencilFunc(GL_ALWAYS, 1, 1);
+    glStencilMask(1);
+    glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+
+    DrawLines(vp, list, look.thick_pen.GetWidth());
+
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glStencilFunc(GL_EQUAL, 1, 1);
+    glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO);
+
+    {
+      const GLEnable<GL_BLEND> blend;
+      color.Bind();
+      DrawRanges(GL_TRIANGLES, list, &Entry::fill);
+    }
+
+    // clear the marks outside of the interiors
+    glClear(GL_STENCIL_BUFFER_BIT);
+    glStencilMask(0xff);
+  }
+};
+
 void
 AirspaceRenderer::DrawInternal(Canvas &canvas,
                                const WindowProjection &projection,
@@ -297,22 +505,47 @@ AirspaceRenderer::DrawInternal(Canvas &canvas,
     airspaces->QueryWithinRange(projection.GetGeoScreenCenter(),
                                 projection.GetScreenDistanceMeters());
 
-  if (settings.fill_mode == AirspaceRendererSettings::FillMode::ALL ||
-      settings.fill_mode == AirspaceRendererSettings::FillMode::NONE) {
-    AirspaceFillRenderer renderer(canvas, projection, look, awc, settings);
+  geometry_cache.Update(*airspaces);
+  draw_calls = 0;
+
+  const bool padding =
+    settings.fill_mode != AirspaceRendererSettings::FillMode::ALL &&
+    settings.fill_mode != AirspaceRendererSettings::FillMode::NONE;
+
+  AirspaceBatchRenderer batch(canvas, projection, look, awc, settings,
+                              geometry_cache, draw_calls, padding);
+
+  /* circles are drawn right away, polygons are collected for
+     batch.Draw() */
+  const auto visit = [&](auto &circle_renderer){
     for (const auto &i : range) {
       const AbstractAirspace &airspace = i.GetAirspace();
-      if (visible(airspace))
-        renderer.Visit(airspace);
+      if (!visible(airspace))
+        continue;
+
+      switch (airspace.GetShape()) {
+      case AbstractAirspace::Shape::CIRCLE:
+        circle_renderer.Visit((const AirspaceCircle &)airspace);
+        break;
+
+      case AbstractAirspace::Shape::POLYGON:
+        batch.Add(airspace);
+        break;
+      }
     }
+  };
+
+  if (padding) {
+    AirspaceVisitorRenderer renderer(canvas, projection, look, awc, settings,
+                                     draw_calls);
+    visit(renderer);
   } else {
-    AirspaceVisitorRenderer renderer(canvas, projection, look, awc, settings);
-    for (const auto &i : range) {
-      const AbstractAirspace &airspace = i.GetAirspace();
-      if (visible(airspace))
-        renderer.Visit(airspace);
-    }
+    AirspaceFillRenderer renderer(canvas, projection, look, awc, settings,
+                                  draw_calls);
+    visit(renderer);
   }
+
+  batch.Draw();
 }
 
 #endif /* ENABLE_OPENGL */
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#ifdef ENABLE_OPENGL
+
+#include "TrailBuffer.hpp"
+#include "Engine/Trace/Trace.hpp"
+#include "Projection/WindowProjection.hpp"
+#include "ui/canvas/Pen.hpp"
+#include "ui/canvas/opengl/Buffer.hpp"
+#include "ui/canvas/opengl/Shaders.hpp"
+#include "ui/canvas/opengl/Program.hpp"
+#include "ui/canvas/opengl/Attribute.hpp"
+#include "ui/canvas/opengl/Geo.hpp"
+#include "ui/dim/Point.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace {
+
+/**
+ * The layout of one vertex; see OpenGL::trail_shader.
+ */
+struct Vertex {
+  /**
+   * The location of this end of the segment.
+   */
+  FloatPoint2D position;
+
+  /**
+   * The location of the other end of the segment.
+   */
+  FloatPoint2D other;
+
+  /**
+   * The side of the line relative to the direction towards #other:
+   * -1 or +1.
+   */
+  float side;
+
+  float value;
+
+  /**
+   * The drift coefficients: the drift is "now * drift - drift_time".
+   */
+  float drift, drift_time;
+};
+
+} // anonymous namespace
+
+static constexpr unsigned VERTICES_PER_SEGMENT = 6;
+
+TrailBuffer::TrailBuffer() noexcept = default;
+TrailBuffer::~TrailBuffer() noexcept = default;
+
+static FloatPoint2D
+ToFloat(const GeoPoint &p, const GeoPoint &reference) noexcept
+{
+  const GeoPoint delta = p - reference;
+  return {float(delta.longitude.Native()), float(delta.latitude.Native())};
+}
+
+void
+TrailBuffer::Update(const Trace &trace, bool _altitude) noexcept
+{
+  const auto points = trace.GetPoints();
+
+  if (buffer == nullptr || trace.GetModifySerial() != modify_serial ||
+      _altitude != altitude || points.size() < times.size() ||
+      points.size() > capacity) {
+    altitude = _altitude;
+    Rebuild(points);
+  } else if (trace.GetAppendSerial() != append_serial)
+    Append(points);
+
+  modify_serial = trace.GetModifySerial();
+  append_serial = trace.GetAppendSerial();
+}
+
+void
+TrailBuffer::Rebuild(std::span<const TracePoint> points) noexcept
+{
+  times.clear();
+  values.clear();
+
+  /* leave room for appending, so the buffer needs to be rebuilt
+     only rarely */
+  capacity = std::max<std::size_t>(2 * points.size(), 256);
+  times.reserve(capacity);
+  values.reserve(capacity);
+
+  if (!points.empty()) {
+    reference = points.front().GetLocation();
+    reference_time = points.front().GetTime();
+  }
+
+  if (buffer == nullptr)
+    buffer = std::make_unique<GLDynamicArrayBuffer>();
+
+  buffer->Bind();
+  GLDynamicArrayBuffer::Data((capacity - 1) * VERTICES_PER_SEGMENT *
+                             sizeof(Vertex),
+                             nullptr);
+  GLDynamicArrayBuffer::Unbind();
+
+  Append(points);
+}
+
+void
+TrailBuffer::Append(std::span<const TracePoint> points) noexcept
+{
+  assert(points.size() <= capacity);
+
+  const std::size_t start = times.size();
+  if (start >= points.size())
+    return;
+
+  const std::size_t first_segment = start > 0 ? start - 1 : 0;
+
+  std::vector<Vertex> vertices;
+  vertices.reserve((points.size() - 1 - first_segment) *
+                   VERTICES_PER_SEGMENT);
+
+  const auto make_vertex = [this](const TracePoint &p,
+                                  const TracePoint &other,
+                                  float side, float value) noexcept {
+    const float drift = p.GetDriftFactor() / 256.f;
+    const float t =
+      std::chrono::duration_cast<FloatDuration>(p.GetTime() -
+                                                reference_time).count();
+
+    return Vertex{
+      ToFloat(p.GetLocation(), reference),
+      ToFloat(other.GetLocation(), reference),
+      side, value,
+      drift, drift * t,
+    };
+  };
+
+  for (std::size_t i = start; i < points.size(); ++i) {
+    const TracePoint &b = points[i];
+    const float value = altitude ? b.GetAltitude() : b.GetVario();
+
+    times.push_back(b.GetTime());
+    values.push_back(value);
+
+    if (i == 0)
+      continue;
+
+    const TracePoint &a = points[i - 1];
+
+    /* the "side" is relative to the direction towards the other
+       end, therefore it is flipped at the end point */
+    const Vertex a_left = make_vertex(a, b, 1, value);
+    const Vertex a_right = make_vertex(a, b, -1, value);
+    const Vertex b_left = make_vertex(b, a, -1, value);
+    const Vertex b_right = make_vertex(b, a, 1, value);
+
+    vertices.insert(vertices.end(), {
+        a_left, a_right, b_left,
+        a_right, b_right, b_left,
+      });
+  }
+
+  last = points.back();
+
+  if (vertices.empty())
+    return;
+
+  buffer->Bind();
+  GLDynamicArrayBuffer::SubData(first_segment * VERTICES_PER_SEGMENT *
+                                sizeof(Vertex),
+                                vertices.size() * sizeof(Vertex),
+                                vertices.data());
+  GLDynamicArrayBuffer::Unbind();
+}
+
+void
+TrailBuffer::Clear() noexcept
+{
+  buffer.reset();
+  capacity = 0;
+  times.clear();
+  values.clear();
+}
+
+unsigned
+TrailBuffer::FindTime(TracePoint::Time min_time) const noexcept
+{
+  return std::distance(times.begin(),
+                       std::lower_bound(times.begin(), times.end(),
+                                        min_time));
+}
+
+void
+TrailBuffer::Draw(const WindowProjection &projection, unsigned first,
+                  std::span<const Pen> pens, const float value_scale[3],
+                  const GeoPoint &drift, TimeStamp now) noexcept
+{
+  assert(pens.size() == OpenGL::TRAIL_TABLE_SIZE);
+
+  if (first + 1 >= times.size())
+    return;
+
+  std::array<GLfloat, OpenGL::TRAIL_TABLE_SIZE * 4> colors;
+  std::array<GLfloat, OpenGL::TRAIL_TABLE_SIZE> widths;
+  for (unsigned i = 0; i < OpenGL::TRAIL_TABLE_SIZE; ++i) {
+    const Color color = pens[i].GetColor();
+    colors[i * 4] = color.Red() / 255.f;
+    colors[i * 4 + 1] = color.Green() / 255.f;
+    colors[i * 4 + 2] = color.Blue() / 255.f;
+    colors[i * 4 + 3] = color.Alpha() / 255.f;
+    widths[i] = pens[i].GetWidth();
+  }
+
+  const float now_relative =
+    (now.ToDuration() -
+     std::chrono::duration_cast<FloatDuration>(reference_time)).count();
+
+  OpenGL::trail_shader->Use();
+  glUniformMatrix4fv(OpenGL::trail_modelview, 1, GL_FALSE,
+                     glm::value_ptr(ToGLM(projection, reference)));
+  glUniform3f(OpenGL::trail_value_scale,
+              value_scale[0], value_scale[1], value_scale[2]);
+  glUniform3f(OpenGL::trail_drift,
+              drift.longitude.Native(), drift.latitude.Native(),
+              now_relative);
+  glUniform4fv(OpenGL::trail_colors, OpenGL::TRAIL_TABLE_SIZE,
+               colors.data());
+  glUniform1fv(OpenGL::trail_widths, OpenGL::TRAIL_TABLE_SIZE,
+               widths.data());
+
+  buffer->Bind();
+
+  glEnableVertexAttribArray(OpenGL::Attribute::POSITION);
+  glVertexAttribPointer(OpenGL::Attribute::POSITION, 4, GL_FLOAT, GL_FALSE,
+                        sizeof(Vertex),
+                        (const GLvoid *)offsetof(Vertex, position));
+
+  glEnableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+  glVertexAttribPointer(OpenGL::Attribute::TEXCOORD, 4, GL_FLOAT, GL_FALSE,
+                        sizeof(Vertex),
+                        (const GLvoid *)offsetof(Vertex, side));
+
+  glDrawArrays(GL_TRIANGLES, first * VERTICES_PER_SEGMENT,
+               (times.size() - 1 - first) * VERTICES_PER_SEGMENT);
+
+  glDisableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+  glDisableVertexAttribArray(OpenGL::Attribute::POSITION);
+
+  GLDynamicArrayBuffer::Unbind();
+}
+
+#endif /* ENABLE_OPENGL */
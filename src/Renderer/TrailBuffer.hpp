@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "Engine/Trace/Point.hpp"
+#include "Geo/GeoPoint.hpp"
+#include "util/Serial.hpp"
+#include "time/Stamp.hpp"
+
+#include <memory>
+#include <span>
+#include <vector>
+
+class Trace;
+class Pen;
+class WindowProjection;
+class GLDynamicArrayBuffer;
+
+/**
+ * Keeps the segments of a #Trace in an OpenGL vertex buffer, in
+ * geographic coordinates relative to a reference point, to be drawn
+ * with OpenGL::trail_shader.  New points are appended to the buffer
+ * as they arrive; it is rebuilt only when the #Trace modify serial
+ * changes (e.g. after thinning).
+ *
+ * Each segment is made of two triangles (six vertices), and all of
+ * them carry the value (vario or altitude) of the segment's end
+ * point, which selects color and width in the shader.
+ */
+class TrailBuffer {
+  Serial modify_serial, append_serial;
+
+  /**
+   * Does the buffer contain altitudes (true) or vario values
+   * (false)?
+   */
+  bool altitude;
+
+  GeoPoint reference;
+  TracePoint::Time reference_time;
+
+  std::unique_ptr<GLDynamicArrayBuffer> buffer;
+
+  /**
+   * The number of points which fit into #buffer.
+   */
+  unsigned capacity = 0;
+
+  /**
+   * The time stamp and the value of each point in the buffer.
+   */
+  std::vector<TracePoint::Time> times;
+  std::vector<float> values;
+
+  TracePoint last;
+
+public:
+  TrailBuffer() noexcept;
+  ~TrailBuffer() noexcept;
+
+  TrailBuffer(const TrailBuffer &) = delete;
+  TrailBuffer &operator=(const TrailBuffer &) = delete;
+
+  /**
+   * Append new points of the #Trace to the buffer, or rebuild it if
+   * the #Trace was modified or the other value was requested.  The
+   * caller must hold the lock protecting the #Trace.
+   */
+  void Update(const Trace &trace, bool _altitude) noexcept;
+
+  /**
+   * Free the buffer; the next Update() call will rebuild it.
+   */
+  void Clear() noexcept;
+
+  unsigned size() const noexcept {
+    return times.size();
+  }
+
+  /**
+   * Returns the index of the first point which is not older than
+   * the given time.
+   */
+  [[gnu::pure]]
+  unsigned FindTime(TracePoint::Time min_time) const noexcept;
+
+  std::span<const float> GetValues(unsigned first) const noexcept {
+    return std::span{values}.subspan(first);
+  }
+
+  const TracePoint &GetLast() const noexcept {
+    return last;
+  }
+
+  /**
+   * Draw all segments after the given point.
+   *
+   * @param pens the color and width of each table entry
+   * @param value_scale maps a value to a table index, see
+   * OpenGL::trail_shader
+   * @param drift the wind drift direction; zero disables drift
+   * @param now the current time, needed for calculating the drift
+   */
+  void Draw(const WindowProjection &projection, unsigned first,
+            std::span<const Pen> pens, const float value_scale[3],
+            const GeoPoint &drift, TimeStamp now) noexcept;
+
+private:
+  void Rebuild(std::span<const TracePoint> points) noexcept;
+  void Append(std::span<const TracePoint> points) noexcept;
+};
@@ -12,6 +12,10 @@
 #include "Geo/Math.hpp"
 #include "Engine/Contest/ContestTrace.hpp"
 
+#ifdef ENABLE_OPENGL
+#include "ui/canvas/opengl/Shaders.hpp"
+#endif
+
 #include <algorithm>
 
 bool
@@ -58,9 +62,14 @@ GetAltitudeColorIndex(double alt, double min_alt, double max_alt) noexcept
   return std::clamp((int)(relative_altitude * _max), 0, _max);
 }
 
+/**
+ * @param get a function returning the altitude or the vario value
+ * (depending on the #type) of a range element
+ */
+template<typename R, typename F>
 [[gnu::pure]]
 static std::pair<double, double>
-GetMinMax(TrailSettings::Type type, const TracePointVector &trace) noexcept
+GetMinMax(TrailSettings::Type type, const R &range, F &&get) noexcept
 {
   double value_min, value_max;
 
@@ -68,17 +77,17 @@ GetMinMax(TrailSettings::Type type, const TracePointVector &trace) noexcept
     value_max = 1000;
     value_min = 500;
 
-    for (const auto &i : trace) {
-      value_max = std::max(i.GetAltitude(), value_max);
-      value_min = std::min(i.GetAltitude(), value_min);
+    for (const auto &i : range) {
+      value_max = std::max<double>(get(i), value_max);
+      value_min = std::min<double>(get(i), value_min);
     }
   } else {
     value_max = 0.75;
     value_min = -2.0;
 
-    for (const auto &i : trace) {
-      value_max = std::max(i.GetVario(), value_max);
-      value_min = std::min(i.GetVario(), value_min);
+    for (const auto &i : range) {
+      value_max = std::max<double>(get(i), value_max);
+      value_min = std::min<double>(get(i), value_min);
     }
 
     value_max = std::min(7.5, value_max);
@@ -88,6 +97,98 @@ GetMinMax(TrailSettings::Type type, const TracePointVector &trace) noexcept
   return std::make_pair(value_min, value_max);
 }
 
+[[gnu::pure]]
+static std::pair<double, double>
+GetMinMax(TrailSettings::Type type, const TracePointVector &trace) noexcept
+{
+  return GetMinMax(type, trace, [type](const TracePoint &i){
+    return type == TrailSettings::Type::ALTITUDE
+      ? i.GetAltitude()
+      : i.GetVario();
+  });
+}
+
+/**
+ * Does this trail type draw dots (which are not implemented by the
+ * #TrailBuffer)?
+ */
+static constexpr bool
+HasDots(TrailSettings::Type type) noexcept
+{
+  return type == TrailSettings::Type::VARIO_1_DOTS ||
+    type == TrailSettings::Type::VARIO_2_DOTS ||
+    type == TrailSettings::Type::VARIO_DOTS_AND_LINES ||
+    type == TrailSettings::Type::VARIO_EINK;
+}
+
+#ifdef ENABLE_OPENGL
+
+void
+TrailRenderer::DrawBuffered(Canvas &canvas,
+                            const TraceComputer &trace_computer,
+                            const WindowProjection &projection,
+                            TimeStamp min_time, const GeoPoint *traildrift,
+                            PixelPoint pos, TimeStamp now,
+                            const TrailSettings &settings) noexcept
+{
+  const bool altitude = settings.type == TrailSettings::Type::ALTITUDE;
+
+  {
+    const std::lock_guard<Mutex> lock{trace_computer};
+    buffer.Update(trace_computer.GetFull(), altitude);
+  }
+
+  const unsigned first =
+    buffer.FindTime(min_time.Cast<std::chrono::duration<unsigned>>());
+  if (first >= buffer.size())
+    return;
+
+  const auto [value_min, value_max] =
+    GetMinMax(settings.type, buffer.GetValues(first),
+              [](float value){ return value; });
+
+  /* the linear mapping from value to color index done by
+     GetSnailColorIndex() and GetAltitudeColorIndex(), for the
+     shader */
+  static_assert(TrailLook::NUMSNAILCOLORS == OpenGL::TRAIL_TABLE_SIZE);
+  constexpr float n_colors = TrailLook::NUMSNAILCOLORS;
+  float value_scale[3];
+  if (altitude) {
+    const float factor = (n_colors - 1) / (value_max - value_min);
+    value_scale[0] = value_scale[1] = factor;
+    value_scale[2] = -value_min * factor;
+  } else {
+    value_scale[0] = -n_colors / (2 * value_min);
+    value_scale[1] = n_colors / (2 * value_max);
+    value_scale[2] = n_colors / 2;
+  }
+
+  const bool scaled_trail = !altitude && settings.scaling_enabled &&
+    projection.GetMapScale() <= 6000;
+  const auto &pens = scaled_trail ? look.scaled_trail_pens : look.trail_pens;
+
+  buffer.Draw(projection, first, pens, value_scale,
+              traildrift != nullptr
+              ? *traildrift
+              : GeoPoint(Angle::Zero(), Angle::Zero()),
+              now);
+
+  /* connect the trail to the aircraft */
+
+  const TracePoint &last = buffer.GetLast();
+  const GeoPoint gp = traildrift != nullptr
+    ? last.GetLocation().Parametric(*traildrift, last.CalculateDrift(now))
+    : last.GetLocation();
+
+  const unsigned index = altitude
+    ? GetAltitudeColorIndex(last.GetAltitude(), value_min, value_max)
+    : GetSnailColorIndex(last.GetVario(), value_min, value_max);
+  canvas.Select(pens[index]);
+  canvas.DrawLine(projection.GeoToScreen(gp), pos);
+}
+
+#endif
+
 void
 TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
                     const WindowProjection &projection,
@@ -99,9 +200,6 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
   if (settings.length == TrailSettings::Length::OFF)
     return;
 
-  if (!LoadTrace(trace_computer, min_time, projection))
-    return;
-
   if (!basic.location_available || !calculated.wind_available)
     enable_traildrift = false;
 
@@ -113,6 +211,18 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
     traildrift = basic.location - tp1;
   }
 
+#ifdef ENABLE_OPENGL
+  if (!HasDots(settings.type)) {
+    DrawBuffered(canvas, trace_computer, projection, min_time,
+                 enable_traildrift ? &traildrift : nullptr,
+                 pos, basic.time, settings);
+    return;
+  }
+#endif
+
+  if (!LoadTrace(trace_computer, min_time, projection))
+    return;
+
   auto minmax = GetMinMax(settings.type, trace);
   auto value_min = minmax.first;
   auto value_max = minmax.second;
@@ -145,11 +255,7 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
       } else {
         unsigned color_index = GetSnailColorIndex(i.GetVario(),
                                                   value_min, value_max);
-        if (i.GetVario() < 0 &&
-            (settings.type == TrailSettings::Type::VARIO_1_DOTS ||
-             settings.type == TrailSettings::Type::VARIO_2_DOTS ||
-             settings.type == TrailSettings::Type::VARIO_DOTS_AND_LINES ||
-             settings.type == TrailSettings::Type::VARIO_EINK)) {
+        if (i.GetVario() < 0 && HasDots(settings.type)) {
           canvas.SelectNullPen();
           canvas.Select(look.trail_brushes[color_index]);
           canvas.DrawCircle({(pt.x + last_point.x) / 2, (pt.y + last_point.y) / 2},
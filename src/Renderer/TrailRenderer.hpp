@@ -8,6 +8,10 @@
 #include "Engine/Trace/Vector.hpp"
 #include "time/Stamp.hpp"
 
+#ifdef ENABLE_OPENGL
+#include "TrailBuffer.hpp"
+#endif
+
 struct PixelPoint;
 struct BulkPixelPoint;
 class Canvas;
@@ -32,6 +36,14 @@ class TrailRenderer {
   TracePointVector trace;
   AllocatedArray<BulkPixelPoint> points;
 
+#ifdef ENABLE_OPENGL
+  /**
+   * The full trace in an OpenGL vertex buffer, which is updated
+   * incrementally; used for the line styles of the trail.
+   */
+  TrailBuffer buffer;
+#endif
+
 public:
   TrailRenderer(const TrailLook &_look) noexcept:look(_look) {}
 
@@ -89,4 +101,15 @@ public:
 private:
   void DrawTraceVector(Canvas &canvas, const Projection &projection,
                        const TracePointVector &trace) noexcept;
+
+#ifdef ENABLE_OPENGL
+  /**
+   * Draw the trail from the #TrailBuffer, projected by the GPU.
+   */
+  void DrawBuffered(Canvas &canvas, const TraceComputer &trace_computer,
+                    const WindowProjection &projection,
+                    TimeStamp min_time, const GeoPoint *traildrift,
+                    PixelPoint pos, TimeStamp now,
+                    const TrailSettings &settings) noexcept;
+#endif
 };
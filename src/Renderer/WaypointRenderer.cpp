@@ -30,7 +30,11 @@
 #include "Engine/Route/ReachResult.hpp"
 #include "Look/WaypointLook.hpp"
 
+#include <array>
 #include <cassert>
+#include <optional>
+#include <span>
+
 #include <stdio.h>
 
 /**
@@ -86,29 +90,24 @@ struct VisibleWaypoint {
       reachable = WaypointReachability::UNREACHABLE;
   }
 
-  bool CalculateRouteArrival(const ProtectedRoutePlanner &route_planner,
-                             const TaskBehaviour &task_behaviour) noexcept {
+  /**
+   * Returns the destination for the reach calculation, or nullopt
+   * if this waypoint has no elevation.
+   */
+  [[gnu::pure]]
+  std::optional<AGeoPoint> GetRouteDestination(const TaskBehaviour &task_behaviour) const noexcept {
     if (!waypoint->has_elevation)
-      return false;
+      return std::nullopt;
 
     const double elevation = waypoint->elevation +
       task_behaviour.safety_height_arrival;
-    const AGeoPoint p_dest (waypoint->location, elevation);
-
-    auto _reach = route_planner.FindPositiveArrival(p_dest);
-    if (!_reach)
-      return false;
-
-    reach = *_reach;
-    reach.Subtract(elevation);
-    return true;
+    return AGeoPoint(waypoint->location, elevation);
   }
 
-  void CalculateReachability(const ProtectedRoutePlanner &route_planner,
-                             const TaskBehaviour &task_behaviour) noexcept
-  {
-    if (!CalculateRouteArrival(route_planner, task_behaviour))
-      return;
+  void SetRouteArrival(const ReachResult &_reach, const AGeoPoint &dest,
+                       const TaskBehaviour &task_behaviour) noexcept {
+    reach = _reach;
+    reach.Subtract(dest.altitude);
 
     if (!reach.IsReachableDirect())
       reachable = WaypointReachability::UNREACHABLE;
@@ -144,7 +143,8 @@ class WaypointVisitorMap final
    * should ensure that the drawing methods don't need to hold a
    * mutex.
    */
-  StaticArray<VisibleWaypoint, 256> waypoints;
+  static constexpr std::size_t MAX_WAYPOINTS = 256;
+  StaticArray<VisibleWaypoint, MAX_WAYPOINTS> waypoints;
 
   WaypointIconRenderer icon_renderer;
 
@@ -399,12 +399,34 @@ public:
   }
 
   void CalculateRoute(const ProtectedRoutePlanner &route_planner) noexcept {
+    /* collect all destinations and resolve them with one batch call
+       to the route planner */
+    StaticArray<VisibleWaypoint *, MAX_WAYPOINTS> route_waypoints;
+    StaticArray<AGeoPoint, MAX_WAYPOINTS> dests;
+
     for (VisibleWaypoint &vwp : waypoints) {
       const Waypoint &way_point = *vwp.waypoint;
 
-      if (way_point.IsLandable() || way_point.flags.watched)
-        vwp.CalculateReachability(route_planner, task_behaviour);
+      if (!way_point.IsLandable() && !way_point.flags.watched)
+        continue;
+
+      if (const auto dest = vwp.GetRouteDestination(task_behaviour)) {
+        route_waypoints.push_back(&vwp);
+        dests.push_back(*dest);
+      }
     }
+
+    if (dests.empty())
+      return;
+
+    std::array<ReachResult, MAX_WAYPOINTS> results;
+    if (!route_planner.FindPositiveArrivals(dests,
+                                            std::span{results}.first(dests.size())))
+      return;
+
+    for (std::size_t i = 0; i < dests.size(); ++i)
+      route_waypoints[i]->SetRouteArrival(results[i], dests[i],
+                                          task_behaviour);
   }
 
   void CalculateDirect(const PolarSettings &polar_settings,
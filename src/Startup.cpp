@@ -52,6 +52,7 @@
 #include "Monitor/AllMonitors.hpp"
 #include "MergeThread.hpp"
 #include "CalculationThread.hpp"
+#include "TargetOptimiserThread.hpp"
 #include "Replay/Replay.hpp"
 #include "LocalPath.hpp"
 #include "io/FileCache.hpp"
@@ -387,6 +388,9 @@ Startup(UI::Display &display)
   backend_components->glide_computer->SetLogger(backend_components->igc_logger.get());
   backend_components->glide_computer->Initialise();
 
+  /* don't let the contest solver delay the other calculations */
+  backend_components->glide_computer->SetBackgroundContest(true);
+
   backend_components->replay =
     std::make_unique<Replay>(*backend_components->device_blackboard,
                              backend_components->igc_logger.get(),
@@ -563,6 +567,7 @@ Startup(UI::Display &display)
   // Start calculation thread
   backend_components->merge_thread->Start();
   backend_components->calculation_thread->Start();
+  backend_components->target_optimiser_thread->Start();
 
   PageActions::Update();
 
@@ -656,6 +661,9 @@ Shutdown()
 #endif
 
   if (backend_components != nullptr) {
+    if (backend_components->target_optimiser_thread)
+      backend_components->target_optimiser_thread->BeginStop();
+
     if (backend_components->calculation_thread)
       backend_components->calculation_thread->BeginStop();
 
@@ -674,6 +682,11 @@ Shutdown()
       backend_components->calculation_thread->Join();
       backend_components->calculation_thread.reset();
     }
+
+    if (backend_components->target_optimiser_thread) {
+      backend_components->target_optimiser_thread->Join();
+      backend_components->target_optimiser_thread.reset();
+    }
   }
 
   //  Wait for the drawing thread to finish
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "TargetOptimiserThread.hpp"
+#include "Blackboard/DeviceBlackboard.hpp"
+#include "Task/ProtectedTaskManager.hpp"
+#include "Engine/Task/TaskManager.hpp"
+#include "NMEA/Aircraft.hpp"
+#include "Engine/Navigation/Aircraft.hpp"
+#include "Profiler/Profiler.hpp"
+
+static constinit Profiler::Zone tick_zone{"TargetOptimiserThread"};
+
+TargetOptimiserThread::TargetOptimiserThread(DeviceBlackboard &_device_blackboard,
+                                             ProtectedTaskManager &_task_manager) noexcept
+  :WorkerThread("TargetOpt",
+                std::chrono::seconds{2},
+                std::chrono::milliseconds{200}),
+   device_blackboard(_device_blackboard),
+   task_manager(_task_manager)
+{
+}
+
+void
+TargetOptimiserThread::Start(bool suspended)
+{
+  {
+    ProtectedTaskManager::ExclusiveLease lease(task_manager);
+    lease->SetBackgroundTargetOptimisation(true);
+  }
+
+  WorkerThread::Start(suspended);
+}
+
+void
+TargetOptimiserThread::BeginStop() noexcept
+{
+  {
+    /* let the CalculationThread optimise the active target again */
+    ProtectedTaskManager::ExclusiveLease lease(task_manager);
+    lease->SetBackgroundTargetOptimisation(false);
+  }
+
+  WorkerThread::BeginStop();
+}
+
+void
+TargetOptimiserThread::Tick() noexcept
+{
+  if (!priority_lowered) {
+    /* this must be called by the new thread, because it affects the
+       calling thread */
+    SetIdlePriority();
+    priority_lowered = true;
+  }
+
+  const Profiler::Scope profile{tick_zone};
+
+  AircraftState state;
+
+  {
+    const std::lock_guard lock{device_blackboard.mutex};
+    const auto &basic = device_blackboard.Basic();
+    if (!basic.location_available)
+      return;
+
+    state = ToAircraftState(basic, device_blackboard.Calculated());
+  }
+
+  /* lock the task only for one sweep at a time, so the
+     CalculationThread does not have to wait for long */
+  for (unsigned i = 0; i < MAX_SWEEPS && !CheckStoppedOrSuspended(); ++i) {
+    ProtectedTaskManager::ExclusiveLease lease(task_manager);
+    if (!lease->OptimiseTargets(state))
+      break;
+  }
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "thread/WorkerThread.hpp"
+
+class DeviceBlackboard;
+class ProtectedTaskManager;
+
+/**
+ * The TargetOptimiserThread moves the targets of all remaining AAT
+ * points of the ordered task jointly along their isolines (see
+ * OrderedTask::OptimiseTargets()), which is too expensive to be done
+ * by the #CalculationThread on long tasks.  Improved targets are
+ * written to the task as soon as they are found; the
+ * #CalculationThread keeps them when it recalculates the target
+ * ranges.
+ *
+ * It is triggered by the #CalculationThread after each idle
+ * calculation.
+ */
+class TargetOptimiserThread final : public WorkerThread {
+  /**
+   * The maximum number of optimiser sweeps per Tick().  The task is
+   * unlocked between two sweeps.
+   */
+  static constexpr unsigned MAX_SWEEPS = 4;
+
+  DeviceBlackboard &device_blackboard;
+  ProtectedTaskManager &task_manager;
+
+  /**
+   * Has this thread lowered its priority already?  Accessed only by
+   * this thread.
+   */
+  bool priority_lowered = false;
+
+public:
+  TargetOptimiserThread(DeviceBlackboard &_device_blackboard,
+                        ProtectedTaskManager &_task_manager) noexcept;
+
+  /**
+   * Throws on error.
+   */
+  void Start(bool suspended=false);
+
+  void BeginStop() noexcept;
+
+protected:
+  void Tick() noexcept override;
+};
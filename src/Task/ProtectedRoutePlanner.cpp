@@ -4,6 +4,9 @@
 #include "ProtectedRoutePlanner.hpp"
 #include "Engine/Route/ReachResult.hpp"
 
+#include <cassert>
+#include <vector>
+
 void
 ProtectedRoutePlanner::SetTerrain(const RasterTerrain *terrain) noexcept
 {
@@ -57,6 +60,8 @@ ProtectedRoutePlanner::SolveReach(const AGeoPoint &origin,
   const std::scoped_lock lock{reach_mutex};
   reach_terrain = std::move(rt);
   reach_working = std::move(rw);
+  ++reach_serial;
+  arrival_cache.clear();
 }
 
 const FlatProjection
@@ -70,7 +75,56 @@ std::optional<ReachResult>
 ProtectedRoutePlanner::FindPositiveArrival(const AGeoPoint &dest) const noexcept
 {
   const std::scoped_lock lock{reach_mutex};
-  return reach_terrain.FindPositiveArrival(dest, rpolars_reach);
+
+  if (auto i = arrival_cache.find(dest); i != arrival_cache.end())
+    return i->second;
+
+  auto result = reach_terrain.FindPositiveArrival(dest, rpolars_reach);
+  if (result && arrival_cache.size() < MAX_ARRIVAL_CACHE)
+    arrival_cache.emplace(dest, *result);
+
+  return result;
+}
+
+bool
+ProtectedRoutePlanner::FindPositiveArrivals(std::span<const AGeoPoint> dests,
+                                            std::span<ReachResult> results) const noexcept
+{
+  assert(dests.size() == results.size());
+
+  const std::scoped_lock lock{reach_mutex};
+
+  if (reach_terrain.IsEmpty())
+    return false;
+
+  /* collect the destinations which are not in the cache */
+  std::vector<AGeoPoint> missing_dests;
+  std::vector<std::size_t> missing_indices;
+
+  for (std::size_t i = 0; i < dests.size(); ++i) {
+    if (auto j = arrival_cache.find(dests[i]); j != arrival_cache.end()) {
+      results[i] = j->second;
+    } else {
+      missing_dests.push_back(dests[i]);
+      missing_indices.push_back(i);
+    }
+  }
+
+  if (missing_dests.empty())
+    return true;
+
+  std::vector<ReachResult> missing_results(missing_dests.size());
+  reach_terrain.FindPositiveArrivals(missing_dests, missing_results,
+                                     rpolars_reach);
+
+  for (std::size_t i = 0; i < missing_dests.size(); ++i) {
+    results[missing_indices[i]] = missing_results[i];
+
+    if (arrival_cache.size() < MAX_ARRIVAL_CACHE)
+      arrival_cache.emplace(missing_dests[i], missing_results[i]);
+  }
+
+  return true;
 }
 
 void
@@ -6,7 +6,13 @@
 #include "RoutePlannerGlue.hpp"
 #include "Engine/Route/ReachFan.hpp"
 #include "Engine/Route/RoutePolars.hpp"
+#include "Engine/Route/ReachResult.hpp"
 #include "thread/Mutex.hxx"
+#include "util/Serial.hpp"
+
+#include <functional> // for std::hash
+#include <span>
+#include <unordered_map>
 
 struct GlideSettings;
 struct RoutePlannerConfig;
@@ -20,6 +26,30 @@ class Airspaces;
  */
 class ProtectedRoutePlanner
 {
+  struct AGeoPointHash {
+    [[gnu::pure]]
+    std::size_t operator()(const AGeoPoint &p) const noexcept {
+      const std::hash<double> h;
+      return (h(p.latitude.Native()) * 31 + h(p.longitude.Native())) * 31 +
+        h(p.altitude);
+    }
+  };
+
+  struct AGeoPointEqual {
+    constexpr bool operator()(const AGeoPoint &a,
+                              const AGeoPoint &b) const noexcept {
+      return (const GeoPoint &)a == (const GeoPoint &)b &&
+        a.altitude == b.altitude;
+    }
+  };
+
+  /**
+   * Never cache more than this number of arrival results; this is
+   * just a safeguard, because the cache is flushed with each new
+   * reach calculation anyway.
+   */
+  static constexpr std::size_t MAX_ARRIVAL_CACHE = 4096;
+
   const Airspaces &airspaces;
   const ProtectedAirspaceWarningManager *warnings;
 
@@ -37,6 +67,19 @@ class ProtectedRoutePlanner
   ReachFan reach_terrain;
   ReachFan reach_working;
 
+  /**
+   * Incremented each time #reach_terrain is modified.
+   */
+  Serial reach_serial;
+
+  /**
+   * Results of FindPositiveArrival() for #reach_terrain, shared by
+   * the map renderer and the alternates calculation.  It is flushed
+   * whenever #reach_serial changes.  Protected by #reach_mutex.
+   */
+  mutable std::unordered_map<AGeoPoint, ReachResult,
+                             AGeoPointHash, AGeoPointEqual> arrival_cache;
+
 public:
   ProtectedRoutePlanner(RoutePlannerGlue &route, const Airspaces &_airspaces,
                         const ProtectedAirspaceWarningManager *_warnings) noexcept
@@ -54,6 +97,18 @@ public:
     const std::scoped_lock lock{reach_mutex};
     reach_terrain.Reset();
     reach_working.Reset();
+    ++reach_serial;
+    arrival_cache.clear();
+  }
+
+  /**
+   * Returns a #Serial that gets incremented whenever the terrain
+   * reach is recalculated or cleared.
+   */
+  [[gnu::pure]]
+  Serial GetReachSerial() const noexcept {
+    const std::scoped_lock lock{reach_mutex};
+    return reach_serial;
   }
 
   [[gnu::pure]]
@@ -83,6 +138,19 @@ public:
   [[gnu::pure]]
   std::optional<ReachResult> FindPositiveArrival(const AGeoPoint &dest) const noexcept;
 
+  /**
+   * Batch version of FindPositiveArrival() which resolves all
+   * destinations with one lock and one walk of the reach fan tree.
+   * Results are cached until the reach gets recalculated.
+   *
+   * @param results the results for each destination (same size as
+   * #dests)
+   * @return false if no terrain reach is available (#results is
+   * undefined then)
+   */
+  bool FindPositiveArrivals(std::span<const AGeoPoint> dests,
+                            std::span<ReachResult> results) const noexcept;
+
   void AcceptInRange(const GeoBounds &bounds,
                      FlatTriangleFanVisitor &visitor,
                      bool working) const noexcept;
@@ -9,6 +9,9 @@
 #include "Engine/Task/Points/TaskWaypoint.hpp"
 #include "Engine/Route/ReachResult.hpp"
 
+#include <algorithm>
+#include <vector>
+
 ProtectedTaskManager::ProtectedTaskManager(TaskManager &_task_manager,
                                            const TaskBehaviour &tb) noexcept
   :Guard<TaskManager>(_task_manager),
@@ -150,6 +153,21 @@ ProtectedTaskManager::SetRoutePlanner(const ProtectedRoutePlanner *_route) noexc
   lease->SetIntersectionTest(&intersection_test);
 }
 
+/**
+ * Does the reach result say that the destination cannot be reached
+ * above its altitude?
+ */
+[[gnu::pure]]
+static bool
+Intersects(const ReachResult &result, const AGeoPoint &destination) noexcept
+{
+  // we use find_positive_arrival here instead of is_inside, because may use
+  // arrival height for sorting later
+  return result.terrain_valid == ReachResult::Validity::UNREACHABLE ||
+    (result.terrain_valid == ReachResult::Validity::VALID &&
+     result.terrain < destination.altitude);
+}
+
 bool
 ReachIntersectionTest::Intersects(const AGeoPoint &destination) const noexcept
 {
@@ -160,11 +178,21 @@ ReachIntersectionTest::Intersects(const AGeoPoint &destination) const noexcept
   if (!result)
     return false;
 
-  // we use find_positive_arrival here instead of is_inside, because may use
-  // arrival height for sorting later
-  return result->terrain_valid == ReachResult::Validity::UNREACHABLE ||
-    (result->terrain_valid == ReachResult::Validity::VALID &&
-     result->terrain < destination.altitude);
+  return ::Intersects(*result, destination);
+}
+
+void
+ReachIntersectionTest::Intersects(std::span<const AGeoPoint> destinations,
+                                  std::span<bool> results) const noexcept
+{
+  std::vector<ReachResult> reach(destinations.size());
+  if (!route || !route->FindPositiveArrivals(destinations, reach)) {
+    std::fill(results.begin(), results.end(), false);
+    return;
+  }
+
+  for (std::size_t i = 0; i < destinations.size(); ++i)
+    results[i] = ::Intersects(reach[i], destinations[i]);
 }
 
 void
@@ -27,7 +27,9 @@ public:
     route = _route;
   }
 
-  virtual bool Intersects(const AGeoPoint &destination) const noexcept;
+  bool Intersects(const AGeoPoint &destination) const noexcept override;
+  void Intersects(std::span<const AGeoPoint> destinations,
+                  std::span<bool> results) const noexcept override;
 };
 
 /**
@@ -16,6 +16,14 @@ class RoutePlannerGlue {
 public:
   void SetTerrain(const RasterTerrain *terrain);
 
+  void SetReachPool(WorkStealingPool *pool) noexcept {
+    planner.SetReachPool(pool);
+  }
+
+  void SetIncremental(bool incremental) noexcept {
+    planner.SetIncremental(incremental);
+  }
+
   void UpdatePolar(const GlideSettings &settings,
                    const RoutePlannerConfig &config,
                    const GlidePolar &polar,
@@ -78,3 +78,18 @@ HeightMatrix::Fill(const RasterMap &map, const WindowProjection &projection,
 }
 
 #endif
+
+void
+HeightMatrix::Blend(const HeightMatrix &other, double fraction) noexcept
+{
+  assert(other.size == size);
+
+  /* fixed point weight with 8 bits */
+  const int weight = int(fraction * 256);
+
+  const TerrainHeight *b = other.GetData();
+  for (auto *a = data.data(), *end = a + size.Area(); a != end; ++a, ++b)
+    if (!a->IsSpecial() && !b->IsSpecial())
+      *a = TerrainHeight(a->GetValue() +
+                         ((b->GetValue() - a->GetValue()) * weight) / 256);
+}
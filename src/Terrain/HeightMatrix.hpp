@@ -46,6 +46,15 @@ public:
             unsigned quantisation_pixels, bool interpolate) noexcept;
 #endif
 
+  /**
+   * Interpolate linearly between this matrix and the given one,
+   * which must have the same size.  Where one of the two values is
+   * special (water or invalid), this matrix's value is kept.
+   *
+   * @param fraction the weight of the other matrix (0..1)
+   */
+  void Blend(const HeightMatrix &other, double fraction) noexcept;
+
   UnsignedPoint2D GetSize() const noexcept {
     return size;
   }
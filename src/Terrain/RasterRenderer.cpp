@@ -170,6 +170,23 @@ RasterRenderer::ScanMap(const RasterMap &map,
 #endif
 }
 
+void
+RasterRenderer::ScanMap(const RasterMap &map, const RasterMap &next_map,
+                        double fraction,
+                        const WindowProjection &projection) noexcept
+{
+  ScanMap(map, projection);
+
+  /* scan the second map with exactly the same geometry */
+#ifdef ENABLE_OPENGL
+  blend_matrix.Fill(next_map, bounds, height_matrix.GetSize(), true);
+#else
+  blend_matrix.Fill(next_map, projection, quantisation_pixels, true);
+#endif
+
+  height_matrix.Blend(blend_matrix, fraction);
+}
+
 void
 RasterRenderer::GenerateImage(bool do_shading,
                               unsigned height_scale,
@@ -51,6 +51,11 @@ class RasterRenderer {
 #endif
 
   HeightMatrix height_matrix;
+
+  /**
+   * A second matrix for ScanMap() with two maps.
+   */
+  HeightMatrix blend_matrix;
   RawBitmap *image = nullptr;
 
   unsigned char *contour_column_base = nullptr;
@@ -108,6 +113,16 @@ public:
   void ScanMap(const RasterMap &map,
                const WindowProjection &projection) noexcept;
 
+  /**
+   * Scan both maps and fill the height matrix with values linearly
+   * interpolated between them.
+   *
+   * @param fraction the weight of the second map (0..1)
+   */
+  void ScanMap(const RasterMap &map, const RasterMap &next_map,
+               double fraction,
+               const WindowProjection &projection) noexcept;
+
   /**
    * Convert the height matrix into the image.
    */
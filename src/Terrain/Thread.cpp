@@ -4,8 +4,11 @@
 #include "Thread.hpp"
 #include "RasterTerrain.hpp"
 #include "Projection/WindowProjection.hpp"
+#include "Profiler/Profiler.hpp"
 #include "thread/Util.hpp"
 
+static constinit Profiler::Zone update_tiles_zone{"TerrainUpdateTiles"};
+
 TerrainThread::TerrainThread(RasterTerrain &_terrain,
                              std::function<void()> &&_callback)
   :StandbyThread("Terrain"), terrain(_terrain),
@@ -41,6 +44,7 @@ TerrainThread::Tick() noexcept
 
     {
       const ScopeUnlock unlock(mutex);
+      const Profiler::Scope profile{update_tiles_zone};
       again = terrain.UpdateTiles(center, radius);
     }
 
@@ -3,6 +3,9 @@
 
 #include "Thread.hpp"
 #include "TopographyStore.hpp"
+#include "Profiler/Profiler.hpp"
+
+static constinit Profiler::Zone scan_zone{"TopographyScanVisibility"};
 
 TopographyThread::TopographyThread(TopographyStore &_store,
                                    std::function<void()> &&_callback)
@@ -53,6 +56,7 @@ TopographyThread::Tick() noexcept
     const WindowProjection projection = next_projection;
 
     const ScopeUnlock unlock(mutex);
+    const Profiler::Scope profile{scan_zone};
     again = store.ScanVisibility(projection, 1) > 0;
   }
 
@@ -6,6 +6,8 @@
 #include "Terrain/RasterMap.hpp"
 #include "Terrain/Loader.hpp"
 #include "Language/Language.hpp"
+#include "Operation/Operation.hpp"
+#include "Profiler/Profiler.hpp"
 #include "system/Path.hpp"
 #include "io/ZipArchive.hpp"
 #include "LogFile.hpp"
@@ -13,10 +15,21 @@
 #include <cassert>
 #include <windef.h> // for MAX_PATH
 
-RaspCache::RaspCache(const RaspStore &_store, unsigned _parameter) noexcept
-  :store(_store), parameter(_parameter) {}
+static constinit Profiler::Zone load_zone{"RaspLoad"};
 
-RaspCache::~RaspCache() noexcept = default;
+static constexpr unsigned NO_TIME = RaspStore::MAX_WEATHER_TIMES;
+
+RaspCache::RaspCache(const RaspStore &_store, unsigned _parameter,
+                     std::function<void()> &&_callback) noexcept
+  :StandbyThread("RaspCache"),
+   store(_store), parameter(_parameter),
+   callback(std::move(_callback)),
+   map_time(NO_TIME), next_map_time(NO_TIME) {}
+
+RaspCache::~RaspCache() noexcept
+{
+  LockStop();
+}
 
 static constexpr unsigned
 ToQuarterHours(BrokenTime t)
@@ -24,6 +37,38 @@ ToQuarterHours(BrokenTime t)
   return t.hour * 4u + t.minute / 15;
 }
 
+/**
+ * Find the last available time index which is not after the given
+ * one.
+ */
+[[gnu::pure]]
+static unsigned
+FindPrevious(const RaspStore &store, unsigned parameter,
+             unsigned time_index) noexcept
+{
+  for (int t = time_index; t >= 0; --t)
+    if (store.IsTimeAvailable(parameter, t))
+      return t;
+
+  return NO_TIME;
+}
+
+/**
+ * Find the first available time index which is not before the given
+ * one.
+ */
+[[gnu::pure]]
+static unsigned
+FindNext(const RaspStore &store, unsigned parameter,
+         unsigned time_index) noexcept
+{
+  for (unsigned t = time_index; t < RaspStore::MAX_WEATHER_TIMES; ++t)
+    if (store.IsTimeAvailable(parameter, t))
+      return t;
+
+  return NO_TIME;
+}
+
 const TCHAR *
 RaspCache::GetMapName() const
 {
@@ -61,51 +106,160 @@ RaspCache::IsInside(GeoPoint p) const
 }
 
 void
-RaspCache::Reload(BrokenTime time_local, OperationEnvironment &operation)
+RaspCache::Enqueue(unsigned time_index) noexcept
 {
-  unsigned effective_time = time;
-  if (effective_time == 0) {
-    // "Now" time, so find time in half hours
+  if (time_index != NO_TIME && maps.Get(time_index) == nullptr &&
+      !queue.contains(time_index))
+    queue.checked_append(time_index);
+}
+
+void
+RaspCache::Reload(BrokenTime time_local)
+{
+  unsigned wanted = NO_TIME, wanted_next = NO_TIME;
+  double wanted_fraction = 0;
+
+  if (time != 0) {
+    wanted = store.GetNearestTime(parameter, time);
+  } else {
+    // "Now" time, so find time in quarter hours
     if (!time_local.IsPlausible())
       /* can't update to current time if we don't know the current
          time */
       return;
 
-    effective_time = ToQuarterHours(time_local);
-    assert(effective_time < RaspStore::MAX_WEATHER_TIMES);
+    const unsigned minute = time_local.GetMinuteOfDay();
+    const unsigned now = ToQuarterHours(time_local);
+    assert(now < RaspStore::MAX_WEATHER_TIMES);
+
+    if (interpolate) {
+      const unsigned before = FindPrevious(store, parameter, now);
+      const unsigned after = now + 1 < RaspStore::MAX_WEATHER_TIMES
+        ? FindNext(store, parameter, now + 1)
+        : NO_TIME;
+      if (before != NO_TIME && after != NO_TIME) {
+        wanted = before;
+        wanted_next = after;
+        wanted_fraction = double(minute - before * 15) /
+          ((after - before) * 15);
+      }
+    }
+
+    if (wanted == NO_TIME)
+      wanted = store.GetNearestTime(parameter, now);
   }
 
-  if (effective_time == last_time)
-    // no change, quick exit.
+  if (wanted == NO_TIME)
     return;
 
-  last_time = effective_time;
+  fraction = wanted_fraction;
 
-  effective_time = store.GetNearestTime(parameter, effective_time);
-  if (effective_time == RaspStore::MAX_WEATHER_TIMES)
+  if (wanted == map_time && wanted_next == next_map_time)
+    // no change, quick exit.
     return;
 
-  map.reset();
+  const std::lock_guard lock{mutex};
+
+  queue.clear();
+
+  if (const auto *p = maps.Get(wanted)) {
+    map = *p;
+    map_time = wanted;
+  } else
+    /* keep showing the previous map until the new one has been
+       loaded */
+    Enqueue(wanted);
+
+  next_map.reset();
+  next_map_time = NO_TIME;
+  if (wanted_next != NO_TIME) {
+    if (const auto *p = maps.Get(wanted_next)) {
+      if (map_time == wanted) {
+        next_map = *p;
+        next_map_time = wanted_next;
+      }
+    } else
+      Enqueue(wanted_next);
+  }
+
+  /* prefetch the adjacent time steps */
+  if (wanted > 0)
+    Enqueue(FindPrevious(store, parameter, wanted - 1));
+
+  const unsigned last = wanted_next != NO_TIME ? wanted_next : wanted;
+  if (last + 1 < RaspStore::MAX_WEATHER_TIMES)
+    Enqueue(FindNext(store, parameter, last + 1));
 
+  if (!queue.empty()) {
+    try {
+      Trigger();
+    } catch (...) {
+      LogError(std::current_exception(), "Failed to start RASP loader");
+    }
+  }
+}
+
+std::shared_ptr<const RasterMap>
+RaspCache::Load(unsigned time_index) const
+{
   auto archive = store.OpenArchive();
-  if (!archive)
-    return;
 
   char new_name[MAX_PATH];
-  store.NarrowWeatherFilename(new_name, Path(store.GetItemInfo(parameter).name),
-                              effective_time);
-
-  auto new_map = std::make_unique<RasterMap>();
-  try {
-    LoadTerrainOverview(archive->get(), new_name, nullptr,
-                        new_map->GetTileCache(),
-                        true, operation);
-  } catch (...) {
-    LogError(std::current_exception(), "Failed to load RASP file");
-    return;
-  }
+  store.NarrowWeatherFilename(new_name,
+                              Path(store.GetItemInfo(parameter).name),
+                              time_index);
+
+  auto new_map = std::make_shared<RasterMap>();
+
+  NullOperationEnvironment operation;
+  LoadTerrainOverview(archive->get(), new_name, nullptr,
+                      new_map->GetTileCache(),
+                      true, operation);
 
   new_map->UpdateProjection();
+  return new_map;
+}
 
-  map = std::move(new_map);
+void
+RaspCache::Tick() noexcept
+{
+  if (!priority_lowered) {
+    SetLowPriority();
+    priority_lowered = true;
+  }
+
+  bool loaded = false;
+
+  while (!queue.empty() && !IsStopped()) {
+    const unsigned time_index = queue.front();
+    queue.remove(0);
+
+    if (maps.Get(time_index) != nullptr)
+      /* already loaded */
+      continue;
+
+    std::shared_ptr<const RasterMap> new_map;
+
+    {
+      const ScopeUnlock unlock(mutex);
+      const Profiler::Scope profile{load_zone};
+
+      try {
+        new_map = Load(time_index);
+      } catch (...) {
+        LogError(std::current_exception(), "Failed to load RASP file");
+      }
+    }
+
+    /* a nullptr value remembers the failure, so it is not retried
+       over and over */
+    maps.Put(time_index, std::move(new_map));
+    loaded = true;
+  }
+
+  /* notify the client */
+  if (loaded && callback) {
+    const ScopeUnlock unlock(mutex);
+    callback();
+  }
 }
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include "thread/StandbyThread.hpp"
+#include "util/StaticArray.hxx"
+#include "util/StaticCache.hxx"
+
+#include <functional>
 #include <memory>
 
 #include <tchar.h>
@@ -11,24 +16,79 @@ struct BrokenTime;
 struct GeoPoint;
 class RaspStore;
 class RasterMap;
-class OperationEnvironment;
 
 /**
  * Class to manage the raster weather map, to be loaded/selected from
  * a #RaspStore instance.
+ *
+ * Decoded maps are kept in a small LRU cache, and they are loaded by
+ * a background thread which also prefetches the time steps adjacent
+ * to the current one.  Until the requested map has been loaded, the
+ * previous one remains visible.
  */
-class RaspCache {
+class RaspCache final : private StandbyThread {
+  /**
+   * The maximum number of decoded maps kept in memory.
+   */
+  static constexpr unsigned CACHE_SIZE = 6;
+
   const RaspStore &store;
 
   const unsigned parameter;
 
+  /**
+   * Invoked by the loader thread after it has loaded one or more
+   * maps.
+   */
+  const std::function<void()> callback;
+
   unsigned time = 0;
-  unsigned last_time = 0;
 
-  std::unique_ptr<RasterMap> map;
+  /**
+   * Interpolate between the two time steps around the current time
+   * of day?  Only used if #time is 0 ("now").
+   */
+  bool interpolate = false;
+
+  /**
+   * The decoded maps by time index.  A nullptr value means loading
+   * this map has failed.  Protected by StandbyThread::mutex.
+   */
+  StaticCache<unsigned, std::shared_ptr<const RasterMap>,
+              CACHE_SIZE, 7> maps;
+
+  /**
+   * The time indices which shall be loaded by the thread, most
+   * urgent first.  Protected by StandbyThread::mutex.
+   */
+  StaticArray<unsigned, 4> queue;
+
+  /**
+   * Has the loader thread lowered its priority already?  Accessed
+   * only by the loader thread.
+   */
+  bool priority_lowered = false;
+
+  /**
+   * The map being displayed, and the one it is interpolated with
+   * (or nullptr).  Accessed only by the client thread.
+   */
+  std::shared_ptr<const RasterMap> map, next_map;
+
+  /**
+   * The time indices of #map and #next_map, or
+   * RaspStore::MAX_WEATHER_TIMES.
+   */
+  unsigned map_time, next_map_time;
+
+  /**
+   * The weight of #next_map in the interpolation.
+   */
+  double fraction = 0;
 
 public:
-  RaspCache(const RaspStore &_store, unsigned _parameter) noexcept;
+  RaspCache(const RaspStore &_store, unsigned _parameter,
+            std::function<void()> &&_callback={}) noexcept;
   ~RaspCache() noexcept;
 
   const RaspStore &GetStore() const {
@@ -40,6 +100,20 @@ public:
     return map.get();
   }
 
+  /**
+   * Returns the map which shall be blended into GetMap() with the
+   * weight GetInterpolationFraction(), or nullptr if interpolation
+   * is disabled or not possible.
+   */
+  [[gnu::pure]]
+  const RasterMap *GetNextMap() const {
+    return next_map.get();
+  }
+
+  double GetInterpolationFraction() const {
+    return fraction;
+  }
+
   /**
    * Returns the current map's name.
    */
@@ -65,9 +139,13 @@ public:
   bool IsInside(GeoPoint p) const;
 
   /**
-   * @param day_time the local time, in seconds since midnight
+   * Select the maps for the current time from the cache, and ask
+   * the loader thread to load the missing ones and to prefetch the
+   * adjacent time steps.  This method never waits for the decoder.
+   *
+   * @param time_local the local time
    */
-  void Reload(BrokenTime time_local, OperationEnvironment &operation);
+  void Reload(BrokenTime time_local);
 
   /**
    * Returns the current time index.
@@ -79,4 +157,32 @@ public:
    * Sets the current time index.
    */
   void SetTime(BrokenTime t);
+
+  /**
+   * Enable or disable interpolation between the two time steps
+   * around the current time of day.
+   */
+  void SetInterpolate(bool _interpolate) {
+    interpolate = _interpolate;
+  }
+
+private:
+  /**
+   * Ask the loader thread to load the given time index if it is not
+   * in the cache yet.  Does nothing if the value is
+   * RaspStore::MAX_WEATHER_TIMES.
+   *
+   * Caller must lock the mutex.
+   */
+  void Enqueue(unsigned time_index) noexcept;
+
+  /**
+   * Decode the map of the given time index from the archive.
+   *
+   * Throws on error.
+   */
+  std::shared_ptr<const RasterMap> Load(unsigned time_index) const;
+
+  /* virtual methods from class StandbyThread */
+  void Tick() noexcept override;
 };
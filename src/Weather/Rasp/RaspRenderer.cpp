@@ -45,7 +45,11 @@ RaspRenderer::Generate(const WindowProjection &projection,
     last_color_ramp = color_ramp;
   }
 
-  raster_renderer.ScanMap(*map, projection);
+  if (const RasterMap *next_map = cache.GetNextMap())
+    raster_renderer.ScanMap(*map, *next_map,
+                            cache.GetInterpolationFraction(), projection);
+  else
+    raster_renderer.ScanMap(*map, projection);
 
   raster_renderer.GenerateImage(false, height_scale,
                                 settings.contrast, settings.brightness,
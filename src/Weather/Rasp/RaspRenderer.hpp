@@ -25,8 +25,13 @@ class RaspRenderer {
   const ColorRamp *last_color_ramp = nullptr;
 
 public:
-  RaspRenderer(const RaspStore &_store, unsigned parameter)
-    :cache(_store, parameter) {}
+  /**
+   * @param callback invoked by the loader thread after new maps have
+   * been loaded
+   */
+  RaspRenderer(const RaspStore &_store, unsigned parameter,
+               std::function<void()> &&callback={})
+    :cache(_store, parameter, std::move(callback)) {}
 
   /**
    * Flush the cache.
@@ -61,8 +66,12 @@ public:
     cache.SetTime(t);
   }
 
-  void Update(BrokenTime time_local, OperationEnvironment &operation) {
-    cache.Reload(time_local, operation);
+  void SetInterpolate(bool interpolate) {
+    cache.SetInterpolate(interpolate);
+  }
+
+  void Update(BrokenTime time_local) {
+    cache.Reload(time_local);
   }
 
   /**
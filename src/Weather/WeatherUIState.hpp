@@ -20,8 +20,15 @@ struct WeatherUIState {
    */
   BrokenTime time;
 
+  /**
+   * Interpolate between the two forecast steps around the current
+   * time of day?  Only used if #time is invalid ("now").
+   */
+  bool interpolate;
+
   void Clear() {
     map = -1;
     time = BrokenTime::Invalid();
+    interpolate = false;
   }
 };
@@ -23,11 +23,11 @@ CSVLine::CSVLine(const char *line) noexcept
 std::string_view
 CSVLine::ReadView() noexcept
 {
-  const char* _seperator = strchr(data, ',');
+  const char *_seperator = (const char *)memchr(data, ',', end - data);
 
   const char *s = data;
   std::size_t length;
-  if (_seperator != nullptr && _seperator < end) {
+  if (_seperator != nullptr) {
     length = _seperator - data;
     data = _seperator + 1;
   } else {
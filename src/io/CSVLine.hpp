@@ -16,6 +16,13 @@ protected:
 public:
   explicit CSVLine(const char *line) noexcept;
 
+  /**
+   * Construct an instance for the range [_data, _end).  The range
+   * must be part of a null-terminated string.
+   */
+  constexpr CSVLine(const char *_data, const char *_end) noexcept
+    :data(_data), end(_end) {}
+
   std::string_view Rest() const noexcept {
     return {data, std::size_t(end - data)};
   }
@@ -0,0 +1,449 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Async.hpp"
+#include "Assert.hxx"
+#include "Value.hxx"
+#include "Util.hxx"
+#include "Error.hxx"
+#include "Catch.hpp"
+#include "Class.hxx"
+#include "Persistent.hpp"
+#include "Interface.hpp"
+#include "Blackboard/BlackboardListener.hpp"
+#include "ui/event/Timer.hpp"
+#include "ui/event/CoInjectFunction.hpp"
+#include "co/Task.hxx"
+#include "lib/curl/CoRequest.hxx"
+#include "lib/curl/Easy.hxx"
+#include "lib/curl/Global.hxx"
+#include "lib/curl/Setup.hxx"
+#include "net/http/Init.hpp"
+#include "io/async/GlobalAsioThread.hpp"
+#include "io/async/AsioThread.hpp"
+#include "io/FileReader.hxx"
+#include "system/Path.hpp"
+#include "util/ConvertString.hpp"
+#include "time/FloatDuration.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <span>
+#include <string>
+
+/**
+ * Look up the main thread of the given Lua state.  Tasks are resumed
+ * from there, because the thread which started an operation may be
+ * a task itself, and may be gone by the time the operation finishes.
+ */
+static lua_State *
+GetMainThread(lua_State *L) noexcept
+{
+  lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_MAINTHREAD);
+  lua_State *main_L = lua_tothread(L, -1);
+  lua_pop(L, 1);
+  return main_L;
+}
+
+/**
+ * Resume a task coroutine with #nargs values on its stack.  Errors
+ * are passed to the CatchCallback; the values returned or yielded by
+ * the task are discarded.
+ */
+static void
+ResumeTask(lua_State *L, lua_State *thread_L, int nargs) noexcept
+{
+  int nresults;
+  switch (lua_resume(thread_L, L, nargs, &nresults)) {
+  case LUA_OK:
+    /* the task has finished */
+  case LUA_YIELD:
+    /* the task waits for an awaitable, which holds a reference on
+       the thread */
+    lua_pop(thread_L, nresults);
+    break;
+
+  default:
+    Lua::ThrowError(L, Lua::PopError(thread_L));
+  }
+}
+
+/**
+ * The continuation of a task suspended by LuaAwaitable::Await().
+ * The resume arguments start at index #ctx+1 with a boolean: on
+ * success, the remaining values are returned to the task; on
+ * failure, the next value is raised as error.
+ */
+static int
+ContinueAwait(lua_State *L, [[maybe_unused]] int status, lua_KContext ctx)
+{
+  const int base = ctx + 1;
+
+  if (!lua_toboolean(L, base)) {
+    lua_pushvalue(L, base + 1);
+    return lua_error(L);
+  }
+
+  return lua_gettop(L) - base;
+}
+
+static void
+CheckAsync(lua_State *L)
+{
+  if (!lua_isyieldable(L))
+    luaL_error(L, "Must be called from a task started by xcsoar.async.run()");
+}
+
+/**
+ * Base class for an operation a task can wait for.  Instances are Lua
+ * userdata objects; while pending, they refer to themselves and to
+ * the waiting thread, which keeps both alive and makes the script
+ * persistent.  When the Lua state is closed, the garbage collector
+ * destroys the object, which cancels the operation.
+ */
+class LuaAwaitable {
+  lua_State *const main_L;
+
+  /**
+   * This object, only set while pending.
+   */
+  Lua::Value self;
+
+  /**
+   * The waiting task thread, only set while pending.
+   */
+  Lua::Value thread;
+
+protected:
+  explicit LuaAwaitable(lua_State *L) noexcept
+    :main_L(GetMainThread(L)), self(main_L), thread(main_L) {}
+
+  ~LuaAwaitable() noexcept = default;
+
+public:
+  LuaAwaitable(const LuaAwaitable &) = delete;
+  LuaAwaitable &operator=(const LuaAwaitable &) = delete;
+
+  /**
+   * Suspend the calling task until the operation finishes.  This
+   * object must be on the top of the stack, and this method must be
+   * used in the return statement of a lua_CFunction.
+   */
+  int Await(lua_State *L) {
+    self.Set(L, Lua::RelativeStackIndex{-1});
+    thread.Set(L, Lua::CurrentThread{});
+    Lua::AddPersistent(L, this);
+    return lua_yieldk(L, 0, lua_gettop(L), ContinueAwait);
+  }
+
+protected:
+  /**
+   * Resume the waiting task.  This must be called from the main
+   * thread, and only once.  The task may destroy this object, which
+   * therefore must not be used after this method returns.
+   *
+   * @param push a function which pushes the results on the given
+   * stack and returns their number
+   */
+  template<typename F>
+  void Resume(F &&push) noexcept {
+    Complete(true, std::forward<F>(push));
+  }
+
+  /**
+   * Like Resume(), but raise the given error in the task.
+   */
+  void Fail(std::exception_ptr error) noexcept {
+    Complete(false, [&error](lua_State *L){
+      Lua::Push(L, std::move(error));
+      return 1;
+    });
+  }
+
+private:
+  template<typename F>
+  void Complete(bool success, F &&push) noexcept {
+    lua_State *const L = main_L;
+
+    {
+      const Lua::ScopeCheckStack check_stack(L);
+
+      /* keep the thread and this object referenced on the main
+         stack while the task runs */
+      thread.Push();
+      lua_State *const thread_L = lua_tothread(L, -1);
+      self.Push();
+
+      lua_pushboolean(thread_L, success);
+      const int nargs = 1 + push(thread_L);
+
+      thread.Set(nullptr);
+      self.Set(nullptr);
+      Lua::RemovePersistent(L, this);
+
+      ResumeTask(L, thread_L, nargs);
+      lua_pop(L, 2);
+    }
+
+    /* this may close the Lua state */
+    Lua::CheckPersistent(L);
+  }
+};
+
+static constexpr int
+PushNothing(lua_State *) noexcept
+{
+  return 0;
+}
+
+class LuaSleep final : public LuaAwaitable {
+  UI::Timer timer{[this]{ Resume(PushNothing); }};
+
+public:
+  LuaSleep(lua_State *L, std::chrono::steady_clock::duration d) noexcept
+    :LuaAwaitable(L)
+  {
+    timer.Schedule(d);
+  }
+};
+
+static constexpr char lua_sleep_class[] = "xcsoar.async.Sleep";
+using LuaSleepClass = Lua::Class<LuaSleep, lua_sleep_class>;
+
+class LuaBlackboardWait final
+  : public LuaAwaitable, NullBlackboardListener
+{
+  /**
+   * Wait for OnCalculatedUpdate() instead of OnGPSUpdate()?
+   */
+  const bool calculated;
+
+  /**
+   * The #LiveBlackboard does not allow removing listeners while it
+   * calls them, therefore the task is resumed by this timer.
+   */
+  UI::Timer defer_resume{[this]{ OnDeferredResume(); }};
+
+  bool registered = true;
+
+public:
+  LuaBlackboardWait(lua_State *L, bool _calculated) noexcept
+    :LuaAwaitable(L), calculated(_calculated)
+  {
+    CommonInterface::GetLiveBlackboard().AddListener(*this);
+  }
+
+  ~LuaBlackboardWait() noexcept {
+    if (registered)
+      CommonInterface::GetLiveBlackboard().RemoveListener(*this);
+  }
+
+private:
+  void OnDeferredResume() noexcept {
+    CommonInterface::GetLiveBlackboard().RemoveListener(*this);
+    registered = false;
+
+    Resume(PushNothing);
+  }
+
+  /* virtual methods from class BlackboardListener */
+  void OnGPSUpdate(const MoreData &) override {
+    if (!calculated)
+      defer_resume.SchedulePreserve({});
+  }
+
+  void OnCalculatedUpdate(const MoreData &, const DerivedInfo &) override {
+    if (calculated)
+      defer_resume.SchedulePreserve({});
+  }
+};
+
+static constexpr char lua_blackboard_wait_class[] = "xcsoar.async.BlackboardWait";
+using LuaBlackboardWaitClass = Lua::Class<LuaBlackboardWait,
+                                          lua_blackboard_wait_class>;
+
+static Co::Task<Curl::CoResponse>
+HttpGet(std::string url)
+{
+  CurlEasy easy{url.c_str()};
+  Curl::Setup(easy);
+  co_return co_await Curl::CoRequest(*Net::curl, std::move(easy));
+}
+
+/**
+ * Perform a HTTP GET request in the I/O thread.
+ */
+class LuaHttpGet final : public LuaAwaitable {
+  UI::CoInjectFunction<Curl::CoResponse> request{Net::curl->GetEventLoop()};
+
+public:
+  LuaHttpGet(lua_State *L, const char *url) noexcept
+    :LuaAwaitable(L)
+  {
+    request.Start(HttpGet(url),
+                  [this](Curl::CoResponse response){ OnResponse(response); },
+                  [this](std::exception_ptr error){ Fail(std::move(error)); });
+  }
+
+private:
+  void OnResponse(const Curl::CoResponse &response) noexcept {
+    Resume([&response](lua_State *L){
+      using namespace Lua;
+
+      /* same layout as http.Request:perform() */
+      lua_newtable(L);
+      SetTable(L, RelativeStackIndex{-1}, "status",
+               (lua_Integer)response.status);
+
+      lua_pushstring(L, "headers");
+      lua_newtable(L);
+      for (const auto &i : response.headers)
+        SetTable(L, RelativeStackIndex{-1}, i.first, i.second);
+      lua_settable(L, -3);
+
+      SetTable(L, RelativeStackIndex{-1}, "body", response.body);
+      return 1;
+    });
+  }
+};
+
+static constexpr char lua_http_get_class[] = "xcsoar.async.HttpGet";
+using LuaHttpGetClass = Lua::Class<LuaHttpGet, lua_http_get_class>;
+
+static Co::Task<std::string>
+ReadFile(AllocatedPath path)
+{
+  FileReader reader{path};
+
+  std::string contents;
+  contents.resize(reader.GetSize());
+  reader.ReadFull(std::as_writable_bytes(std::span{contents}));
+  co_return contents;
+}
+
+/**
+ * Read a whole file in the I/O thread.
+ */
+class LuaReadFile final : public LuaAwaitable {
+  UI::CoInjectFunction<std::string> job{asio_thread->GetEventLoop()};
+
+public:
+  LuaReadFile(lua_State *L, Path path) noexcept
+    :LuaAwaitable(L)
+  {
+    job.Start(ReadFile(path),
+              [this](std::string contents){ OnContents(contents); },
+              [this](std::exception_ptr error){ Fail(std::move(error)); });
+  }
+
+private:
+  void OnContents(std::string_view contents) noexcept {
+    Resume([contents](lua_State *L){
+      Lua::Push(L, contents);
+      return 1;
+    });
+  }
+};
+
+static constexpr char lua_read_file_class[] = "xcsoar.async.ReadFile";
+using LuaReadFileClass = Lua::Class<LuaReadFile, lua_read_file_class>;
+
+static int
+l_async_run(lua_State *L)
+{
+  luaL_checktype(L, 1, LUA_TFUNCTION);
+
+  /* move the function and its arguments to a new thread */
+  const int nargs = lua_gettop(L) - 1;
+  lua_State *thread_L = lua_newthread(L);
+  lua_insert(L, 1);
+  lua_xmove(L, thread_L, nargs + 1);
+
+  ResumeTask(L, thread_L, nargs);
+  return 0;
+}
+
+static int
+l_async_sleep(lua_State *L)
+{
+  if (lua_gettop(L) != 1)
+    return luaL_error(L, "Invalid parameters");
+
+  const lua_Number seconds = luaL_checknumber(L, 1);
+  CheckAsync(L);
+
+  const auto d = std::chrono::duration_cast<std::chrono::steady_clock::duration>(FloatDuration(seconds));
+  return LuaSleepClass::New(L, L, d)->Await(L);
+}
+
+static int
+l_async_wait_gps(lua_State *L)
+{
+  CheckAsync(L);
+  return LuaBlackboardWaitClass::New(L, L, false)->Await(L);
+}
+
+static int
+l_async_wait_calculated(lua_State *L)
+{
+  CheckAsync(L);
+  return LuaBlackboardWaitClass::New(L, L, true)->Await(L);
+}
+
+static int
+l_async_http_get(lua_State *L)
+{
+  if (lua_gettop(L) != 1)
+    return luaL_error(L, "Invalid parameters");
+
+  const char *url = luaL_checkstring(L, 1);
+  CheckAsync(L);
+
+  return LuaHttpGetClass::New(L, L, url)->Await(L);
+}
+
+static int
+l_async_read_file(lua_State *L)
+{
+  if (lua_gettop(L) != 1)
+    return luaL_error(L, "Invalid parameters");
+
+  const UTF8ToWideConverter filename(luaL_checkstring(L, 1));
+  if (!filename.IsValid())
+    luaL_argerror(L, 1, "Malformed file name");
+
+  CheckAsync(L);
+
+  return LuaReadFileClass::New(L, L, Path(filename))->Await(L);
+}
+
+static constexpr struct luaL_Reg async_funcs[] = {
+  {"run", l_async_run},
+  {"sleep", l_async_sleep},
+  {"wait_gps", l_async_wait_gps},
+  {"wait_calculated", l_async_wait_calculated},
+  {"http_get", l_async_http_get},
+  {"read_file", l_async_read_file},
+  {nullptr, nullptr}
+};
+
+void
+Lua::InitAsync(lua_State *L)
+{
+  const Lua::ScopeCheckStack check_stack(L);
+
+  lua_getglobal(L, "xcsoar");
+
+  luaL_newlib(L, async_funcs); // create 'async'
+  lua_setfield(L, -2, "async"); // xcsoar.async = async
+  lua_pop(L, 1); // pop global "xcsoar"
+
+  /* register and pop the metatables */
+  LuaSleepClass::Register(L);
+  LuaBlackboardWaitClass::Register(L);
+  LuaHttpGetClass::Register(L);
+  LuaReadFileClass::Register(L);
+  lua_pop(L, 4);
+}
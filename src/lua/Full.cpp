@@ -8,6 +8,7 @@
 #include "Persistent.hpp"
 #include "Http.hpp"
 #include "Timer.hpp"
+#include "Async.hpp"
 #include "Geo.hpp"
 #include "Map.hpp"
 #include "Blackboard.hpp"
@@ -24,6 +25,7 @@
 #include "Logger.hpp"
 #include "Tracking.hpp"
 #include "Replay.hpp"
+#include "Profiler.hpp"
 #include "InputEvent.hpp"
 
 lua_State *
@@ -35,6 +37,7 @@ Lua::NewFullState()
   InitPersistent(L);
   InitHttp(L);
   InitTimer(L);
+  InitAsync(L);
   InitGeo(L);
   InitMap(L);
   InitBlackboard(L);
@@ -47,6 +50,7 @@ Lua::NewFullState()
   InitLogger(L);
   InitTracking(L);
   InitReplay(L);
+  InitProfiler(L);
   InitInputEvent(L);
 
   {
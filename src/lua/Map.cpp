@@ -3,9 +3,8 @@
 
 #include "Map.hpp"
 #include "Geo.hpp"
-#include "MetaTable.hxx"
+#include "Property.hpp"
 #include "Util.hxx"
-#include "util/StringAPI.hxx"
 #include "UIGlobals.hpp"
 #include "PageActions.hpp"
 #include "MapWindow/GlueMapWindow.hpp"
@@ -24,26 +23,34 @@ extern "C" {
 #include <algorithm> // for std::clamp()
 
 static int
-l_map_index(lua_State *L)
+l_map_location(lua_State *L)
 {
-  const char *name = lua_tostring(L, 2);
-  if (name == nullptr)
-    return 0;
-
   auto *map = UIGlobals::GetMap();
   if (map == nullptr)
     return 0;
 
-  if (StringIsEqual(name, "location"))
-    Lua::Push(L, map->GetLocation());
-  else if (StringIsEqual(name, "is_panning"))
-    Lua::Push(L, IsPanning());
-  else
+  Lua::Push(L, map->GetLocation());
+  return 1;
+}
+
+static int
+l_map_is_panning(lua_State *L)
+{
+  if (UIGlobals::GetMap() == nullptr)
     return 0;
 
+  Lua::Push(L, IsPanning());
   return 1;
 }
 
+/**
+ * All fields of "xcsoar.map"; see Lua::MakePropertyTable().
+ */
+static constexpr Lua::Property map_properties[] = {
+  {"location", l_map_location},
+  {"is_panning", l_map_is_panning},
+};
+
 static int
 l_map_show(lua_State *L)
 {
@@ -228,7 +235,7 @@ Lua::InitMap(lua_State *L)
 
   lua_newtable(L);
 
-  MakeIndexMetaTableFor(L, RelativeStackIndex{-1}, l_map_index);
+  MakePropertyTable(L, map_properties);
 
   luaL_setfuncs(L, map_funcs, 0);
 
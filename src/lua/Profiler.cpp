@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Profiler.hpp"
+#include "Property.hpp"
+#include "Chrono.hpp"
+#include "Util.hxx"
+#include "Error.hxx"
+#include "Profiler/Profiler.hpp"
+#include "Profiler/Glue.hpp"
+#include "Interface.hpp"
+#include "system/Path.hpp"
+#include "util/ConvertString.hpp"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+static int
+l_profiler_enabled(lua_State *L)
+{
+  Lua::Push(L, Profiler::IsEnabled());
+  return 1;
+}
+
+/**
+ * All fields of "xcsoar.profiler"; see Lua::MakePropertyTable().
+ */
+static constexpr Lua::Property profiler_properties[] = {
+  {"enabled", l_profiler_enabled},
+};
+
+static int
+l_profiler_enable([[maybe_unused]] lua_State *L)
+{
+  Profiler::SetEnabled(true);
+  return 0;
+}
+
+static int
+l_profiler_disable([[maybe_unused]] lua_State *L)
+{
+  Profiler::SetEnabled(false);
+  return 0;
+}
+
+static int
+l_profiler_clear([[maybe_unused]] lua_State *L)
+{
+  Profiler::Clear();
+  return 0;
+}
+
+static int
+l_profiler_statistics(lua_State *L)
+{
+  const auto statistics = Profiler::GetStatistics();
+
+  lua_createtable(L, (int)statistics.size(), 0);
+
+  int i = 1;
+  for (const auto &zone : statistics) {
+    lua_createtable(L, 0, 5);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "name", zone.name);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "count", (lua_Integer)zone.count);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "p50", (lua_Integer)zone.p50);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "p95", (lua_Integer)zone.p95);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "max", (lua_Integer)zone.max);
+    lua_rawseti(L, -2, i++);
+  }
+
+  return 1;
+}
+
+static int
+l_profiler_stages(lua_State *L)
+{
+  const StageTimingInfo &timing = CommonInterface::Calculated().stage_timing;
+  const StageBudgetSettings &budget =
+    CommonInterface::GetComputerSettings().stage_budget;
+
+  lua_createtable(L, NUM_COMPUTER_STAGES, 0);
+
+  for (std::size_t i = 0; i < NUM_COMPUTER_STAGES; ++i) {
+    const ComputerStage stage = ComputerStage(i);
+    const StageTiming &t = timing[stage];
+
+    lua_createtable(L, 0, 8);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "name", GetComputerStageName(stage));
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "count", (lua_Integer)t.count);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "last", (lua_Integer)t.last);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "mean", (lua_Integer)t.mean);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "max", (lua_Integer)t.max);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "budget", (lua_Integer)budget.Get(stage));
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "over_budget", (lua_Integer)t.over_budget);
+    Lua::SetField(L, Lua::RelativeStackIndex{-1}, "deferred", (lua_Integer)t.deferred);
+    lua_rawseti(L, -2, int(i + 1));
+  }
+
+  return 1;
+}
+
+static int
+l_profiler_fix_latency(lua_State *L)
+{
+  const StageTiming &t = CommonInterface::Calculated().stage_timing.fix_latency;
+
+  lua_createtable(L, 0, 4);
+  Lua::SetField(L, Lua::RelativeStackIndex{-1}, "count", (lua_Integer)t.count);
+  Lua::SetField(L, Lua::RelativeStackIndex{-1}, "last", (lua_Integer)t.last);
+  Lua::SetField(L, Lua::RelativeStackIndex{-1}, "mean", (lua_Integer)t.mean);
+  Lua::SetField(L, Lua::RelativeStackIndex{-1}, "max", (lua_Integer)t.max);
+  return 1;
+}
+
+/**
+ * Returns a monotonic time stamp in seconds, for measuring durations
+ * in scripts.
+ */
+static int
+l_profiler_now(lua_State *L)
+{
+  Lua::Push(L, std::chrono::steady_clock::now().time_since_epoch());
+  return 1;
+}
+
+static int
+l_profiler_dump(lua_State *L)
+try {
+  const auto path = Profiler::Dump();
+  Lua::Push(L, WideToUTF8Converter(path.c_str()));
+  return 1;
+} catch (...) {
+  Lua::RaiseCurrent(L);
+}
+
+static constexpr struct luaL_Reg profiler_funcs[] = {
+  {"enable", l_profiler_enable},
+  {"disable", l_profiler_disable},
+  {"clear", l_profiler_clear},
+  {"statistics", l_profiler_statistics},
+  {"stages", l_profiler_stages},
+  {"fix_latency", l_profiler_fix_latency},
+  {"now", l_profiler_now},
+  {"dump", l_profiler_dump},
+  {nullptr, nullptr}
+};
+
+void
+Lua::InitProfiler(lua_State *L)
+{
+  lua_getglobal(L, "xcsoar");
+
+  lua_newtable(L);
+
+  MakePropertyTable(L, profiler_properties);
+
+  luaL_setfuncs(L, profiler_funcs, 0);
+
+  lua_setfield(L, -2, "profiler");
+
+  lua_pop(L, 1);
+}
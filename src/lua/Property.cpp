@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Property.hpp"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+/**
+ * Pop the #Property pointer (a light userdata) from the top of the
+ * stack and call its getter.
+ *
+ * @return the number of values pushed by the getter
+ */
+static int
+CallGetter(lua_State *L)
+{
+  const auto &property = *(const Lua::Property *)lua_touserdata(L, -1);
+  lua_pop(L, 1);
+  return property.get(L);
+}
+
+/**
+ * The "__index" meta method; upvalue 1 is the dispatch table.
+ */
+static int
+l_property_index(lua_State *L)
+{
+  lua_pushvalue(L, 2);
+  if (lua_rawget(L, lua_upvalueindex(1)) != LUA_TLIGHTUSERDATA)
+    return 0;
+
+  return CallGetter(L);
+}
+
+/**
+ * The "snapshot" function; upvalue 1 is the dispatch table.
+ */
+static int
+l_property_snapshot(lua_State *L)
+{
+  const bool have_names = lua_istable(L, 1);
+
+  lua_newtable(L);
+  const int result = lua_gettop(L);
+
+  if (have_names) {
+    const lua_Integer n = luaL_len(L, 1);
+    for (lua_Integer i = 1; i <= n; ++i) {
+      lua_geti(L, 1, i);
+      lua_pushvalue(L, -1);
+
+      if (lua_rawget(L, lua_upvalueindex(1)) == LUA_TLIGHTUSERDATA &&
+          CallGetter(L) > 0)
+        lua_rawset(L, result);
+      else
+        lua_settop(L, result);
+    }
+  } else {
+    lua_pushnil(L);
+    while (lua_next(L, lua_upvalueindex(1))) {
+      /* duplicate the key below the property pointer; one copy is
+         consumed by lua_rawset(), the other by lua_next() */
+      lua_pushvalue(L, -2);
+      lua_insert(L, -2);
+
+      if (CallGetter(L) > 0)
+        lua_rawset(L, result);
+      else
+        lua_settop(L, result + 1);
+    }
+  }
+
+  return 1;
+}
+
+void
+Lua::MakePropertyTable(lua_State *L,
+                       std::span<const Property> properties) noexcept
+{
+  /* the dispatch table: name -> Property pointer */
+  lua_createtable(L, 0, properties.size());
+  for (const auto &i : properties) {
+    lua_pushlightuserdata(L, const_cast<Property *>(&i));
+    lua_setfield(L, -2, i.name);
+  }
+
+  /* the meta table */
+  lua_newtable(L);
+  lua_pushvalue(L, -2);
+  lua_pushcclosure(L, l_property_index, 1);
+  lua_setfield(L, -2, "__index");
+  lua_setmetatable(L, -3);
+
+  lua_pushcclosure(L, l_property_snapshot, 1);
+  lua_setfield(L, -2, "snapshot");
+}
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+extern "C" {
+#include <lua.h>
+}
+
+#include <span>
+
+namespace Lua {
+
+/**
+ * A read-only property of a Lua table which is backed by a C++
+ * value.
+ */
+struct Property {
+  const char *name;
+
+  /**
+   * Push the value of the property, and return the number of values
+   * pushed (0 if the value is not available, 1 otherwise).  It must
+   * not use any of the values on the stack.
+   */
+  lua_CFunction get;
+};
+
+/**
+ * Make the given properties available in the table at the top of
+ * the stack.
+ *
+ * The property names are stored in a dispatch table which is
+ * passed as an upvalue to the "__index" meta method.  Lua strings are
+ * interned, therefore looking up a name is one hash lookup on the
+ * string pointer instead of a chain of string comparisons.
+ *
+ * This also adds a function "snapshot([names])" to the table which
+ * returns a new table with the values of all properties (or only of
+ * those listed in the given array) at once.
+ *
+ * @param properties an array with static storage duration
+ */
+void
+MakePropertyTable(lua_State *L, std::span<const Property> properties) noexcept;
+
+} // namespace Lua
@@ -2,9 +2,8 @@
 // Copyright The XCSoar Project
 
 #include "Settings.hpp"
-#include "MetaTable.hxx"
+#include "Property.hpp"
 #include "Util.hxx"
-#include "util/StringAPI.hxx"
 #include "Interface.hpp"
 #include "ActionInterface.hpp"
 
@@ -13,96 +12,167 @@ extern "C" {
 }
 
 static int
-l_settings_index(lua_State *L)
-{
-  const char *name = lua_tostring(L, 2);
-  if (name == nullptr)
-    return 0;
-  else if (StringIsEqual(name, "mc")) {
-    const ComputerSettings &settings_computer =
-      CommonInterface::GetComputerSettings();
-    
-    Lua::Push(L, settings_computer.polar.glide_polar_task.GetMC());
-  } else if (StringIsEqual(name, "bugs")) {
-      /* How clean the glider is. */
-      const ComputerSettings &settings_computer = 
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.polar.bugs);
-  } else if (StringIsEqual(name, "wingload")) {
-      /* Current used wingload */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.polar.glide_polar_task.GetWingLoading());
-  } else if (StringIsEqual(name, "ballast")) {
-      /* Ballast of the glider */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.polar.glide_polar_task.GetBallast());
-  } else if (StringIsEqual(name, "qnh")) {
-      /* Area pressure for barometric altimeter calibration */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.pressure.GetPascal());
-  } else if (StringIsEqual(name, "max_temp")) {
-      /* The forecast ground temperature.  Used by 
-         convection estimator. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.forecast_temperature.ToKelvin());
-  } else if (StringIsEqual(name, "safetymc")) {
-      /* The MacCready setting used, when safety MC is enabled 
-         for reach calculations, in task abort mode and for 
-         determining arrival altitude at airfields. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-      const TaskBehaviour &task_behaviour = settings_computer.task;
-    
-      Lua::Push(L, task_behaviour.safety_mc);
-  } else if (StringIsEqual(name, "riskfactor")) {
-      /* The STF risk factor reduces the MacCready setting used to 
-         calculate speed to fly as the glider gets low, in order to 
-         compensate for risk. Set to 0.0 for no compensation, 
-         1.0 scales MC linearly with current height (with reference 
-         to height of the maximum climb). If considered, 0.3 is recommended. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-      const TaskBehaviour &task_behaviour = settings_computer.task;
-    
-      Lua::Push(L, task_behaviour.risk_gamma);
-  } else if (StringIsEqual(name, "polardegradation")) {
-      /* A permanent polar degradation, 0% means no degradation, 
-         50% indicates the glider's sink rate is doubled. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-    
-      Lua::Push(L, settings_computer.polar.degradation_factor);
-  } else if (StringIsEqual(name, "arrivalheight")) {
-      /* The height above terrain that the glider should arrive 
-         at for a safe landing. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-      const TaskBehaviour &task_behaviour = settings_computer.task;
-    
-      Lua::Push(L, task_behaviour.safety_height_arrival);
-  } else if (StringIsEqual(name, "terrainheight")) {
-      /* The height above terrain that the glider must clear during 
-         final glide. */
-      const ComputerSettings &settings_computer =
-        CommonInterface::GetComputerSettings();
-      const TaskBehaviour &task_behaviour = settings_computer.task;
-    
-      Lua::Push(L, task_behaviour.route_planner.safety_height_terrain);
-  } else
-    return 0;
+l_settings_mc(lua_State *L)
+{
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.polar.glide_polar_task.GetMC());
+
+  return 1;
+}
+
+static int
+l_settings_bugs(lua_State *L)
+{
+  /* How clean the glider is. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.polar.bugs);
+
+  return 1;
+}
+
+static int
+l_settings_wingload(lua_State *L)
+{
+  /* Current used wingload */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.polar.glide_polar_task.GetWingLoading());
+
+  return 1;
+}
+
+static int
+l_settings_ballast(lua_State *L)
+{
+  /* Ballast of the glider */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.polar.glide_polar_task.GetBallast());
+
+  return 1;
+}
+
+static int
+l_settings_qnh(lua_State *L)
+{
+  /* Area pressure for barometric altimeter calibration */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.pressure.GetPascal());
+
+  return 1;
+}
+
+static int
+l_settings_max_temp(lua_State *L)
+{
+  /* The forecast ground temperature.  Used by
+     convection estimator. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.forecast_temperature.ToKelvin());
 
   return 1;
 }
 
+static int
+l_settings_safetymc(lua_State *L)
+{
+  /* The MacCready setting used, when safety MC is enabled
+     for reach calculations, in task abort mode and for
+     determining arrival altitude at airfields. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+  const TaskBehaviour &task_behaviour = settings_computer.task;
+
+  Lua::Push(L, task_behaviour.safety_mc);
+
+  return 1;
+}
+
+static int
+l_settings_riskfactor(lua_State *L)
+{
+  /* The STF risk factor reduces the MacCready setting used to
+     calculate speed to fly as the glider gets low, in order to
+     compensate for risk. Set to 0.0 for no compensation,
+     1.0 scales MC linearly with current height (with reference
+     to height of the maximum climb). If considered, 0.3 is recommended. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+  const TaskBehaviour &task_behaviour = settings_computer.task;
+
+  Lua::Push(L, task_behaviour.risk_gamma);
+
+  return 1;
+}
+
+static int
+l_settings_polardegradation(lua_State *L)
+{
+  /* A permanent polar degradation, 0% means no degradation,
+     50% indicates the glider's sink rate is doubled. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+
+  Lua::Push(L, settings_computer.polar.degradation_factor);
+
+  return 1;
+}
+
+static int
+l_settings_arrivalheight(lua_State *L)
+{
+  /* The height above terrain that the glider should arrive
+     at for a safe landing. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+  const TaskBehaviour &task_behaviour = settings_computer.task;
+
+  Lua::Push(L, task_behaviour.safety_height_arrival);
+
+  return 1;
+}
+
+static int
+l_settings_terrainheight(lua_State *L)
+{
+  /* The height above terrain that the glider must clear during
+     final glide. */
+  const ComputerSettings &settings_computer =
+    CommonInterface::GetComputerSettings();
+  const TaskBehaviour &task_behaviour = settings_computer.task;
+
+  Lua::Push(L, task_behaviour.route_planner.safety_height_terrain);
+
+  return 1;
+}
+
+/**
+ * All fields of "xcsoar.settings"; see Lua::MakePropertyTable().
+ */
+static constexpr Lua::Property settings_properties[] = {
+  {"mc", l_settings_mc},
+  {"bugs", l_settings_bugs},
+  {"wingload", l_settings_wingload},
+  {"ballast", l_settings_ballast},
+  {"qnh", l_settings_qnh},
+  {"max_temp", l_settings_max_temp},
+  {"safetymc", l_settings_safetymc},
+  {"riskfactor", l_settings_riskfactor},
+  {"polardegradation", l_settings_polardegradation},
+  {"arrivalheight", l_settings_arrivalheight},
+  {"terrainheight", l_settings_terrainheight},
+};
+
 static int
 l_settings_setmc(lua_State *L)
 {
@@ -174,7 +244,7 @@ Lua::InitSettings(lua_State *L)
 
   lua_newtable(L);
 
-  MakeIndexMetaTableFor(L, RelativeStackIndex{-1}, l_settings_index);
+  MakePropertyTable(L, settings_properties);
 
   luaL_setfuncs(L, settings_funcs, 0);
 
@@ -3,10 +3,9 @@
 
 #include "Wind.hpp"
 #include "Geo.hpp"
-#include "MetaTable.hxx"
+#include "Property.hpp"
 #include "Math/Angle.hpp"
 #include "Util.hxx"
-#include "util/StringAPI.hxx"
 #include "Interface.hpp"
 
 extern "C" {
@@ -14,56 +13,99 @@ extern "C" {
 }
 
 static int
-l_wind_index(lua_State *L)
+l_wind_wind_mode(lua_State *L)
 {
-  const char *name = lua_tostring(L, 2);
-  if (name == nullptr)
-    return 0;
-  else if (StringIsEqual(name, "wind_mode")) {
-    /* Wind mode
-       0: Manual, When the algorithm is switched off, the pilot is 
-          responsible for setting the wind estimate.
-       1: Circling, Requires only a GPS source.
-       2: ZigZag, Requires GPS and an intelligent vario with airspeed output.
-       3: Both, Uses ZigZag and circling. */
-    const WindSettings &settings = CommonInterface::GetComputerSettings().wind;
-    Lua::Push(L, (lua_Integer)settings.GetLegacyAutoWindMode());
-  } else if (StringIsEqual(name, "manual_wind_bearing")) {
-      SpeedVector manual_wind = CommonInterface::Calculated().GetWindOrZero();
-      Lua::Push(L, manual_wind.bearing);
-  } else if (StringIsEqual(name, "manual_wind_speed")) {
-      SpeedVector manual_wind = CommonInterface::Calculated().GetWindOrZero();
-      Lua::Push(L, manual_wind.norm);
-  } else if (StringIsEqual(name, "tail_drift")) {
-      /* Determines whether the snail trail is drifted with the wind 
-         when displayed in circling mode. Switched Off, "
-         the snail trail stays uncompensated for wind drift. */
-      MapSettings &map_settings = CommonInterface::SetMapSettings();
-      if (map_settings.trail.wind_drift_enabled) Lua::Push(L, (lua_Integer)1);
-      else Lua::Push(L, lua_Integer{0});
-  } else if (StringIsEqual(name, "wind_source")) {
-      /* The Source of the current wind
-         0: None
-         1: Manual
-         2: Circling
-         3: ZigZag
-         4: External */
-      const DerivedInfo &calculated = CommonInterface::Calculated();
-      Lua::Push(L, (lua_Integer)calculated.wind_source);
-  } else if (StringIsEqual(name, "wind_speed")) {
-      // The current wind speed [m/s] 
-      const DerivedInfo &info = CommonInterface::Calculated();
-      Lua::Push(L, info.wind.norm);
-  } else if (StringIsEqual(name, "wind_bearing")) {
-      // The current wind bearing [degrees]
-      const DerivedInfo &info = CommonInterface::Calculated();
-      Lua::Push(L, info.wind.bearing);
-  } else
-    return 0;
+  /* Wind mode
+     0: Manual, When the algorithm is switched off, the pilot is
+        responsible for setting the wind estimate.
+     1: Circling, Requires only a GPS source.
+     2: ZigZag, Requires GPS and an intelligent vario with airspeed output.
+     3: Both, Uses ZigZag and circling. */
+  const WindSettings &settings = CommonInterface::GetComputerSettings().wind;
+  Lua::Push(L, (lua_Integer)settings.GetLegacyAutoWindMode());
 
   return 1;
 }
 
+static int
+l_wind_manual_wind_bearing(lua_State *L)
+{
+  SpeedVector manual_wind = CommonInterface::Calculated().GetWindOrZero();
+  Lua::Push(L, manual_wind.bearing);
+
+  return 1;
+}
+
+static int
+l_wind_manual_wind_speed(lua_State *L)
+{
+  SpeedVector manual_wind = CommonInterface::Calculated().GetWindOrZero();
+  Lua::Push(L, manual_wind.norm);
+
+  return 1;
+}
+
+static int
+l_wind_tail_drift(lua_State *L)
+{
+  /* Determines whether the snail trail is drifted with the wind
+     when displayed in circling mode. Switched Off, "
+     the snail trail stays uncompensated for wind drift. */
+  MapSettings &map_settings = CommonInterface::SetMapSettings();
+  if (map_settings.trail.wind_drift_enabled) Lua::Push(L, (lua_Integer)1);
+  else Lua::Push(L, lua_Integer{0});
+
+  return 1;
+}
+
+static int
+l_wind_wind_source(lua_State *L)
+{
+  /* The Source of the current wind
+     0: None
+     1: Manual
+     2: Circling
+     3: ZigZag
+     4: External */
+  const DerivedInfo &calculated = CommonInterface::Calculated();
+  Lua::Push(L, (lua_Integer)calculated.wind_source);
+
+  return 1;
+}
+
+static int
+l_wind_wind_speed(lua_State *L)
+{
+  // The current wind speed [m/s]
+  const DerivedInfo &info = CommonInterface::Calculated();
+  Lua::Push(L, info.wind.norm);
+
+  return 1;
+}
+
+static int
+l_wind_wind_bearing(lua_State *L)
+{
+  // The current wind bearing [degrees]
+  const DerivedInfo &info = CommonInterface::Calculated();
+  Lua::Push(L, info.wind.bearing);
+
+  return 1;
+}
+
+/**
+ * All fields of "xcsoar.wind"; see Lua::MakePropertyTable().
+ */
+static constexpr Lua::Property wind_properties[] = {
+  {"wind_mode", l_wind_wind_mode},
+  {"manual_wind_bearing", l_wind_manual_wind_bearing},
+  {"manual_wind_speed", l_wind_manual_wind_speed},
+  {"tail_drift", l_wind_tail_drift},
+  {"wind_source", l_wind_wind_source},
+  {"wind_speed", l_wind_wind_speed},
+  {"wind_bearing", l_wind_wind_bearing},
+};
+
 static int
 l_wind_setwindmode(lua_State *L)
 {
@@ -163,7 +205,7 @@ Lua::InitWind(lua_State *L)
 
   lua_newtable(L);
 
-  MakeIndexMetaTableFor(L, RelativeStackIndex{-1}, l_wind_index);
+  MakePropertyTable(L, wind_properties);
 
   luaL_setfuncs(L, settings_funcs, 0);
 
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "WorkStealingPool.hpp"
+
+#include <cassert>
+
+std::optional<std::size_t>
+WorkStealingPool::Share::PopFront() noexcept
+{
+  const std::scoped_lock lock{mutex};
+  if (begin == end)
+    return std::nullopt;
+
+  return begin++;
+}
+
+std::optional<std::size_t>
+WorkStealingPool::Share::PopBack() noexcept
+{
+  const std::scoped_lock lock{mutex};
+  if (begin == end)
+    return std::nullopt;
+
+  return --end;
+}
+
+void
+WorkStealingPool::Worker::Run() noexcept
+{
+  pool.RunThread(index);
+}
+
+WorkStealingPool::WorkStealingPool(unsigned _n_workers)
+  :n_workers(_n_workers > 0 ? _n_workers : 1),
+   shares(new Share[n_workers]),
+   threads(new std::optional<Worker>[n_workers])
+{
+  try {
+    for (unsigned i = 1; i < n_workers; ++i)
+      threads[i].emplace(*this, i).Start();
+  } catch (...) {
+    StopThreads();
+    throw;
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() noexcept
+{
+  StopThreads();
+}
+
+void
+WorkStealingPool::StopThreads() noexcept
+{
+  {
+    const std::scoped_lock lock{mutex};
+    quit = true;
+    cond.notify_all();
+  }
+
+  for (unsigned i = 1; i < n_workers; ++i) {
+    auto &thread = threads[i];
+    if (thread && thread->IsDefined())
+      thread->Join();
+    thread.reset();
+  }
+}
+
+void
+WorkStealingPool::Work(unsigned worker) noexcept
+{
+  assert(job != nullptr);
+
+  while (true) {
+    auto index = shares[worker].PopFront();
+
+    for (unsigned i = 1; !index && i < n_workers; ++i)
+      index = shares[(worker + i) % n_workers].PopBack();
+
+    if (!index)
+      /* all shares are empty */
+      break;
+
+    (*job)(*index, worker);
+  }
+}
+
+void
+WorkStealingPool::RunThread(unsigned worker) noexcept
+{
+  unsigned last_generation = 0;
+
+  std::unique_lock lock{mutex};
+  while (true) {
+    cond.wait(lock, [this, last_generation]{
+      return quit || generation != last_generation;
+    });
+
+    if (quit)
+      break;
+
+    last_generation = generation;
+
+    lock.unlock();
+    Work(worker);
+    lock.lock();
+
+    assert(running > 0);
+    if (--running == 0)
+      done_cond.notify_one();
+  }
+}
+
+void
+WorkStealingPool::Run(std::size_t n, const Job &_job) noexcept
+{
+  if (n == 0)
+    return;
+
+  if (n_workers == 1 || n == 1) {
+    /* not worth waking up the other threads */
+    for (std::size_t i = 0; i < n; ++i)
+      _job(i, 0);
+    return;
+  }
+
+  /* split the indices into one share per worker */
+  for (unsigned i = 0; i < n_workers; ++i) {
+    const std::scoped_lock lock{shares[i].mutex};
+    shares[i].begin = n * i / n_workers;
+    shares[i].end = n * (i + 1) / n_workers;
+  }
+
+  {
+    const std::scoped_lock lock{mutex};
+    assert(running == 0);
+    job = &_job;
+    running = n_workers - 1;
+    ++generation;
+    cond.notify_all();
+  }
+
+  Work(0);
+
+  std::unique_lock lock{mutex};
+  done_cond.wait(lock, [this]{ return running == 0; });
+  job = nullptr;
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "thread/Thread.hpp"
+#include "thread/Mutex.hxx"
+#include "Cond.hxx"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+/**
+ * A pool of threads which executes batches of independent jobs.
+ *
+ * Each call to Run() splits the job indices into one contiguous
+ * share per worker.  A worker which has finished its own share
+ * steals jobs from the end of another worker's share, so unevenly
+ * expensive jobs are balanced automatically.  The calling thread
+ * participates as worker 0.
+ */
+class WorkStealingPool {
+public:
+  /**
+   * A job callback.  It receives the job index and the index of the
+   * worker which executes it; the latter may be used to select
+   * per-thread scratch buffers.
+   */
+  using Job = std::function<void(std::size_t index, unsigned worker)>;
+
+private:
+  class Worker final : public Thread {
+    WorkStealingPool &pool;
+    const unsigned index;
+
+  public:
+    Worker(WorkStealingPool &_pool, unsigned _index) noexcept
+      :Thread("WorkStealing"), pool(_pool), index(_index) {}
+
+  protected:
+    void Run() noexcept override;
+  };
+
+  /**
+   * The range of job indices which has not yet been claimed by a
+   * worker.
+   */
+  struct Share {
+    Mutex mutex;
+    std::size_t begin = 0, end = 0;
+
+    std::optional<std::size_t> PopFront() noexcept;
+    std::optional<std::size_t> PopBack() noexcept;
+  };
+
+  const unsigned n_workers;
+
+  const std::unique_ptr<Share[]> shares;
+
+  /**
+   * The background threads; there are #n_workers minus one, because
+   * the thread which calls Run() is worker 0.
+   */
+  std::unique_ptr<std::optional<Worker>[]> threads;
+
+  /**
+   * Protects #job, #generation, #running and #quit.
+   */
+  Mutex mutex;
+  Cond cond, done_cond;
+
+  const Job *job = nullptr;
+
+  /**
+   * Incremented by Run() to wake up the background threads.
+   */
+  unsigned generation = 0;
+
+  /**
+   * The number of background threads still working on the current
+   * batch.
+   */
+  unsigned running = 0;
+
+  bool quit = false;
+
+public:
+  /**
+   * Throws on error.
+   *
+   * @param _n_workers the total number of workers including the
+   * calling thread; 1 means all jobs are executed synchronously by
+   * Run()
+   */
+  explicit WorkStealingPool(unsigned _n_workers);
+
+  ~WorkStealingPool() noexcept;
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  unsigned GetWorkerCount() const noexcept {
+    return n_workers;
+  }
+
+  /**
+   * Execute the job for all indices in [0, n) and return after all
+   * of them have finished.  Only one thread may call this method at
+   * a time.
+   */
+  void Run(std::size_t n, const Job &_job) noexcept;
+
+private:
+  void StopThreads() noexcept;
+
+  /**
+   * Execute jobs from the own share and then steal from the others
+   * until there are no jobs left.
+   */
+  void Work(unsigned worker) noexcept;
+
+  void RunThread(unsigned worker) noexcept;
+};
@@ -25,6 +25,7 @@ class GLTexture;
 
 #ifdef USE_FREETYPE
 typedef struct FT_FaceRec_ *FT_Face;
+class GlyphCache;
 #endif
 
 class FontDescription;
@@ -37,6 +38,8 @@ class Font {
 protected:
 #ifdef USE_FREETYPE
   FT_Face face = nullptr;
+
+  GlyphCache *glyph_cache = nullptr;
 #elif defined(ANDROID)
   TextUtil *text_util_object = nullptr;
 
@@ -106,6 +109,16 @@ public:
   [[gnu::pure]]
   PixelSize TextSize(tstring_view text) const noexcept;
 
+#ifdef USE_FREETYPE
+  /**
+   * Returns the rendered glyphs of this font, which allows drawing
+   * text without rendering it into a buffer first.
+   */
+  GlyphCache &GetGlyphCache() const noexcept {
+    return *glyph_cache;
+  }
+#endif
+
 #if defined(USE_FREETYPE) || defined(USE_APPKIT) || defined(USE_UIKIT)
   static constexpr std::size_t BufferSize(const PixelSize size) noexcept {
     return std::size_t(size.width) * std::size_t(size.height);
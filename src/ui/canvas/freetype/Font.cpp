@@ -2,6 +2,7 @@
 // Copyright The XCSoar Project
 
 #include "ui/canvas/Font.hpp"
+#include "GlyphCache.hpp"
 #include "Screen/Debug.hpp"
 #include "ui/canvas/custom/Files.hpp"
 #include "Look/FontDescription.hpp"
@@ -14,8 +15,8 @@
 #include "thread/Mutex.hxx"
 #endif
 
-#ifndef _UNICODE
-#include "util/UTF8.hpp"
+#ifdef _UNICODE
+#include "util/ConvertString.hpp"
 #endif
 
 #if defined(__clang__) && defined(__arm__)
@@ -30,7 +31,6 @@
 #include <algorithm>
 
 #include <cassert>
-#include <concepts>
 #include <cstdint>
 
 #ifndef ENABLE_OPENGL
@@ -75,23 +75,6 @@ FT_CEIL(FT_Long x) noexcept
   return FT_FLOOR(x + 63);
 }
 
-[[gnu::pure]]
-static unsigned
-NextChar(tstring_view &s) noexcept
-{
-  assert(!s.empty());
-
-#ifdef _UNICODE
-  const unsigned ch = s.front();
-  s.remove_prefix(1);
-  return ch;
-#else
-  auto n = NextUTF8(s.data());
-  s.remove_prefix(n.second - s.data());
-  return n.first;
-#endif
-}
-
 void
 Font::Initialise()
 {
@@ -163,6 +146,8 @@ Font::LoadFile(const char *file, unsigned ptsize, [[maybe_unused]] bool bold, [[
   // TODO: handle bold/italic
 
   face = new_face;
+  glyph_cache = new GlyphCache(face, ascent_height,
+                               render_mode == FT_RENDER_MODE_MONO);
 }
 
 void
@@ -206,84 +191,28 @@ Font::Destroy() noexcept
 
   assert(IsScreenInitialized());
 
+  delete glyph_cache;
+  glyph_cache = nullptr;
+
   ::FT_Done_Face(face);
   face = nullptr;
 }
 
-static void
-ForEachChar(tstring_view text, std::invocable<unsigned> auto f)
-{
-#ifndef _UNICODE
-  assert(ValidateUTF8(text));
-#endif
-
-  while (!text.empty()) {
-    const unsigned ch = NextChar(text);
-    f(ch);
-  }
-}
-
-template<typename T>
-static void
-ForEachGlyph(const FT_Face face, unsigned ascent_height, T &&text,
-             std::invocable<int, int, FT_GlyphSlot> auto f) noexcept
-{
-  const bool use_kerning = FT_HAS_KERNING(face);
-
-  int x = 0;
-  unsigned prev_index = 0;
-
-#ifndef ENABLE_OPENGL
-  const std::lock_guard lock{freetype_mutex};
-#endif
-
-  ForEachChar(std::forward<T>(text),
-              [face, ascent_height, &f, use_kerning,
-               &x, &prev_index](unsigned ch){
-      const FT_UInt i = FT_Get_Char_Index(face, ch);
-      if (i == 0)
-        return;
-
-      const FT_Error error = FT_Load_Glyph(face, i, load_flags);
-      if (error)
-        return;
-
-      const FT_GlyphSlot glyph = face->glyph;
-      const FT_Glyph_Metrics &metrics = glyph->metrics;
-
-      if (use_kerning) {
-        if (prev_index != 0 && i != 0) {
-          FT_Vector delta;
-          FT_Get_Kerning(face, prev_index, i, ft_kerning_default,
-                         &delta);
-          x += delta.x >> 6;
-        }
-
-        prev_index = i;
-      }
-
-      f(x + FT_FLOOR(metrics.horiBearingX),
-        ascent_height - FT_FLOOR(metrics.horiBearingY),
-        glyph);
-
-      x += FT_CEIL(metrics.horiAdvance);
-    });
-}
-
 PixelSize
 Font::TextSize(tstring_view text) const noexcept
 {
-  int maxx = 0;
+#ifdef _UNICODE
+  const WideToUTF8Converter text2(text);
+#else
+  const std::string_view text2 = text;
+#endif
 
-  ForEachGlyph(face, ascent_height, text,
-               [&maxx](int x, [[maybe_unused]] int y, const FT_GlyphSlot glyph){
-      const FT_Glyph_Metrics &metrics = glyph->metrics;
-      const int glyph_minx = FT_FLOOR(metrics.horiBearingX);
-      const int glyph_maxx = glyph_minx + FT_CEIL(metrics.width);
+  int maxx = 0;
 
-      int z = x + glyph_maxx;
-      if (z > maxx)
-        maxx = z;
+  glyph_cache->ForEachGlyph(text2,
+                            [&maxx](PixelPoint position,
+                                    const GlyphCache::Glyph &glyph){
+      maxx = std::max(maxx, position.x + glyph.width);
     });
 
   return PixelSize{unsigned(maxx), height};
@@ -299,11 +228,10 @@ MixLine(uint8_t *dest, const uint8_t *src, size_t n) noexcept
 
 static void
 RenderGlyph(uint8_t *buffer, unsigned buffer_width, unsigned buffer_height,
-            const FT_Bitmap &bitmap, int x, int y) noexcept
+            const uint8_t *src, unsigned pitch, PixelSize size,
+            int x, int y) noexcept
 {
-  const uint8_t *src = (const uint8_t *)bitmap.buffer;
-  int width = bitmap.width, height = bitmap.rows;
-  int pitch = bitmap.pitch;
+  int width = size.width, height = size.height;
 
   if (x < 0) {
     src -= x;
@@ -318,7 +246,7 @@ RenderGlyph(uint8_t *buffer, unsigned buffer_width, unsigned buffer_height,
     width = buffer_width - x;
 
   if (y < 0) {
-    src -= y * pitch;
+    src -= y * int(pitch);
     height += y;
     y = 0;
   }
@@ -335,60 +263,25 @@ RenderGlyph(uint8_t *buffer, unsigned buffer_width, unsigned buffer_height,
     MixLine(buffer, src, width);
 }
 
-static void
-ConvertMono(unsigned char *dest, const unsigned char *src, unsigned n) noexcept
-{
-  for (; n >= 8; n -= 8, ++src) {
-    for (unsigned i = 0x80; i != 0; i >>= 1)
-      *dest++ = (*src & i) ? 0xff : 0x00;
-  }
-
-  for (unsigned i = 0x80; n > 0; i >>= 1, --n)
-    *dest++ = (*src & i) ? 0xff : 0x00;
-}
-
-static void
-ConvertMono(FT_Bitmap &dest, const FT_Bitmap &src) noexcept
-{
-  dest = src;
-  dest.pitch = dest.width;
-  dest.buffer = new unsigned char[dest.pitch * dest.rows];
-
-  unsigned char *d = dest.buffer, *s = src.buffer;
-  for (unsigned y = 0; y < unsigned(dest.rows);
-       ++y, d += dest.pitch, s += src.pitch)
-    ConvertMono(d, s, dest.width);
-}
-
-static void
-RenderGlyph(uint8_t *buffer, size_t width, size_t height,
-            FT_GlyphSlot glyph, int x, int y) noexcept
-{
-  FT_Error error = FT_Render_Glyph(glyph, render_mode);
-  if (error)
-    return;
-
-  if (IsMono()) {
-    /* with anti-aliasing disabled, FreeType writes each pixel in one
-       bit; hack: convert it to 1 byte per pixel and then render it */
-    FT_Bitmap bitmap;
-    ConvertMono(bitmap, glyph->bitmap);
-    RenderGlyph(buffer, width, height, bitmap, x, y);
-    delete[] bitmap.buffer;
-  } else
-    RenderGlyph(buffer, width, height, glyph->bitmap, x, y);
-}
-
 void
 Font::Render(tstring_view text, const PixelSize size,
              void *_buffer) const noexcept
 {
+#ifdef _UNICODE
+  const WideToUTF8Converter text2(text);
+#else
+  const std::string_view text2 = text;
+#endif
+
   uint8_t *buffer = (uint8_t *)_buffer;
   std::fill_n(buffer, BufferSize(size), 0);
 
-  ForEachGlyph(face, ascent_height, text,
-               [size, buffer](int x, int y, const FT_GlyphSlot glyph){
-      RenderGlyph(buffer, size.width, size.height, glyph,
-                  x, y);
+  const GlyphCache &cache = *glyph_cache;
+  glyph_cache->ForEachGlyph(text2,
+                            [size, buffer, &cache](PixelPoint position,
+                                                   const GlyphCache::Glyph &glyph){
+      RenderGlyph(buffer, size.width, size.height,
+                  cache.GetPixels(glyph), GlyphCache::ATLAS_WIDTH,
+                  glyph.size, position.x, position.y);
     });
 }
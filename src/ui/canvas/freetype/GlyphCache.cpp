@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "GlyphCache.hpp"
+
+#ifdef ENABLE_OPENGL
+#include "ui/canvas/opengl/Texture.hpp"
+#endif
+
+#if defined(__clang__) && defined(__arm__)
+/* work around warning: 'register' storage class specifier is
+   deprecated */
+#define register
+#endif
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+
+#include <string.h>
+
+/**
+ * Leave this many blank pixels between glyphs, so texture filtering
+ * never picks up a neighbour.
+ */
+static constexpr unsigned GLYPH_PADDING = 1;
+
+static constexpr FT_Long
+FT_FLOOR(FT_Long x) noexcept
+{
+  return (x & -64) / 64;
+}
+
+static constexpr FT_Long
+FT_CEIL(FT_Long x) noexcept
+{
+  return FT_FLOOR(x + 63);
+}
+
+GlyphCache::GlyphCache(FT_Face _face, unsigned _ascent_height,
+                       bool _mono) noexcept
+  :face(_face), ascent_height(_ascent_height),
+   load_flags(_mono ? FT_LOAD_DEFAULT|FT_LOAD_TARGET_MONO : FT_LOAD_DEFAULT),
+   mono(_mono),
+   use_kerning(FT_HAS_KERNING(_face))
+{
+}
+
+GlyphCache::~GlyphCache() noexcept = default;
+
+static void
+ConvertMono(uint8_t *dest, const uint8_t *src, unsigned n) noexcept
+{
+  for (; n >= 8; n -= 8, ++src) {
+    for (unsigned i = 0x80; i != 0; i >>= 1)
+      *dest++ = (*src & i) ? 0xff : 0x00;
+  }
+
+  for (unsigned i = 0x80; n > 0; i >>= 1, --n)
+    *dest++ = (*src & i) ? 0xff : 0x00;
+}
+
+/**
+ * Copy a rendered FreeType bitmap into the atlas, converting it to 8
+ * bits per pixel.
+ */
+static void
+CopyBitmap(uint8_t *dest, unsigned dest_pitch,
+           const FT_Bitmap &bitmap) noexcept
+{
+  const uint8_t *src = bitmap.buffer;
+
+  for (unsigned y = 0; y < bitmap.rows;
+       ++y, src += bitmap.pitch, dest += dest_pitch) {
+    if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+      /* with anti-aliasing disabled, FreeType writes each pixel in
+         one bit */
+      ConvertMono(dest, src, bitmap.width);
+    else
+      memcpy(dest, src, bitmap.width);
+  }
+}
+
+const GlyphCache::Glyph &
+GlyphCache::Load(unsigned ch) noexcept
+{
+  if (auto i = glyphs.find(ch); i != glyphs.end())
+    return i->second;
+
+  Glyph glyph{};
+
+  glyph.index = FT_Get_Char_Index(face, ch);
+  if (glyph.index != 0 && FT_Load_Glyph(face, glyph.index, load_flags) != 0)
+    glyph.index = 0;
+
+  if (glyph.index != 0) {
+    const FT_GlyphSlot slot = face->glyph;
+    const FT_Glyph_Metrics &metrics = slot->metrics;
+
+    glyph.offset = {
+      int(FT_FLOOR(metrics.horiBearingX)),
+      ascent_height - int(FT_FLOOR(metrics.horiBearingY)),
+    };
+    glyph.width = FT_FLOOR(metrics.horiBearingX) + FT_CEIL(metrics.width);
+    glyph.advance = FT_CEIL(metrics.horiAdvance);
+
+    if (FT_Render_Glyph(slot, mono
+                        ? FT_RENDER_MODE_MONO
+                        : FT_RENDER_MODE_NORMAL) == 0 &&
+        slot->bitmap.width > 0 && slot->bitmap.rows > 0 &&
+        slot->bitmap.width + GLYPH_PADDING <= ATLAS_WIDTH) {
+      const FT_Bitmap &bitmap = slot->bitmap;
+      glyph.size = {bitmap.width, bitmap.rows};
+      glyph.position = Allocate(glyph.size);
+      CopyBitmap(atlas.data() + glyph.position.y * ATLAS_WIDTH
+                 + glyph.position.x,
+                 ATLAS_WIDTH, bitmap);
+    }
+  }
+
+  const Glyph &result = glyphs.emplace(ch, glyph).first->second;
+  if (ch < latin1.size())
+    latin1[ch] = &result;
+
+  return result;
+}
+
+int
+GlyphCache::GetKerning(unsigned left, unsigned right) noexcept
+{
+  const uint_least64_t key = (uint_least64_t(left) << 32) | right;
+
+  auto [i, inserted] = kerning.try_emplace(key, 0);
+  if (inserted) {
+    FT_Vector delta;
+    if (FT_Get_Kerning(face, left, right, ft_kerning_default, &delta) == 0)
+      i->second = delta.x >> 6;
+  }
+
+  return i->second;
+}
+
+PixelPoint
+GlyphCache::Allocate(PixelSize size) noexcept
+{
+  const unsigned width = size.width + GLYPH_PADDING;
+  const unsigned height = size.height + GLYPH_PADDING;
+
+  if (shelf_x + width > ATLAS_WIDTH) {
+    /* start a new shelf */
+    shelf_y += shelf_height;
+    shelf_x = 0;
+    shelf_height = 0;
+  }
+
+  if (shelf_y + height > atlas_height) {
+    /* double the atlas height; the new rows are blank */
+    atlas_height = std::max({shelf_y + height, 2 * atlas_height, 64U});
+    atlas.resize(std::size_t(atlas_height) * ATLAS_WIDTH);
+  }
+
+  const PixelPoint position(shelf_x, shelf_y);
+  shelf_x += width;
+  shelf_height = std::max(shelf_height, height);
+
+#ifdef ENABLE_OPENGL
+  if (dirty_bottom <= dirty_top) {
+    dirty_top = position.y;
+    dirty_bottom = position.y + size.height;
+  } else {
+    dirty_top = std::min<unsigned>(dirty_top, position.y);
+    dirty_bottom = std::max<unsigned>(dirty_bottom,
+                                      position.y + size.height);
+  }
+#endif
+
+  return position;
+}
+
+void
+GlyphCache::Clear() noexcept
+{
+  glyphs.clear();
+  latin1.fill(nullptr);
+
+  std::fill(atlas.begin(), atlas.end(), 0);
+  shelf_x = shelf_y = shelf_height = 0;
+
+#ifdef ENABLE_OPENGL
+  dirty_top = 0;
+  dirty_bottom = atlas_height;
+#endif
+}
+
+#ifdef ENABLE_OPENGL
+
+GLTexture &
+GlyphCache::GetTexture() noexcept
+{
+  assert(atlas_height > 0);
+
+  const PixelSize size(ATLAS_WIDTH, atlas_height);
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  if (texture == nullptr || texture->GetSize() != size) {
+    texture = std::make_unique<GLTexture>(GL_ALPHA, size,
+                                          GL_ALPHA, GL_UNSIGNED_BYTE,
+                                          atlas.data());
+  } else if (dirty_bottom > dirty_top) {
+    texture->Bind();
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, dirty_top,
+                    ATLAS_WIDTH, dirty_bottom - dirty_top,
+                    GL_ALPHA, GL_UNSIGNED_BYTE,
+                    atlas.data() + std::size_t(dirty_top) * ATLAS_WIDTH);
+  }
+
+  dirty_top = dirty_bottom = 0;
+  return *texture;
+}
+
+#endif
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "ui/dim/Point.hpp"
+#include "ui/dim/Size.hpp"
+#include "util/UTF8.hpp"
+
+#ifdef ENABLE_OPENGL
+#include <memory>
+#else
+#include "thread/Mutex.hxx"
+#endif
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+typedef struct FT_FaceRec_ *FT_Face;
+
+#ifdef ENABLE_OPENGL
+class GLTexture;
+#endif
+
+/**
+ * The rendered glyphs of one FreeType face, packed into a greyscale
+ * atlas.  Each glyph is loaded and rendered by FreeType only once;
+ * after that, laying out a string is a sequence of table lookups,
+ * and drawing it means copying (or, with OpenGL, texturing)
+ * rectangles out of the atlas.
+ *
+ * Without OpenGL, this object is used by the DrawThread and the UI
+ * thread, and ForEachGlyph() locks it.
+ */
+class GlyphCache {
+public:
+  /**
+   * The width of the atlas in pixels.  It grows in height as glyphs
+   * are added.
+   */
+  static constexpr unsigned ATLAS_WIDTH = 1024;
+
+  /**
+   * When the atlas has grown beyond this height, it is flushed
+   * before laying out the next string.  This limits the memory used
+   * by fonts which draw a lot of different characters.
+   */
+  static constexpr unsigned MAX_ATLAS_HEIGHT = 2048;
+
+  struct Glyph {
+    /**
+     * The position of the bitmap in the atlas.
+     */
+    PixelPoint position;
+
+    /**
+     * The size of the bitmap; may be empty for blank glyphs.
+     */
+    PixelSize size;
+
+    /**
+     * The position of the bitmap relative to the pen position; the
+     * y coordinate is relative to the top of the line.
+     */
+    PixelPoint offset;
+
+    /**
+     * The horizontal extent of the glyph according to its metrics;
+     * added to the bitmap position, this is the right edge used to
+     * calculate the text size.
+     */
+    int width;
+
+    /**
+     * The horizontal distance to the next pen position.
+     */
+    int advance;
+
+    /**
+     * The FreeType glyph index; 0 if the face has no glyph for this
+     * character.
+     */
+    unsigned index;
+  };
+
+private:
+  const FT_Face face;
+
+  const int ascent_height;
+
+  const int32_t load_flags;
+
+  const bool mono;
+
+  const bool use_kerning;
+
+#ifndef ENABLE_OPENGL
+  Mutex mutex;
+#endif
+
+  std::unordered_map<unsigned, Glyph> glyphs;
+
+  /**
+   * Pointers into #glyphs for the first 256 code points, which are
+   * used by the vast majority of all strings.
+   */
+  std::array<const Glyph *, 256> latin1{};
+
+  /**
+   * Horizontal kerning adjustments by the pair of glyph indexes.
+   */
+  std::unordered_map<uint_least64_t, int> kerning;
+
+  /**
+   * The atlas with #ATLAS_WIDTH columns and #atlas_height rows.
+   */
+  std::vector<uint8_t> atlas;
+
+  unsigned atlas_height = 0;
+
+  /**
+   * Glyphs are packed into rows ("shelves") from left to right;
+   * these describe the shelf which is currently being filled.
+   */
+  unsigned shelf_x = 0, shelf_y = 0, shelf_height = 0;
+
+#ifdef ENABLE_OPENGL
+  std::unique_ptr<GLTexture> texture;
+
+  /**
+   * The range of atlas rows which have been modified since the last
+   * upload to #texture.
+   */
+  unsigned dirty_top = 0, dirty_bottom = 0;
+#endif
+
+public:
+  GlyphCache(FT_Face _face, unsigned _ascent_height, bool _mono) noexcept;
+  ~GlyphCache() noexcept;
+
+  GlyphCache(const GlyphCache &) = delete;
+  GlyphCache &operator=(const GlyphCache &) = delete;
+
+  /**
+   * Returns a pointer to the bitmap of the given glyph.  Its rows
+   * are #ATLAS_WIDTH bytes apart.
+   */
+  [[gnu::pure]]
+  const uint8_t *GetPixels(const Glyph &glyph) const noexcept {
+    return atlas.data() + std::size_t(glyph.position.y) * ATLAS_WIDTH
+      + glyph.position.x;
+  }
+
+#ifdef ENABLE_OPENGL
+  /**
+   * Returns the atlas texture, after uploading all glyphs which were
+   * added since the last call.
+   */
+  GLTexture &GetTexture() noexcept;
+#endif
+
+  /**
+   * Lay out a UTF-8 string, and invoke the given function for each
+   * glyph with the position of its bitmap relative to the top left
+   * of the text.
+   *
+   * Adding glyphs may reallocate the atlas, therefore the function
+   * must call GetPixels() for each glyph.
+   */
+  template<typename F>
+  void ForEachGlyph(std::string_view text, F &&f) noexcept {
+    assert(ValidateUTF8(text));
+
+#ifndef ENABLE_OPENGL
+    const std::lock_guard lock{mutex};
+#endif
+
+    if (shelf_y + shelf_height > MAX_ATLAS_HEIGHT)
+      Clear();
+
+    int x = 0;
+    unsigned prev_index = 0;
+
+    while (!text.empty()) {
+      const auto n = NextUTF8(text.data());
+      text.remove_prefix(n.second - text.data());
+
+      const Glyph &glyph = Lookup(n.first);
+      if (glyph.index == 0)
+        continue;
+
+      if (use_kerning) {
+        if (prev_index != 0)
+          x += GetKerning(prev_index, glyph.index);
+
+        prev_index = glyph.index;
+      }
+
+      f(PixelPoint{x + glyph.offset.x, glyph.offset.y}, glyph);
+
+      x += glyph.advance;
+    }
+  }
+
+private:
+  const Glyph &Lookup(unsigned ch) noexcept {
+    if (ch < latin1.size() && latin1[ch] != nullptr)
+      return *latin1[ch];
+
+    return Load(ch);
+  }
+
+  /**
+   * Look up a glyph which is not in #latin1, and load and render it
+   * if it is not in #glyphs either.
+   */
+  const Glyph &Load(unsigned ch) noexcept;
+
+  int GetKerning(unsigned left, unsigned right) noexcept;
+
+  /**
+   * Reserve space for a bitmap of the given size in the atlas.
+   */
+  PixelPoint Allocate(PixelSize size) noexcept;
+
+  /**
+   * Discard all glyphs and their bitmaps, but keep the memory.
+   */
+  void Clear() noexcept;
+};
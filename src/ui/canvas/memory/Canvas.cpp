@@ -9,6 +9,11 @@
 #include "ui/canvas/custom/Cache.hpp"
 #include "Math/Angle.hpp"
 
+#ifdef USE_FREETYPE
+#include "ui/canvas/Font.hpp"
+#include "ui/canvas/freetype/GlyphCache.hpp"
+#endif
+
 #ifdef __ARM_NEON__
 #include "NEON.hpp"
 #endif
@@ -222,6 +227,51 @@ Canvas::CalcTextSize(tstring_view text) const noexcept
   return TextCache::GetSize(*font, text2);
 }
 
+#ifdef USE_FREETYPE
+
+/**
+ * Copy the glyphs of the text from the font's #GlyphCache into the
+ * canvas, clipped to the given text box.
+ */
+static void
+DrawGlyphs(SDLRasterCanvas &canvas, const Font &font,
+           PixelPoint p, PixelSize box,
+           tstring_view text, Color text_color) noexcept
+{
+#ifdef UNICODE
+  const WideToUTF8Converter text2(text);
+#else
+  const std::string_view text2 = text;
+#endif
+
+  ColoredAlphaPixelOperations<ActivePixelTraits, GreyscalePixelTraits>
+    transparent(canvas.Import(text_color));
+
+  GlyphCache &cache = font.GetGlyphCache();
+  cache.ForEachGlyph(text2, [&](PixelPoint position,
+                                const GlyphCache::Glyph &glyph){
+      const int left = std::max(position.x, 0);
+      const int top = std::max(position.y, 0);
+      const int right = std::min(position.x + int(glyph.size.width),
+                                 int(box.width));
+      const int bottom = std::min(position.y + int(glyph.size.height),
+                                  int(box.height));
+      if (left >= right || top >= bottom)
+        return;
+
+      const uint8_t *src = cache.GetPixels(glyph)
+        + (top - position.y) * GlyphCache::ATLAS_WIDTH
+        + (left - position.x);
+
+      canvas.CopyRectangle<decltype(transparent), GreyscalePixelTraits>
+        (p.x + left, p.y + top, right - left, bottom - top,
+         GreyscalePixelTraits::const_pointer(src),
+         GlyphCache::ATLAS_WIDTH, transparent);
+    });
+}
+
+#else
+
 static TextCache::Result
 RenderText(const Font *font, tstring_view text) noexcept
 {
@@ -267,6 +317,8 @@ CopyTextRectangle(SDLRasterCanvas &canvas, int x, int y,
   }
 }
 
+#endif
+
 void
 Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
 {
@@ -274,6 +326,17 @@ Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
   assert(ValidateUTF8(text));
 #endif
 
+#ifdef USE_FREETYPE
+  if (font == nullptr)
+    return;
+
+  const PixelSize size = font->TextSize(text);
+  if (background_mode == OPAQUE)
+    DrawFilledRectangle({p, size}, background_color);
+
+  SDLRasterCanvas canvas(buffer);
+  DrawGlyphs(canvas, *font, p, size, text, text_color);
+#else
   auto s = RenderText(font, text);
   if (!s)
     return;
@@ -282,6 +345,7 @@ Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
   CopyTextRectangle(canvas, p.x, p.y, s.size.width, s.size.height, s,
                     text_color, background_color,
                     background_mode == OPAQUE);
+#endif
 }
 
 void
@@ -291,6 +355,13 @@ Canvas::DrawTransparentText(PixelPoint p, tstring_view text) noexcept
   assert(ValidateUTF8(text));
 #endif
 
+#ifdef USE_FREETYPE
+  if (font == nullptr)
+    return;
+
+  SDLRasterCanvas canvas(buffer);
+  DrawGlyphs(canvas, *font, p, font->TextSize(text), text, text_color);
+#else
   auto s = RenderText(font, text);
   if (s.data == nullptr)
     return;
@@ -299,6 +370,7 @@ Canvas::DrawTransparentText(PixelPoint p, tstring_view text) noexcept
   ColoredAlphaPixelOperations<ActivePixelTraits, GreyscalePixelTraits>
     transparent(canvas.Import(text_color));
   CopyTextRectangle(canvas, p.x, p.y, s.size.width, s.size.height, transparent, s);
+#endif
 }
 
 void
@@ -318,6 +390,20 @@ Canvas::DrawClippedText(PixelPoint p, unsigned width,
   assert(ValidateUTF8(text));
 #endif
 
+#ifdef USE_FREETYPE
+  if (font == nullptr)
+    return;
+
+  PixelSize size = font->TextSize(text);
+  if (width < size.width)
+    size.width = width;
+
+  if (background_mode == OPAQUE)
+    DrawFilledRectangle({p, size}, background_color);
+
+  SDLRasterCanvas canvas(buffer);
+  DrawGlyphs(canvas, *font, p, size, text, text_color);
+#else
   auto s = RenderText(font, text);
   if (s.data == nullptr)
     return;
@@ -329,7 +415,7 @@ Canvas::DrawClippedText(PixelPoint p, unsigned width,
   CopyTextRectangle(canvas, p.x, p.y, width, s.size.height, s,
                     text_color, background_color,
                     background_mode == OPAQUE);
-
+#endif
 }
 
 static bool
@@ -68,6 +68,15 @@ public:
     Unbind();
   }
 
+  /**
+   * Overwrites a portion of the (bound) buffer which was allocated
+   * previously with Data().
+   */
+  static void SubData(GLintptr offset, GLsizeiptr size,
+                      const GLvoid *data) noexcept {
+    glBufferSubData(target, offset, size, data);
+  }
+
   static void *MapWrite() noexcept {
 #ifdef HAVE_DYNAMIC_MAPBUFFER
     return GLExt::map_buffer(target, GL_WRITE_ONLY_OES);
@@ -125,3 +134,11 @@ public:
 
 class GLArrayBuffer : public GLBuffer<GL_ARRAY_BUFFER, GL_STATIC_DRAW> {
 };
+
+/**
+ * An array buffer which is modified frequently, e.g. appended to
+ * with SubData().
+ */
+class GLDynamicArrayBuffer
+  : public GLBuffer<GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW> {
+};
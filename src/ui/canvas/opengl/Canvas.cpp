@@ -11,6 +11,9 @@
 #include "VertexPointer.hpp"
 #include "ExactPixelPoint.hpp"
 #include "ui/canvas/custom/Cache.hpp"
+#ifdef USE_FREETYPE
+#include "ui/canvas/freetype/GlyphCache.hpp"
+#endif
 #include "ui/canvas/Bitmap.hpp"
 #include "ui/canvas/Util.hpp"
 #include "Screen/Layout.hpp"
@@ -37,6 +40,10 @@
 
 AllocatedArray<BulkPixelPoint> Canvas::vertex_buffer;
 
+#ifdef USE_FREETYPE
+AllocatedArray<GLfloat> Canvas::texcoord_buffer;
+#endif
+
 static void
 GLDrawRectangle(const PixelRect r) noexcept
 {
@@ -571,6 +578,94 @@ PrepareColoredAlphaTexture(Color color) noexcept
   color.Bind();
 }
 
+#ifdef USE_FREETYPE
+
+void
+Canvas::DrawGlyphs(PixelPoint p, PixelSize clip,
+                   std::string_view text) noexcept
+{
+  GlyphCache &cache = font->GetGlyphCache();
+
+  /* each glyph is a pair of triangles; a string never has more
+     glyphs than bytes */
+  const std::size_t max_vertices = 6 * text.size();
+  vertex_buffer.GrowDiscard(max_vertices);
+  texcoord_buffer.GrowDiscard(2 * max_vertices);
+
+  BulkPixelPoint *v = vertex_buffer.data();
+  GLfloat *t = texcoord_buffer.data();
+
+  /* the texture coordinates are collected in atlas pixels, because
+     the atlas may grow while the glyphs are being looked up */
+  cache.ForEachGlyph(text, [&](PixelPoint position,
+                               const GlyphCache::Glyph &glyph){
+      const int left = std::max(position.x, 0);
+      const int top = std::max(position.y, 0);
+      const int right = std::min(position.x + int(glyph.size.width),
+                                 int(clip.width));
+      const int bottom = std::min(position.y + int(glyph.size.height),
+                                  int(clip.height));
+      if (left >= right || top >= bottom)
+        return;
+
+      const PixelRect dest{p.x + left, p.y + top, p.x + right, p.y + bottom};
+      const GLfloat src_left = glyph.position.x + (left - position.x);
+      const GLfloat src_top = glyph.position.y + (top - position.y);
+      const GLfloat src_right = src_left + (right - left);
+      const GLfloat src_bottom = src_top + (bottom - top);
+
+      *v++ = dest.GetTopLeft();
+      *v++ = dest.GetTopRight();
+      *v++ = dest.GetBottomLeft();
+      *v++ = dest.GetTopRight();
+      *v++ = dest.GetBottomLeft();
+      *v++ = dest.GetBottomRight();
+
+      const GLfloat coords[] = {
+        src_left, src_top,
+        src_right, src_top,
+        src_left, src_bottom,
+        src_right, src_top,
+        src_left, src_bottom,
+        src_right, src_bottom,
+      };
+
+      t = std::copy(std::begin(coords), std::end(coords), t);
+    });
+
+  const GLsizei n = v - vertex_buffer.data();
+  if (n == 0)
+    return;
+
+  GLTexture &texture = cache.GetTexture();
+
+  const PixelSize allocated = texture.GetAllocatedSize();
+  const GLfloat scale_x = 1.f / allocated.width;
+  const GLfloat scale_y = 1.f / allocated.height;
+  for (GLfloat *i = texcoord_buffer.data(); i != t; i += 2) {
+    i[0] *= scale_x;
+    i[1] *= scale_y;
+  }
+
+  PrepareColoredAlphaTexture(text_color);
+
+  const ScopeAlphaBlend alpha_blend;
+
+  texture.Bind();
+
+  const ScopeVertexPointer vp(vertex_buffer.data());
+
+  glEnableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+  glVertexAttribPointer(OpenGL::Attribute::TEXCOORD, 2, GL_FLOAT, GL_FALSE,
+                        0, texcoord_buffer.data());
+
+  glDrawArrays(GL_TRIANGLES, 0, n);
+
+  glDisableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+}
+
+#endif
+
 void
 Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
 {
@@ -590,6 +685,13 @@ Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
   if (text3.empty())
     return;
 
+#ifdef USE_FREETYPE
+  if (background_mode == OPAQUE)
+    DrawFilledRectangle({p, TextCache::GetSize(*font, text3)},
+                        background_color);
+
+  DrawGlyphs(p, {16384u, font->GetHeight()}, text3);
+#else
   GLTexture *texture = TextCache::Get(*font, text3);
   if (texture == nullptr)
     return;
@@ -603,6 +705,7 @@ Canvas::DrawText(PixelPoint p, tstring_view text) noexcept
 
   texture->Bind();
   texture->Draw(p);
+#endif
 }
 
 void
@@ -624,6 +727,9 @@ Canvas::DrawTransparentText(PixelPoint p, tstring_view text) noexcept
   if (text3.empty())
     return;
 
+#ifdef USE_FREETYPE
+  DrawGlyphs(p, {16384u, font->GetHeight()}, text3);
+#else
   GLTexture *texture = TextCache::Get(*font, text3);
   if (texture == nullptr)
     return;
@@ -634,6 +740,7 @@ Canvas::DrawTransparentText(PixelPoint p, tstring_view text) noexcept
 
   texture->Bind();
   texture->Draw(p);
+#endif
 }
 
 void
@@ -656,6 +763,12 @@ Canvas::DrawClippedText(PixelPoint p, PixelSize size,
   if (text3.empty())
     return;
 
+#ifdef USE_FREETYPE
+  if (font->GetHeight() < size.height)
+    size.height = font->GetHeight();
+
+  DrawGlyphs(p, size, text3);
+#else
   GLTexture *texture = TextCache::Get(*font, text3);
   if (texture == nullptr)
     return;
@@ -671,6 +784,7 @@ Canvas::DrawClippedText(PixelPoint p, PixelSize size,
 
   texture->Bind();
   texture->Draw({p, size}, PixelRect{size});
+#endif
 }
 
 void
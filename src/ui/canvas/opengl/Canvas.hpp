@@ -56,6 +56,14 @@ protected:
    */
   static AllocatedArray<BulkPixelPoint> vertex_buffer;
 
+#ifdef USE_FREETYPE
+  /**
+   * static buffer to store the texture coordinates of glyphs; their
+   * positions are stored in #vertex_buffer.
+   */
+  static AllocatedArray<GLfloat> texcoord_buffer;
+#endif
+
 public:
   Canvas() noexcept = default;
   constexpr Canvas(PixelSize _size) noexcept:size(_size) {}
@@ -304,6 +312,18 @@ public:
   void DrawClippedText(PixelPoint p, PixelSize size,
                        tstring_view text) noexcept;
 
+#ifdef USE_FREETYPE
+private:
+  /**
+   * Draw the glyphs of the text from the font's glyph atlas with a
+   * single draw call, clipped to the given size.
+   */
+  void DrawGlyphs(PixelPoint p, PixelSize clip,
+                  std::string_view text) noexcept;
+
+public:
+#endif
+
   void DrawClippedText(PixelPoint p, unsigned width,
                        tstring_view text) noexcept {
     DrawClippedText(p, {width, 16384u}, text);
@@ -23,6 +23,23 @@ inline PFNGLMULTIDRAWARRAYSEXTPROC multi_draw_arrays;
 inline PFNGLMULTIDRAWELEMENTSEXTPROC multi_draw_elements;
 #endif
 
+static inline bool HaveMultiDrawArrays() noexcept {
+#ifdef HAVE_DYNAMIC_MULTI_DRAW_ARRAYS
+  return multi_draw_arrays != nullptr;
+#else
+  return true;
+#endif
+}
+
+template<typename... Args>
+static inline void MultiDrawArrays(Args... args) noexcept {
+#ifdef HAVE_DYNAMIC_MULTI_DRAW_ARRAYS
+  multi_draw_arrays(args...);
+#else
+  glMultiDrawArraysEXT(args...);
+#endif
+}
+
 static inline bool HaveMultiDrawElements() noexcept {
 #ifdef HAVE_DYNAMIC_MULTI_DRAW_ARRAYS
   return multi_draw_elements != nullptr;
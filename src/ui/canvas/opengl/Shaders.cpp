@@ -42,6 +42,10 @@ GLint filled_circle_projection, filled_circle_translate,
   filled_circle_center, filled_circle_radius1, filled_circle_radius2,
   filled_circle_color1, filled_circle_color2;
 
+GLProgram *trail_shader;
+GLint trail_projection, trail_modelview, trail_translate,
+  trail_value_scale, trail_drift, trail_colors, trail_widths;
+
 } // namespace OpenGL
 
 #define GLSL_VERSION "#version 100\n"
@@ -240,6 +244,50 @@ static constexpr char filled_circle_fragment_shader[] =
     }
 )glsl";
 
+/* "value_scale" maps the value to a table index: x is the factor
+   for negative values, y the factor for positive values and z the
+   offset; "drift" is the drift direction (xy) and the current time
+   (z) which is combined with the drift coefficients of each vertex */
+static constexpr char trail_vertex_shader[] =
+  GLSL_VERSION
+  R"glsl(
+    uniform mat4 projection;
+    uniform mat4 modelview;
+    uniform vec2 translate;
+    uniform vec3 value_scale;
+    uniform vec3 drift;
+    uniform vec4 colors[15];
+    uniform float widths[15];
+    attribute vec4 position;
+    attribute vec4 texcoord;
+    varying vec4 colorvar;
+    void main() {
+      float value = texcoord.y;
+      float factor = value < 0.0 ? value_scale.x : value_scale.y;
+      int i = int(clamp(value * factor + value_scale.z, 0.0, 14.0));
+
+      vec4 p = modelview * vec4(position.xy, 0.0, 1.0);
+      vec4 other = modelview * vec4(position.zw, 0.0, 1.0);
+      vec2 direction = other.xy - p.xy;
+      float distance = length(direction);
+      if (distance > 0.0)
+        direction /= distance;
+
+      float drift_time = drift.z * texcoord.z - texcoord.w;
+      gl_Position = modelview * vec4(position.xy + drift.xy * drift_time,
+                                     0.0, 1.0);
+
+      /* extrude to the given side, with a square cap */
+      vec2 normal = vec2(-direction.y, direction.x);
+      gl_Position.xy += (normal * texcoord.x - direction) * (widths[i] * 0.5);
+      gl_Position.xy += translate;
+      gl_Position = projection * gl_Position;
+      colorvar = colors[i];
+    }
+)glsl";
+
+static const char *const trail_fragment_shader = solid_fragment_shader;
+
 static void
 CompileAttachShader(GLProgram &program, GLenum type, const char *code)
 {
@@ -383,11 +431,26 @@ OpenGL::InitShaders()
   filled_circle_radius2 = filled_circle_shader->GetUniformLocation("radius2");
   filled_circle_color1 = filled_circle_shader->GetUniformLocation("color1");
   filled_circle_color2 = filled_circle_shader->GetUniformLocation("color2");
+
+  trail_shader = CompileProgram(trail_vertex_shader, trail_fragment_shader);
+  trail_shader->BindAttribLocation(Attribute::POSITION, "position");
+  trail_shader->BindAttribLocation(Attribute::TEXCOORD, "texcoord");
+  LinkProgram(*trail_shader);
+
+  trail_projection = trail_shader->GetUniformLocation("projection");
+  trail_modelview = trail_shader->GetUniformLocation("modelview");
+  trail_translate = trail_shader->GetUniformLocation("translate");
+  trail_value_scale = trail_shader->GetUniformLocation("value_scale");
+  trail_drift = trail_shader->GetUniformLocation("drift");
+  trail_colors = trail_shader->GetUniformLocation("colors");
+  trail_widths = trail_shader->GetUniformLocation("widths");
 }
 
 void
 OpenGL::DeinitShaders() noexcept
 {
+  delete trail_shader;
+  trail_shader = nullptr;
   delete filled_circle_shader;
   filled_circle_shader = nullptr;
   delete circle_outline_shader;
@@ -441,6 +504,10 @@ OpenGL::UpdateShaderProjectionMatrix() noexcept
   filled_circle_shader->Use();
   glUniformMatrix4fv(filled_circle_projection, 1, GL_FALSE,
                      glm::value_ptr(projection_matrix));
+
+  trail_shader->Use();
+  glUniformMatrix4fv(trail_projection, 1, GL_FALSE,
+                     glm::value_ptr(projection_matrix));
 }
 
 void
@@ -471,4 +538,7 @@ OpenGL::UpdateShaderTranslate() noexcept
 
   filled_circle_shader->Use();
   glUniform2f(filled_circle_translate, t.x, t.y);
+
+  trail_shader->Use();
+  glUniform2f(trail_translate, t.x, t.y);
 }
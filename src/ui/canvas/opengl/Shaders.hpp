@@ -64,6 +64,20 @@ extern GLint filled_circle_projection, filled_circle_translate,
   filled_circle_center, filled_circle_radius1, filled_circle_radius2,
   filled_circle_color1, filled_circle_color2;
 
+/**
+ * A shader that draws thick line segments in geographic coordinates
+ * (see ToGLM()).  Each vertex has the location of its own end and of
+ * the other end of the segment (#Attribute::POSITION), and
+ * #Attribute::TEXCOORD contains the side of the line (-1 or +1), a
+ * value which selects color and width from a table of
+ * #TRAIL_TABLE_SIZE entries, and two drift coefficients.
+ */
+extern GLProgram *trail_shader;
+extern GLint trail_projection, trail_modelview, trail_translate,
+  trail_value_scale, trail_drift, trail_colors, trail_widths;
+
+static constexpr unsigned TRAIL_TABLE_SIZE = 15;
+
 /**
  * Throws on error.
  */
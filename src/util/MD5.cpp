@@ -111,8 +111,23 @@ MD5::Append(std::byte ch) noexcept
 void
 MD5::Append(std::span<const std::byte> src) noexcept
 {
-  for (std::byte i : src)
-    Append(i);
+  std::size_t position = message_length % buff512bits.size();
+  message_length += src.size();
+
+  /* copy whole chunks into the block buffer instead of appending one
+     byte at a time */
+  while (!src.empty()) {
+    const std::size_t n = std::min(src.size(),
+                                   buff512bits.size() - position);
+    std::copy_n(src.begin(), n, buff512bits.begin() + position);
+    src = src.subspan(n);
+    position += n;
+
+    if (position == buff512bits.size()) {
+      Process512();
+      position = 0;
+    }
+  }
 }
 
 /**
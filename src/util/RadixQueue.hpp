@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/**
+ * A priority queue for values with an unsigned integer key, lowest
+ * key first.  This is a "radix heap": items are sorted into buckets
+ * by the highest bit in which their key differs from the last
+ * extracted minimum, which makes push() O(1) and pop() amortised
+ * O(log(key range)) without any comparisons between items.
+ *
+ * A pure radix heap requires that no key smaller than the last
+ * extracted one is ever pushed.  This class does not rely on that:
+ * such keys go to a small binary heap which is consulted by top(),
+ * so the queue always returns the exact minimum.  Items with equal
+ * keys are returned in unspecified order.
+ *
+ * clear() keeps all allocated memory, so a long-lived queue does not
+ * allocate once it has grown to its working size.
+ */
+template<typename T>
+class RadixQueue {
+  struct Item {
+    unsigned key;
+    T value;
+  };
+
+  struct Greater {
+    constexpr bool operator()(const Item &a, const Item &b) const noexcept {
+      return a.key > b.key;
+    }
+  };
+
+  static constexpr std::size_t N_BUCKETS =
+    1 + std::numeric_limits<unsigned>::digits;
+
+  /**
+   * Bucket 0 holds items whose key equals #last; bucket i>0 holds
+   * items whose key differs from #last first in bit i-1.
+   */
+  std::array<std::vector<Item>, N_BUCKETS> buckets;
+
+  /**
+   * Items with a key smaller than #last, as a min-heap.
+   */
+  std::vector<Item> underflow;
+
+  /**
+   * The key all bucket positions are relative to; no item in
+   * #buckets has a smaller key.
+   */
+  unsigned last = 0;
+
+  /**
+   * The number of items in #buckets (not counting #underflow).
+   */
+  std::size_t n_bucketed = 0;
+
+public:
+  [[gnu::pure]]
+  bool empty() const noexcept {
+    return n_bucketed == 0 && underflow.empty();
+  }
+
+  [[gnu::pure]]
+  std::size_t size() const noexcept {
+    return n_bucketed + underflow.size();
+  }
+
+  void clear() noexcept {
+    for (auto &b : buckets)
+      b.clear();
+    underflow.clear();
+    last = 0;
+    n_bucketed = 0;
+  }
+
+  void reserve(std::size_t n) noexcept {
+    buckets.front().reserve(n);
+  }
+
+  void push(unsigned key, const T &value) noexcept {
+    if (n_bucketed == 0 && key < last)
+      /* the buckets are empty, we can move the reference point
+         without redistributing anything */
+      last = key;
+
+    if (key < last) {
+      underflow.push_back({key, value});
+      std::push_heap(underflow.begin(), underflow.end(), Greater());
+    } else {
+      buckets[BucketIndex(key)].push_back({key, value});
+      ++n_bucketed;
+    }
+  }
+
+  /**
+   * Returns the key of the top item.  This is not const because
+   * locating the minimum may redistribute buckets.
+   */
+  unsigned top_key() noexcept {
+    return TopItem().key;
+  }
+
+  T &top() noexcept {
+    return TopItem().value;
+  }
+
+  void pop() noexcept {
+    if (UnderflowFirst()) {
+      std::pop_heap(underflow.begin(), underflow.end(), Greater());
+      underflow.pop_back();
+    } else {
+      buckets.front().pop_back();
+      --n_bucketed;
+    }
+  }
+
+private:
+  [[gnu::pure]]
+  unsigned BucketIndex(unsigned key) const noexcept {
+    return std::bit_width(key ^ last);
+  }
+
+  /**
+   * Ensure that bucket 0 contains the minimum of all bucketed
+   * items (unless there are none).
+   */
+  void Normalize() noexcept {
+    if (n_bucketed == 0 || !buckets.front().empty())
+      return;
+
+    auto b = std::find_if(std::next(buckets.begin()), buckets.end(),
+                          [](const auto &i){ return !i.empty(); });
+    assert(b != buckets.end());
+
+    last = std::min_element(b->begin(), b->end(),
+                            [](const Item &x, const Item &y){
+                              return x.key < y.key;
+                            })->key;
+
+    /* all items of this bucket now fall into lower buckets */
+    for (const auto &i : *b)
+      buckets[BucketIndex(i.key)].push_back(i);
+    b->clear();
+  }
+
+  bool UnderflowFirst() noexcept {
+    Normalize();
+
+    if (underflow.empty())
+      return false;
+
+    return n_bucketed == 0 || underflow.front().key < last;
+  }
+
+  Item &TopItem() noexcept {
+    assert(!empty());
+
+    return UnderflowFirst()
+      ? underflow.front()
+      : buckets.front().back();
+  }
+};
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+
+/**
+ * A fixed-size lock-free ring buffer for exactly one producer thread
+ * and exactly one consumer thread.  The producer calls Push(), the
+ * consumer calls Consume(); neither blocks or allocates.
+ *
+ * When the ring is full, Push() rejects the new item; the consumer
+ * owns all items up to the write position, so the producer must not
+ * overwrite them.
+ *
+ * @param N the capacity, a power of two
+ */
+template<typename T, std::size_t N>
+class SPSCRing {
+  static_assert(std::has_single_bit(N));
+
+  std::array<T, N> items;
+
+  /**
+   * The number of items ever pushed.  Only the producer writes it.
+   */
+  alignas(64) std::atomic<std::size_t> write_position{0};
+
+  /**
+   * The number of items ever consumed.  Only the consumer writes it.
+   */
+  alignas(64) std::atomic<std::size_t> read_position{0};
+
+public:
+  static constexpr std::size_t CAPACITY = N;
+
+  /**
+   * May be called by either thread, but the result may be outdated
+   * by the time it is returned.
+   */
+  [[gnu::pure]]
+  bool IsEmpty() const noexcept {
+    return write_position.load(std::memory_order_acquire) ==
+      read_position.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Producer: append an item.
+   *
+   * @return false if the ring is full and the item was discarded
+   */
+  bool Push(const T &value) noexcept {
+    const std::size_t w = write_position.load(std::memory_order_relaxed);
+    if (w - read_position.load(std::memory_order_acquire) >= N)
+      return false;
+
+    items[w & (N - 1)] = value;
+    write_position.store(w + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Consumer: pass all items which are currently available to the
+   * given function (in the order they were pushed), and remove them.
+   * Items pushed while this method runs may or may not be included.
+   *
+   * @return the number of items consumed
+   */
+  template<typename F>
+  std::size_t Consume(F &&f) noexcept {
+    const std::size_t r = read_position.load(std::memory_order_relaxed);
+    const std::size_t w = write_position.load(std::memory_order_acquire);
+
+    for (std::size_t i = r; i != w; ++i)
+      f(items[i & (N - 1)]);
+
+    read_position.store(w, std::memory_order_release);
+    return w - r;
+  }
+};
@@ -0,0 +1,40 @@
+-- Runs many concurrent xcsoar.async tasks which sleep repeatedly,
+-- and reports how much later than requested they were resumed.  Run
+-- this inside XCSoar; the results are written to the log file.
+
+local async = xcsoar.async
+local now = xcsoar.profiler.now
+
+local n_tasks = 500
+local n_sleeps = 20
+local period = 0.01
+
+local remaining = n_tasks
+local resumes = 0
+local total_delay = 0
+local max_delay = 0
+local start = now()
+
+for i = 1, n_tasks do
+   async.run(function()
+      for _ = 1, n_sleeps do
+         local t = now()
+         async.sleep(period)
+         local delay = now() - t - period
+         resumes = resumes + 1
+         total_delay = total_delay + delay
+         if delay > max_delay then
+            max_delay = delay
+         end
+      end
+
+      remaining = remaining - 1
+      if remaining == 0 then
+         local elapsed = now() - start
+         print(string.format("%d tasks, %d resumes in %.3f s (ideal %.3f s)",
+                             n_tasks, resumes, elapsed, n_sleeps * period))
+         print(string.format("resume delay: mean %.3f ms, max %.3f ms",
+                             total_delay / resumes * 1000, max_delay * 1000))
+      end
+   end)
+end
@@ -0,0 +1,43 @@
+-- Measures the cost of reading blackboard attributes, one by one and
+-- with snapshot().  Run this inside XCSoar (e.g. in a replay); the
+-- results are written to the log file.
+
+local bb = xcsoar.blackboard
+local now = xcsoar.profiler.now
+
+local fields = {
+   "clock", "time", "location", "altitude", "altitude_agl", "track",
+   "ground_speed", "air_speed", "total_energy_vario", "netto_vario",
+}
+
+local n = 10000
+
+local function report(name, accesses, t)
+   print(string.format("%s: %d accesses in %.3f s, %.0f accesses/s",
+                       name, accesses, t, accesses / t))
+end
+
+local start = now()
+for _ = 1, n do
+   for _, name in ipairs(fields) do
+      local _ = bb[name]
+   end
+end
+report("index", n * #fields, now() - start)
+
+start = now()
+for _ = 1, n do
+   bb.snapshot(fields)
+end
+report("snapshot(fields)", n * #fields, now() - start)
+
+local all = 0
+for _ in pairs(bb.snapshot()) do
+   all = all + 1
+end
+
+start = now()
+for _ = 1, n do
+   bb.snapshot()
+end
+report("snapshot()", n * all, now() - start)
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Load an airspace file (preferably a complete national one) and
+ * draw all of it over and over while panning and zooming, and report
+ * how long drawing the airspaces took per frame.  With OpenGL, this
+ * also reports the number of draw calls per frame.
+ *
+ * Usage: BenchmarkAirspaceRenderer [-WxH] FILE.txt
+ */
+
+#define ENABLE_MAIN_WINDOW
+#define ENABLE_CMDLINE
+#define USAGE "[-WxH] FILE.txt"
+
+#include "Main.hpp"
+#include "ui/event/PeriodicTimer.hpp"
+#include "ui/canvas/Canvas.hpp"
+#include "ui/window/PaintWindow.hpp"
+#include "Renderer/AirspaceRenderer.hpp"
+#include "Renderer/AirspaceRendererSettings.hpp"
+#include "Look/AirspaceLook.hpp"
+#include "Projection/WindowProjection.hpp"
+#include "Airspace/AirspaceParser.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Engine/Airspace/AbstractAirspace.hpp"
+#include "Geo/GeoBounds.hpp"
+#include "Geo/GeoVector.hpp"
+#include "io/FileReader.hxx"
+#include "io/BufferedReader.hxx"
+#include "system/Path.hpp"
+#include "Math/Angle.hpp"
+
+#ifndef ENABLE_OPENGL
+#include "ui/canvas/BufferCanvas.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono;
+
+static constexpr unsigned N_FRAMES = 200;
+
+static AllocatedPath path;
+static Airspaces airspaces;
+
+static void
+ParseCommandLine(Args &args)
+{
+  path = args.ExpectNextPath();
+}
+
+[[gnu::pure]]
+static GeoPoint
+GetCenter(const Airspaces &airspaces) noexcept
+{
+  GeoBounds bounds = GeoBounds::Invalid();
+  for (const auto &i : airspaces.QueryAll()) {
+    const GeoBounds b = i.GetAirspace().GetGeoBounds();
+    bounds.Extend(b.GetNorthWest());
+    bounds.Extend(b.GetSouthEast());
+  }
+
+  return bounds.IsValid()
+    ? bounds.GetCenter()
+    : GeoPoint(Angle::Zero(), Angle::Zero());
+}
+
+class AirspaceWindow final : public PaintWindow {
+  UI::SingleWindow &main_window;
+
+  AirspaceLook look;
+  AirspaceRendererSettings settings;
+  AirspaceRenderer renderer;
+
+  const GeoPoint center;
+
+  WindowProjection projection;
+
+  std::vector<duration<double>> frame_times;
+  unsigned long total_draw_calls = 0;
+
+public:
+  explicit AirspaceWindow(UI::SingleWindow &_main_window) noexcept
+    :main_window(_main_window), renderer(look),
+     center(GetCenter(airspaces)) {
+    settings.SetDefaults();
+    look.Initialise(settings, normal_font);
+    renderer.SetAirspaces(&airspaces);
+
+    frame_times.reserve(N_FRAMES);
+  }
+
+  void PrintStatistics() noexcept {
+    if (frame_times.size() < 2)
+      return;
+
+    /* the first frame builds caches; report it separately */
+    const auto first = frame_times.front();
+    std::sort(frame_times.begin() + 1, frame_times.end());
+
+    const unsigned n = frame_times.size() - 1;
+    duration<double> total{};
+    for (auto i = frame_times.begin() + 1; i != frame_times.end(); ++i)
+      total += *i;
+
+    printf("airspaces=%u frames=%u first=%.3fms mean=%.3fms median=%.3fms"
+           " min=%.3fms max=%.3fms",
+           airspaces.GetSize(), n, first.count() * 1000,
+           total.count() * 1000 / n,
+           frame_times[1 + n / 2].count() * 1000,
+           frame_times[1].count() * 1000,
+           frame_times.back().count() * 1000);
+#ifdef ENABLE_OPENGL
+    printf(" draw_calls/frame=%.1f", double(total_draw_calls) / n);
+#endif
+    printf("\n");
+  }
+
+private:
+  void UpdateProjection(PixelSize size) noexcept {
+    const unsigned frame = frame_times.size();
+
+    /* circle around the center, and zoom in and out */
+    const Angle direction = Angle::FullCircle() * frame / N_FRAMES;
+    const double radius = 50000 + 25000 * (1 + direction.cos());
+
+    projection.SetScreenSize(size);
+    projection.SetScreenOrigin(PixelRect{size}.GetCenter());
+    projection.SetGeoLocation(GeoVector(100000, direction).EndPoint(center));
+    projection.SetScaleFromRadius(radius);
+    projection.UpdateScreenBounds();
+  }
+
+protected:
+  void OnPaint(Canvas &canvas) noexcept override {
+    canvas.ClearWhite();
+
+    UpdateProjection(canvas.GetSize());
+
+#ifndef ENABLE_OPENGL
+    BufferCanvas stencil_canvas;
+    stencil_canvas.Create(canvas);
+#endif
+
+    const auto start = steady_clock::now();
+    renderer.Draw(canvas,
+#ifndef ENABLE_OPENGL
+                  stencil_canvas,
+#endif
+                  projection, settings);
+    frame_times.push_back(steady_clock::now() - start);
+
+#ifdef ENABLE_OPENGL
+    if (frame_times.size() > 1)
+      total_draw_calls += renderer.GetDrawCalls();
+#endif
+
+    if (frame_times.size() >= N_FRAMES)
+      main_window.PostQuit();
+  }
+};
+
+static void
+Main(TestMainWindow &main_window)
+{
+  {
+    FileReader file_reader{path};
+    BufferedReader buffered_reader{file_reader};
+    ParseAirspaceFile(airspaces, buffered_reader);
+    airspaces.Optimise();
+  }
+
+  AirspaceWindow window(main_window);
+  window.Create(main_window, main_window.GetClientRect());
+  main_window.SetFullWindow(window);
+
+  /* paint a new frame as soon as the event loop is idle */
+  UI::PeriodicTimer timer([&window]{ window.Invalidate(); });
+  timer.Schedule(milliseconds(1));
+
+  main_window.RunEventLoop();
+
+  window.PrintStatistics();
+}
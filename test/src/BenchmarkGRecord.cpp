@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Write an archive of synthetic signed IGC files (10 hours with one
+ * fix per second each) to the given directory, signing each record
+ * as it is written like the logger does, and report the cost of
+ * signing per record and of finalising the G record.  Then verify
+ * the archive with one worker and with one worker per CPU and
+ * report the throughput.
+ *
+ * Usage: BenchmarkGRecord DIRECTORY [N_FILES]
+ */
+
+#include "Logger/GRecord.hpp"
+#include "io/FileOutputStream.hxx"
+#include "io/BufferedOutputStream.hxx"
+#include "system/Args.hpp"
+#include "system/FileUtil.hpp"
+#include "system/Path.hpp"
+#include "thread/WorkStealingPool.hpp"
+#include "util/PrintException.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std::chrono;
+
+static constexpr unsigned N_FIXES = 10 * 3600;
+
+static void
+AppendRecord(GRecord &g, BufferedOutputStream &writer, const char *record)
+{
+  g.AppendRecordToBuffer(record);
+  writer.Write(record);
+  writer.Write('\n');
+}
+
+/**
+ * @return the time it took to finalise the G record
+ */
+static duration<double>
+WriteFile(Path path, unsigned seed, duration<double> &sign_time)
+{
+  FileOutputStream file(path);
+  BufferedOutputStream writer(file);
+
+  GRecord g;
+  g.Initialize();
+
+  AppendRecord(g, writer, "AXCSBNC");
+  AppendRecord(g, writer, "HFDTE040910");
+  AppendRecord(g, writer, "HFFTYFRTYPE:XCSOAR,XCSOAR Linux 7.0");
+  AppendRecord(g, writer, "I023638FXA3940SIU");
+
+  char record[64];
+  for (unsigned i = 0; i < N_FIXES; ++i) {
+    const unsigned t = 36000 + i;
+    snprintf(record, sizeof(record),
+             "B%02u%02u%02u%07uN%08uEA%05u%05u%03u%02u",
+             t / 3600, t / 60 % 60, t % 60,
+             5050000 + (seed * 7919 + i * 13) % 100000,
+             627000 + (seed * 104729 + i * 17) % 100000,
+             500 + i % 1500, 480 + i % 1500, i % 1000, 10 + seed % 10);
+
+    const auto start = steady_clock::now();
+    g.AppendRecordToBuffer(record);
+    sign_time += steady_clock::now() - start;
+
+    writer.Write(record);
+    writer.Write('\n');
+  }
+
+  const auto start = steady_clock::now();
+  g.FinalizeBuffer();
+  const duration<double> finalize_time = steady_clock::now() - start;
+
+  g.WriteTo(writer);
+  writer.Flush();
+  file.Commit();
+
+  return finalize_time;
+}
+
+static void
+Verify(const std::vector<AllocatedPath> &paths, uint64_t total_size,
+       unsigned n_workers)
+{
+  WorkStealingPool pool(n_workers);
+  std::atomic_uint n_failed{0};
+
+  const auto start = steady_clock::now();
+  pool.Run(paths.size(), [&paths, &n_failed](std::size_t i, unsigned) {
+    try {
+      GRecord g;
+      g.Initialize();
+      g.VerifyGRecordInFile(paths[i]);
+    } catch (...) {
+      ++n_failed;
+    }
+  });
+  const duration<double> elapsed = steady_clock::now() - start;
+
+  printf("verify workers=%u files=%zu failed=%u time=%.3fs"
+         " throughput=%.1fMB/s\n",
+         n_workers, paths.size(), n_failed.load(), elapsed.count(),
+         total_size / elapsed.count() / (1024 * 1024));
+}
+
+int
+main(int argc, char **argv)
+try {
+  Args args(argc, argv, "DIRECTORY [N_FILES]");
+  const auto directory = args.ExpectNextPath();
+  const unsigned n_files = args.IsEmpty() ? 32 : args.ExpectNextInt();
+  args.ExpectEnd();
+
+  if (n_files == 0) {
+    fprintf(stderr, "Invalid number of files\n");
+    return EXIT_FAILURE;
+  }
+
+  Directory::Create(directory);
+
+  std::vector<AllocatedPath> paths;
+  uint64_t total_size = 0;
+  duration<double> sign_time{}, max_finalize_time{};
+
+  for (unsigned i = 0; i < n_files; ++i) {
+    char name[32];
+    snprintf(name, sizeof(name), "bench-%04u.igc", i);
+    paths.emplace_back(AllocatedPath::Build(directory, name));
+
+    max_finalize_time = std::max(max_finalize_time,
+                                 WriteFile(paths.back(), i, sign_time));
+    total_size += File::GetSize(paths.back());
+  }
+
+  printf("sign files=%u size=%.1fMB record=%.3fus max_finalize=%.3fus\n",
+         n_files, total_size / (1024. * 1024),
+         sign_time.count() * 1e6 / (n_files * N_FIXES),
+         max_finalize_time.count() * 1e6);
+
+  Verify(paths, total_size, 1);
+
+  const unsigned n_cpus = std::thread::hardware_concurrency();
+  if (n_cpus > 1)
+    Verify(paths, total_size, n_cpus);
+
+  return EXIT_SUCCESS;
+} catch (...) {
+  PrintException(std::current_exception());
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Feed the NMEA sentences from the given files into a device driver
+ * and the generic NMEA parser (like DeviceDescriptor does) over and
+ * over again, and report the number of sentences per second.
+ *
+ * Usage: BenchmarkNMEAParser DRIVER FILE...
+ */
+
+#include "NMEA/Info.hpp"
+#include "Device/Port/NullPort.hpp"
+#include "Device/Driver.hpp"
+#include "Device/Register.hpp"
+#include "Device/Parser.hpp"
+#include "Device/Config.hpp"
+#include "system/Args.hpp"
+#include "util/StringStrip.hxx"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std::chrono;
+
+static bool
+LoadLines(const char *path, std::vector<std::string> &lines)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    fprintf(stderr, "Failed to open %s\n", path);
+    return false;
+  }
+
+  char buffer[1024];
+  while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+    StripRight(buffer);
+    if (*buffer != 0)
+      lines.emplace_back(buffer);
+  }
+
+  fclose(file);
+  return true;
+}
+
+int
+main(int argc, char **argv)
+{
+  Args args(argc, argv, "DRIVER FILE...");
+  tstring driver_name = args.ExpectNextT();
+
+  const DeviceRegister *driver = FindDriverByName(driver_name.c_str());
+  if (driver == nullptr) {
+    _ftprintf(stderr, _T("No such driver: %s\n"), driver_name.c_str());
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> lines;
+  do {
+    if (!LoadLines(args.ExpectNext(), lines))
+      return EXIT_FAILURE;
+  } while (!args.IsEmpty());
+
+  if (lines.empty()) {
+    fprintf(stderr, "No sentences\n");
+    return EXIT_FAILURE;
+  }
+
+  DeviceConfig config;
+  config.Clear();
+
+  NullPort port;
+  Device *device = driver->CreateOnPort != nullptr
+    ? driver->CreateOnPort(config, port)
+    : nullptr;
+
+  NMEAParser parser;
+
+  NMEAInfo data;
+  data.Reset();
+
+  unsigned long n_sentences = 0, n_parsed = 0;
+  const auto start = steady_clock::now();
+  duration<double> elapsed;
+
+  do {
+    for (const auto &line : lines) {
+      data.UpdateClock();
+
+      const char *s = line.c_str();
+      if ((device != nullptr && device->ParseNMEA(s, data)) ||
+          parser.ParseLine(s, data))
+        ++n_parsed;
+    }
+
+    n_sentences += lines.size();
+    elapsed = steady_clock::now() - start;
+  } while (elapsed < seconds(1));
+
+  printf("sentences=%lu parsed=%lu time=%.3fs sentences/s=%.0f\n",
+         n_sentences, n_parsed, elapsed.count(),
+         n_sentences / elapsed.count());
+
+  delete device;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Measure the reach calculation with 1..N worker threads, and verify
+ * that all thread counts produce the same fan tree.
+ *
+ * Usage: BenchmarkReach MAP.xcm [MAX_THREADS]
+ */
+
+#include "Route/TerrainRoute.hpp"
+#include "Route/ReachFan.hpp"
+#include "Route/FlatTriangleFanVisitor.hpp"
+#include "Terrain/RasterMap.hpp"
+#include "Terrain/Loader.hpp"
+#include "GlideSolvers/GlideSettings.hpp"
+#include "GlideSolvers/GlidePolar.hpp"
+#include "Geo/SpeedVector.hpp"
+#include "Geo/Flat/FlatGeoPoint.hpp"
+#include "Operation/Operation.hpp"
+#include "thread/WorkStealingPool.hpp"
+#include "util/PrintException.hxx"
+
+#include <zzip/zzip.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * Flattens all fans of a tree into one list of points, for
+ * comparison.
+ */
+class CollectFans final : public FlatTriangleFanVisitor {
+public:
+  std::vector<FlatGeoPoint> points;
+
+  void VisitFan(FlatGeoPoint origin,
+                std::span<const FlatGeoPoint> fan) noexcept override {
+    points.push_back(origin);
+    points.insert(points.end(), fan.begin(), fan.end());
+    points.emplace_back(0, 0);
+  }
+};
+
+static std::vector<FlatGeoPoint>
+Solve(const RasterMap &map, WorkStealingPool *pool)
+{
+  GlideSettings settings;
+  settings.SetDefaults();
+  RoutePlannerConfig config;
+  config.SetDefaults();
+
+  const GlidePolar polar(0.1);
+  const SpeedVector wind(Angle::Degrees(0), 0);
+
+  TerrainRoute route;
+  route.UpdatePolar(settings, config, polar, polar, wind, 0);
+  route.SetTerrain(&map);
+  route.SetReachPool(pool);
+
+  CollectFans visitor;
+
+  /* a few origins around the map center */
+  const GeoPoint center = map.GetMapCenter();
+  for (int i = -2; i <= 2; ++i) {
+    const GeoPoint origin(center.longitude + Angle::Degrees(0.05 * i),
+                          center.latitude + Angle::Degrees(0.03 * i));
+    const int height = map.GetHeight(origin).GetValueOr0() + 1500;
+
+    const auto reach = route.SolveReach(AGeoPoint(origin, height), config,
+                                        INT_MAX, true, false);
+    reach.AcceptInRange(map.GetBounds(), visitor);
+  }
+
+  return std::move(visitor.points);
+}
+
+int
+main(int argc, char **argv)
+try {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Usage: %s MAP.xcm [MAX_THREADS]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const char *map_path = argv[1];
+  const unsigned max_threads = argc > 2 ? atoi(argv[2]) : 4;
+
+  ZZIP_DIR *dir = zzip_dir_open(map_path, nullptr);
+  if (dir == nullptr) {
+    fprintf(stderr, "Failed to open %s\n", map_path);
+    return EXIT_FAILURE;
+  }
+
+  RasterMap map;
+
+  {
+    NullOperationEnvironment operation;
+    LoadTerrainOverview(dir, map.GetTileCache(), operation);
+  }
+
+  map.UpdateProjection();
+
+  SharedMutex mutex;
+  do {
+    UpdateTerrainTiles(dir, map.GetTileCache(), mutex,
+                       map.GetProjection(),
+                       map.GetMapCenter(), 100000);
+  } while (map.IsDirty());
+  zzip_dir_close(dir);
+
+  const auto expected = Solve(map, nullptr);
+
+  constexpr unsigned n_iterations = 10;
+  double serial_duration = 0;
+
+  for (unsigned n_threads = 1; n_threads <= max_threads; ++n_threads) {
+    std::unique_ptr<WorkStealingPool> pool;
+    if (n_threads > 1)
+      pool = std::make_unique<WorkStealingPool>(n_threads);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0; i < n_iterations; ++i) {
+      if (Solve(map, pool.get()) != expected) {
+        fprintf(stderr, "Result with %u threads differs\n", n_threads);
+        return EXIT_FAILURE;
+      }
+    }
+
+    const std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+    if (n_threads == 1)
+      serial_duration = duration.count();
+
+    printf("threads=%u time=%.1fms speedup=%.2f\n", n_threads,
+           duration.count() * 1000 / n_iterations,
+           serial_duration / duration.count());
+  }
+
+  return EXIT_SUCCESS;
+} catch (...) {
+  PrintException(std::current_exception());
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Replay a flight and plan a terrain route from the aircraft back to
+ * the first fix every 5 seconds, like RouteComputer does.  This is
+ * done twice, once with full solutions and once in incremental mode,
+ * and the solves per second and node expansions per tick are
+ * reported.
+ *
+ * Usage: BenchmarkRouteReplay MAP.xcm DRIVER FILE
+ */
+
+#include "system/Args.hpp"
+#include "DebugReplay.hpp"
+#include "Route/TerrainRoute.hpp"
+#include "Terrain/RasterMap.hpp"
+#include "Terrain/Loader.hpp"
+#include "GlideSolvers/GlideSettings.hpp"
+#include "GlideSolvers/GlidePolar.hpp"
+#include "Geo/SpeedVector.hpp"
+#include "Operation/Operation.hpp"
+#include "util/PrintException.hxx"
+
+#include <zzip/zzip.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std::chrono;
+
+struct Tick {
+  AGeoPoint location;
+  int ceiling;
+};
+
+struct ReplayResult {
+  std::vector<Route> solutions;
+
+  unsigned n_found = 0, n_repaired = 0;
+  unsigned long n_expansions = 0;
+
+  duration<double> time{};
+};
+
+static ReplayResult
+Replay(const RasterMap &map, const AGeoPoint &home,
+       const std::vector<Tick> &ticks, bool incremental)
+{
+  GlideSettings settings;
+  settings.SetDefaults();
+  RoutePlannerConfig config;
+  config.SetDefaults();
+  config.mode = RoutePlannerConfig::Mode::TERRAIN;
+
+  const GlidePolar polar(1);
+  const SpeedVector wind(Angle::Degrees(0), 0);
+
+  TerrainRoute route;
+  route.UpdatePolar(settings, config, polar, polar, wind, 0);
+  route.SetTerrain(&map);
+  route.SetIncremental(incremental);
+
+  ReplayResult result;
+  result.solutions.reserve(ticks.size());
+
+  for (const auto &tick : ticks) {
+    /* RouteComputer refreshes the polar before each solution */
+    route.UpdatePolar(settings, config, polar, polar, wind, 0);
+
+    const auto start = steady_clock::now();
+    const bool found = route.Solve(home, tick.location, config, tick.ceiling);
+    result.time += steady_clock::now() - start;
+
+    const auto &stats = route.GetSolveStats();
+    if (found) {
+      ++result.n_found;
+      if (stats.repaired)
+        ++result.n_repaired;
+    }
+
+    result.n_expansions += stats.expansions;
+    result.solutions.push_back(route.GetSolution());
+  }
+
+  return result;
+}
+
+static void
+Print(const char *mode, const ReplayResult &result, std::size_t n_ticks)
+{
+  printf("mode=%s ticks=%u found=%u repaired=%u time=%.1fms"
+         " solves/s=%.0f expansions/tick=%.1f\n",
+         mode, (unsigned)n_ticks, result.n_found, result.n_repaired,
+         result.time.count() * 1000,
+         n_ticks / result.time.count(),
+         (double)result.n_expansions / n_ticks);
+}
+
+int
+main(int argc, char **argv)
+try {
+  Args args(argc, argv, "MAP.xcm DRIVER FILE");
+  const char *map_path = args.ExpectNext();
+  std::unique_ptr<DebugReplay> replay(CreateDebugReplay(args));
+  if (!replay)
+    return EXIT_FAILURE;
+
+  args.ExpectEnd();
+
+  ZZIP_DIR *dir = zzip_dir_open(map_path, nullptr);
+  if (dir == nullptr) {
+    fprintf(stderr, "Failed to open %s\n", map_path);
+    return EXIT_FAILURE;
+  }
+
+  RasterMap map;
+
+  {
+    NullOperationEnvironment operation;
+    LoadTerrainOverview(dir, map.GetTileCache(), operation);
+  }
+
+  map.UpdateProjection();
+
+  SharedMutex mutex;
+  do {
+    UpdateTerrainTiles(dir, map.GetTileCache(), mutex,
+                       map.GetProjection(),
+                       map.GetMapCenter(), 100000);
+  } while (map.IsDirty());
+  zzip_dir_close(dir);
+
+  std::vector<Tick> ticks;
+  AGeoPoint home;
+  TimeStamp last_time = TimeStamp::Undefined();
+
+  while (replay->Next()) {
+    const MoreData &basic = replay->Basic();
+    if (!basic.time_available || !basic.location_available ||
+        !basic.NavAltitudeAvailable())
+      continue;
+
+    if (ticks.empty()) {
+      home = AGeoPoint(basic.location,
+                       map.GetHeight(basic.location).GetValueOr0() + 300);
+    } else if (basic.time < last_time + seconds(5))
+      continue;
+
+    last_time = basic.time;
+    ticks.push_back({AGeoPoint(basic.location, basic.nav_altitude),
+                     (int)basic.nav_altitude + 500});
+  }
+
+  if (ticks.empty()) {
+    fprintf(stderr, "No fixes\n");
+    return EXIT_FAILURE;
+  }
+
+  const auto full = Replay(map, home, ticks, false);
+  Print("full", full, ticks.size());
+
+  const auto incremental = Replay(map, home, ticks, true);
+  Print("incremental", incremental, ticks.size());
+
+  unsigned n_different = 0;
+  for (std::size_t i = 0; i < ticks.size(); ++i)
+    if (full.solutions[i].size() != incremental.solutions[i].size())
+      ++n_different;
+
+  printf("ticks with a different number of route points: %u\n", n_different);
+
+  return EXIT_SUCCESS;
+} catch (...) {
+  PrintException(std::current_exception());
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Fly a 10 point AAT task with the autopilot of the test harness,
+ * with auto MacCready, target optimisation and all other task
+ * calculations enabled, and report the calculation time per tick.
+ *
+ * Usage: BenchmarkTaskMacCready [-v]
+ */
+
+#include "harness_flight.hpp"
+#include "harness_wind.hpp"
+#include "test_debug.hpp"
+#include "Task/TaskManager.hpp"
+#include "Task/Factory/AbstractTaskFactory.hpp"
+#include "Task/Ordered/Points/StartPoint.hpp"
+#include "Task/Ordered/Points/FinishPoint.hpp"
+#include "Task/Ordered/Points/AATPoint.hpp"
+#include "Task/ObservationZones/CylinderZone.hpp"
+#include "Engine/Waypoint/Waypoints.hpp"
+#include "Replay/TaskAutoPilot.hpp"
+#include "Replay/AircraftSim.hpp"
+#include "Replay/TaskAccessor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <stdio.h>
+
+using namespace std::chrono;
+
+/**
+ * Stop after this number of ticks (one tick is one simulated
+ * second).
+ */
+static constexpr unsigned MAX_TICKS = 4 * 3600;
+
+/**
+ * Create a task with a start, 8 AAT cylinders and a finish.
+ */
+static bool
+CreateTask(TaskManager &task_manager, const Waypoints &waypoints)
+{
+  task_manager.SetFactory(TaskFactoryType::AAT);
+  AbstractTaskFactory &fact = task_manager.GetFactory();
+
+  if (!fact.Append(*fact.CreateStart(waypoints.LookupId(1)), false))
+    return false;
+
+  for (unsigned id = 2; id < 10; ++id) {
+    auto tp = fact.CreateIntermediate(TaskPointFactoryType::AAT_CYLINDER,
+                                      waypoints.LookupId(id));
+    ((CylinderZone &)tp->GetObservationZone()).SetRadius(5000);
+    if (!fact.Append(*tp, false))
+      return false;
+  }
+
+  if (!fact.Append(*fact.CreateFinish(waypoints.LookupId(1)), false))
+    return false;
+
+  fact.UpdateGeometry();
+  task_manager.SetActiveTaskPoint(0);
+  task_manager.Resume();
+
+  return !IsError(fact.Validate()) && task_manager.CheckOrderedTask();
+}
+
+static void
+Run(unsigned n_wind)
+{
+  GlidePolar glide_polar(2);
+  Waypoints waypoints;
+  SetupWaypoints(waypoints);
+
+  TaskBehaviour task_behaviour;
+  task_behaviour.SetDefaults();
+  task_behaviour.auto_mc = true;
+  task_behaviour.calc_cruise_efficiency = true;
+  task_behaviour.calc_effective_mc = true;
+  task_behaviour.calc_glide_required = true;
+
+  TaskManager task_manager(task_behaviour, waypoints);
+  task_manager.SetGlidePolar(glide_polar);
+
+  if (!CreateTask(task_manager, waypoints)) {
+    fprintf(stderr, "Failed to create the task\n");
+    return;
+  }
+
+  TaskAccessor ta(task_manager, 300);
+  TaskAutoPilot autopilot(autopilot_parms);
+  AircraftSim aircraft;
+
+  autopilot.SetDefaultLocation(GeoPoint(Angle::Degrees(1), Angle::Degrees(0)));
+  if (n_wind)
+    aircraft.SetWind(wind_to_mag(n_wind), wind_to_dir(n_wind));
+
+  autopilot.Start(ta);
+  aircraft.Start(autopilot.location_start, autopilot.location_previous,
+                 autopilot_parms.start_alt);
+
+  std::vector<duration<double>> tick_times;
+  tick_times.reserve(MAX_TICKS);
+
+  do {
+    autopilot.UpdateState(ta, aircraft.GetState());
+    aircraft.Update(autopilot.heading);
+
+    const AircraftState state = aircraft.GetState();
+    const AircraftState state_last = aircraft.GetLastState();
+
+    const auto start = steady_clock::now();
+    task_manager.Update(state, state_last);
+    task_manager.UpdateIdle(state);
+    task_manager.UpdateAutoMC(state, 0);
+    tick_times.push_back(steady_clock::now() - start);
+  } while (tick_times.size() < MAX_TICKS &&
+           autopilot.UpdateAutopilot(ta, aircraft.GetState()));
+
+  const unsigned n = tick_times.size();
+  duration<double> total{};
+  for (const auto &i : tick_times)
+    total += i;
+
+  std::sort(tick_times.begin(), tick_times.end());
+
+  printf("wind=%u ticks=%u mean=%.3fms median=%.3fms max=%.3fms\n",
+         n_wind, n, total.count() * 1000 / n,
+         tick_times[n / 2].count() * 1000,
+         tick_times.back().count() * 1000);
+}
+
+int
+main(int argc, char **argv)
+{
+  autopilot_parms.SetIdeal();
+
+  if (!ParseArgs(argc, argv))
+    return EXIT_FAILURE;
+
+  for (unsigned i = 0; i < 3; ++i)
+    Run(i);
+
+  return EXIT_SUCCESS;
+}
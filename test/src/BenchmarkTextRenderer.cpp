@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Paint a text-heavy frame like a busy map (waypoint labels with
+ * changing arrival altitudes, static labels and clipped text) over
+ * and over, and report how long drawing the text took per frame.
+ *
+ * Usage: BenchmarkTextRenderer [-WxH]
+ */
+
+#define ENABLE_MAIN_WINDOW
+
+#include "Main.hpp"
+#include "ui/event/PeriodicTimer.hpp"
+#include "ui/canvas/Canvas.hpp"
+#include "ui/canvas/Font.hpp"
+#include "ui/window/PaintWindow.hpp"
+#include "util/Macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono;
+
+static constexpr unsigned N_FRAMES = 200;
+static constexpr unsigned N_LABELS = 400;
+
+static constexpr const TCHAR *waypoint_names[] = {
+  _T("Aachen Merzbrueck"), _T("Bad Breisig"), _T("Christiansholm"),
+  _T("Dahlemer Binz"), _T("Eisenach Kindel"), _T("Fuerstenzell"),
+  _T("Gelnhausen"), _T("Hahnweide"), _T("Inning am Holz"),
+  _T("Juist"), _T("Klippeneck"), _T("Lauterbach"), _T("Mengen"),
+  _T("Neustadt-Glewe"), _T("Oerlinghausen"), _T("Pirna-Pratzschwitz"),
+  _T("Quakenbrueck"), _T("Reinsdorf"), _T("St. Auban"), _T("Tannheim"),
+  _T("Unterwoessen"), _T("Vinon"), _T("Wasserkuppe"), _T("Zell am See"),
+};
+
+class LabelWindow final : public PaintWindow {
+  UI::SingleWindow &main_window;
+
+  std::vector<duration<double>> frame_times;
+
+public:
+  explicit LabelWindow(UI::SingleWindow &_main_window) noexcept
+    :main_window(_main_window) {
+    frame_times.reserve(N_FRAMES);
+  }
+
+  void PrintStatistics() noexcept {
+    if (frame_times.empty())
+      return;
+
+    std::sort(frame_times.begin(), frame_times.end());
+
+    duration<double> total{};
+    for (const auto &i : frame_times)
+      total += i;
+
+    printf("frames=%u labels/frame=%u mean=%.3fms median=%.3fms"
+           " min=%.3fms max=%.3fms\n",
+           (unsigned)frame_times.size(), N_LABELS,
+           total.count() * 1000 / frame_times.size(),
+           frame_times[frame_times.size() / 2].count() * 1000,
+           frame_times.front().count() * 1000,
+           frame_times.back().count() * 1000);
+  }
+
+private:
+  void PaintLabels(Canvas &canvas) noexcept {
+    const PixelSize size = canvas.GetSize();
+    const unsigned frame = frame_times.size();
+
+    canvas.SetTextColor(COLOR_BLACK);
+    canvas.SetBackgroundColor(COLOR_WHITE);
+
+    for (unsigned i = 0; i < N_LABELS; ++i) {
+      const PixelPoint p(((i * 97) + frame * 3) % size.width,
+                         ((i * 61) + frame) % size.height);
+
+      const TCHAR *name = waypoint_names[i % ARRAY_SIZE(waypoint_names)];
+
+      /* the arrival altitude changes with each frame, just like on
+         the map */
+      TCHAR buffer[64];
+      _stprintf(buffer, _T("%s:%u"), name, (i * 37 + frame) % 2000);
+
+      switch (i % 4) {
+      case 0:
+        canvas.Select(bold_font);
+        canvas.SetBackgroundOpaque();
+        canvas.DrawText(p, buffer);
+        break;
+
+      case 1:
+        canvas.Select(normal_font);
+        canvas.SetBackgroundTransparent();
+        canvas.DrawText(p, buffer);
+        break;
+
+      case 2:
+        canvas.Select(normal_font);
+        canvas.SetBackgroundTransparent();
+        canvas.DrawText(p, name);
+        break;
+
+      case 3:
+        canvas.Select(normal_font);
+        canvas.SetBackgroundOpaque();
+        canvas.DrawClippedText(p, 60, buffer);
+        break;
+      }
+    }
+  }
+
+protected:
+  void OnPaint(Canvas &canvas) noexcept override {
+    canvas.ClearWhite();
+
+    const auto start = steady_clock::now();
+    PaintLabels(canvas);
+    frame_times.push_back(steady_clock::now() - start);
+
+    if (frame_times.size() >= N_FRAMES)
+      main_window.PostQuit();
+  }
+};
+
+static void
+Main(TestMainWindow &main_window)
+{
+  LabelWindow window(main_window);
+  window.Create(main_window, main_window.GetClientRect());
+  main_window.SetFullWindow(window);
+
+  /* paint a new frame as soon as the event loop is idle */
+  UI::PeriodicTimer timer([&window]{ window.Invalidate(); });
+  timer.Schedule(milliseconds(1));
+
+  main_window.RunEventLoop();
+
+  window.PrintStatistics();
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Synthesise vario sound for a simulated climb and sink sequence and
+ * mix it with a second tone, the way the PCMMixer does during
+ * playback, and report the CPU time per second of audio.
+ *
+ * Usage: BenchmarkVario [SAMPLE_RATE] [BLOCK_SIZE]
+ */
+
+#include "Audio/VarioSynthesiser.hpp"
+#include "Audio/PCMMixerDataSource.hpp"
+#include "util/NumberParser.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std::chrono;
+
+/**
+ * The duration of the simulated audio [s].
+ */
+static constexpr unsigned DURATION = 600;
+
+/**
+ * @return the CPU time per second of audio [µs]
+ */
+template<typename F>
+static double
+Measure(unsigned sample_rate, unsigned block_size, F &&f)
+{
+  std::vector<int16_t> buffer(block_size);
+  const unsigned n_blocks = DURATION * sample_rate / block_size;
+  const unsigned blocks_per_second = sample_rate / block_size;
+
+  const auto start = steady_clock::now();
+
+  for (unsigned i = 0; i < n_blocks; ++i) {
+    if (i % blocks_per_second == 0)
+      /* a new vario value once per second, between -4 and +4 m/s */
+      f.SetVario(((i / blocks_per_second) * 7 % 81) / 10. - 4);
+
+    f.Fill(buffer.data(), block_size);
+  }
+
+  const duration<double, std::micro> elapsed = steady_clock::now() - start;
+  return elapsed.count() / DURATION;
+}
+
+struct VarioOnly {
+  VarioSynthesiser vario;
+
+  explicit VarioOnly(unsigned sample_rate):vario(sample_rate) {}
+
+  void SetVario(double v) {
+    vario.SetVario(v);
+  }
+
+  void Fill(int16_t *buffer, size_t n) {
+    vario.Synthesise(buffer, n);
+  }
+};
+
+struct VarioMixed {
+  VarioSynthesiser vario;
+  ToneSynthesiser tone;
+  PCMMixerDataSource mixer;
+
+  explicit VarioMixed(unsigned sample_rate)
+    :vario(sample_rate), tone(sample_rate), mixer(sample_rate)
+  {
+    tone.SetTone(440);
+    mixer.SetVolume(80);
+    mixer.AddSource(vario);
+    mixer.AddSource(tone);
+  }
+
+  void SetVario(double v) {
+    vario.SetVario(v);
+  }
+
+  void Fill(int16_t *buffer, size_t n) {
+    mixer.GetData(buffer, n);
+  }
+};
+
+int
+main(int argc, char **argv)
+{
+  unsigned sample_rate = 48000, block_size = 256;
+  if (argc > 1)
+    sample_rate = ParseUnsigned(argv[1]);
+  if (argc > 2)
+    block_size = ParseUnsigned(argv[2]);
+
+  if (sample_rate < 8000 || block_size == 0 || block_size > sample_rate) {
+    fprintf(stderr, "Usage: %s [SAMPLE_RATE] [BLOCK_SIZE]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  VarioOnly vario_only(sample_rate);
+  printf("vario:        %.1f µs CPU per second of audio\n",
+         Measure(sample_rate, block_size, vario_only));
+
+  VarioMixed vario_mixed(sample_rate);
+  printf("vario+mixer:  %.1f µs CPU per second of audio\n",
+         Measure(sample_rate, block_size, vario_mixed));
+
+  return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
 #include "system/FileUtil.hpp"
 #include "Contest/ContestManager.hpp"
 #include "Trace/Trace.hpp"
+#include "Trace/Vector.hpp"
 
 #include <fstream>
 
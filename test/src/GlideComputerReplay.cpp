@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "GlideComputerReplay.hpp"
+#include "DebugReplay.hpp"
+#include "Task/LoadFile.hpp"
+#include "Engine/Task/Ordered/OrderedTask.hpp"
+#include "Airspace/AirspaceParser.hpp"
+#include "Terrain/RasterTerrain.hpp"
+#include "Waypoint/WaypointReader.hpp"
+#include "Waypoint/Factory.hpp"
+#include "Operation/Operation.hpp"
+#include "io/FileReader.hxx"
+#include "io/BufferedReader.hxx"
+#include "system/Path.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace std::chrono;
+
+/**
+ * Load the terrain tiles around the aircraft at this interval.
+ */
+static constexpr FloatDuration TILES_INTERVAL = seconds{30};
+static constexpr double TILES_RADIUS = 50000;
+
+/**
+ * Run GlideComputer::ProcessIdle() at this interval of replay time;
+ * the CalculationThread uses the same interval of wall-clock time
+ * (see GlideComputer::ProcessGPS()).
+ */
+static constexpr FloatDuration IDLE_INTERVAL = milliseconds{500};
+
+/**
+ * Returns the CPU time consumed by the calling thread.
+ */
+static FloatDuration
+GetThreadCPUTime() noexcept
+{
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    return {};
+
+  /* FILETIME counts 100 nanosecond units */
+  const auto ticks = (uint64_t(kernel.dwHighDateTime) << 32) +
+    kernel.dwLowDateTime +
+    (uint64_t(user.dwHighDateTime) << 32) + user.dwLowDateTime;
+  return FloatDuration{ticks / 1e7};
+#else
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+    return {};
+
+  return FloatDuration{ts.tv_sec + ts.tv_nsec / 1e9};
+#endif
+}
+
+/**
+ * Adds the CPU time of the calling thread during its lifetime to a
+ * #FloatDuration.
+ */
+class ScopeCPUTime {
+  FloatDuration &total;
+  const FloatDuration start = GetThreadCPUTime();
+
+public:
+  explicit ScopeCPUTime(FloatDuration &_total) noexcept
+    :total(_total) {}
+
+  ~ScopeCPUTime() noexcept {
+    total += GetThreadCPUTime() - start;
+  }
+
+  ScopeCPUTime(const ScopeCPUTime &) = delete;
+  ScopeCPUTime &operator=(const ScopeCPUTime &) = delete;
+};
+
+static ComputerSettings
+MakeSettings() noexcept
+{
+  ComputerSettings settings;
+  settings.SetDefaults();
+  settings.polar.glide_polar_task = GlidePolar(1);
+
+  /* the stage budgets are compared with wall-clock durations, and
+     deferring stages would make the results depend on the speed of
+     the host */
+  settings.stage_budget.budget_ms.fill(0);
+
+  return settings;
+}
+
+GlideComputerReplay::GlideComputerReplay()
+  :settings(MakeSettings()),
+   task_manager(settings.task, waypoints),
+   protected_task_manager(task_manager, settings.task),
+   glide_computer(settings, waypoints, airspaces,
+                  protected_task_manager, task_events)
+{
+  task_manager.SetTaskEvents(task_events);
+  task_manager.SetGlidePolar(settings.polar.glide_polar_task);
+
+  glide_computer.ReadComputerSettings(settings);
+  glide_computer.SetContestIncremental(false);
+  glide_computer.Initialise();
+}
+
+void
+GlideComputerReplay::SetTerrain(RasterTerrain *_terrain)
+{
+  terrain = _terrain;
+  glide_computer.SetTerrain(terrain);
+}
+
+void
+GlideComputerReplay::LoadWaypoints(Path path)
+{
+  NullOperationEnvironment operation;
+  ReadWaypointFile(path, waypoints,
+                   WaypointFactory(WaypointOrigin::PRIMARY, terrain),
+                   operation);
+  waypoints.Optimise();
+}
+
+void
+GlideComputerReplay::LoadTask(Path path)
+{
+  const auto task = ::LoadTask(path, settings.task, &waypoints);
+  if (!task)
+    throw std::runtime_error("Failed to load the task");
+
+  protected_task_manager.TaskCommit(*task);
+}
+
+void
+GlideComputerReplay::LoadAirspaces(Path path)
+{
+  FileReader file_reader{path};
+  BufferedReader buffered_reader{file_reader};
+  ParseAirspaceFile(airspaces, buffered_reader);
+  airspaces.Optimise();
+
+  if (terrain != nullptr)
+    airspaces.SetGroundLevels(*terrain);
+}
+
+bool
+GlideComputerReplay::Next(DebugReplay &replay)
+{
+  if (!replay.Next())
+    return false;
+
+  const MoreData &basic = replay.Basic();
+
+  const bool gps_updated =
+    basic.location_available.Modified(glide_computer.Basic().location_available);
+
+  glide_computer.ReadBlackboard(basic);
+  glide_computer.ReadComputerSettings(settings);
+  glide_computer.Expire();
+
+  if (terrain != nullptr && basic.location_available &&
+      basic.time_available &&
+      (!tiles_time.IsDefined() || basic.time - tiles_time >= TILES_INTERVAL)) {
+    /* the real program loads the tiles in the draw thread */
+    tiles_time = basic.time;
+    terrain->UpdateTiles(basic.location, TILES_RADIUS);
+  }
+
+  if (gps_updated) {
+    {
+      const ScopeCPUTime cpu{stage_times.gps};
+      /* ignore the return value, which is based on the wall clock */
+      glide_computer.ProcessGPS();
+    }
+
+    if (!basic.time_available || !idle_time.IsDefined() ||
+        basic.time < idle_time || basic.time - idle_time >= IDLE_INTERVAL) {
+      if (basic.time_available)
+        idle_time = basic.time;
+
+      ++n_idle;
+
+      const ScopeCPUTime cpu{stage_times.idle};
+      glide_computer.ProcessIdle();
+    }
+  }
+
+  ++n_fixes;
+
+  if (basic.time_available) {
+    if (!first_time.IsDefined())
+      first_time = basic.time;
+    last_time = basic.time;
+  }
+
+  return true;
+}
+
+void
+GlideComputerReplay::Finish()
+{
+  const ScopeCPUTime cpu{stage_times.exhaustive};
+  glide_computer.ProcessExhaustive();
+}
+
+GlideComputerReplay::Digest
+GlideComputerReplay::MakeDigest() const
+{
+  const MoreData &basic = glide_computer.Basic();
+  const DerivedInfo &calculated = glide_computer.Calculated();
+
+  Digest digest;
+
+  const auto add = [&digest](const char *key, std::string &&value){
+    digest.emplace_back(key, std::move(value));
+  };
+
+  if (basic.location_available)
+    add("location", fmt::format("{:.6f} {:.6f}",
+                                basic.location.latitude.Degrees(),
+                                basic.location.longitude.Degrees()));
+
+  add("altitude", fmt::format("{:.1f}", basic.nav_altitude));
+  add("flying", calculated.flight.flying ? "1" : "0");
+
+  if (calculated.wind_available)
+    add("wind", fmt::format("{:.2f} {:.1f}",
+                            calculated.wind.norm,
+                            calculated.wind.bearing.Degrees()));
+
+  add("trace_points",
+      fmt::format("{}", glide_computer.GetTraceComputer().GetFull().size()));
+  add("contest_score",
+      fmt::format("{:.2f}", calculated.contest_stats.GetResult().score));
+
+  const TaskStats &task_stats = calculated.ordered_task_stats;
+  if (task_stats.task_valid) {
+    add("task_active_point",
+        fmt::format("{}", task_manager.GetActiveTaskPointIndex()));
+    add("task_remaining",
+        fmt::format("{:.0f}", task_stats.total.remaining.GetDistance()));
+  }
+
+  add("airspace_warnings",
+      glide_computer.GetAirspaceWarnings().IsEmpty() ? "0" : "1");
+
+  return digest;
+}
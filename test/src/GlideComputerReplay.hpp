@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#pragma once
+
+#include "Computer/Settings.hpp"
+#include "Computer/GlideComputer.hpp"
+#include "Computer/GlideComputerInterface.hpp"
+#include "Engine/Waypoint/Waypoints.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Engine/Task/TaskManager.hpp"
+#include "Task/ProtectedTaskManager.hpp"
+#include "time/Stamp.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class Path;
+class DebugReplay;
+class RasterTerrain;
+
+/**
+ * Runs a #GlideComputer synchronously on the fixes of a
+ * #DebugReplay, as fast as possible, without the device, calculation
+ * and draw threads of the real program.  Each fix is processed the
+ * same way CalculationThread::Tick() does it, except that
+ * GlideComputer::ProcessIdle() is scheduled by the replay time
+ * instead of the wall clock, so the results do not depend on the
+ * speed of the host.
+ */
+class GlideComputerReplay {
+  ComputerSettings settings;
+
+  Waypoints waypoints;
+  Airspaces airspaces;
+
+  TaskManager task_manager;
+  GlideComputerTaskEvents task_events;
+  ProtectedTaskManager protected_task_manager;
+
+  GlideComputer glide_computer;
+
+  RasterTerrain *terrain = nullptr;
+
+  /**
+   * The number of fixes passed to Next().
+   */
+  unsigned long n_fixes = 0;
+
+  /**
+   * The number of GlideComputer::ProcessIdle() calls.
+   */
+  unsigned long n_idle = 0;
+
+  /**
+   * The time stamps of the first and of the most recent fix.
+   */
+  TimeStamp first_time = TimeStamp::Undefined(), last_time;
+
+  /**
+   * The time stamp of the last RasterTerrain::UpdateTiles() call.
+   */
+  TimeStamp tiles_time = TimeStamp::Undefined();
+
+  /**
+   * The time stamp of the last GlideComputer::ProcessIdle() call.
+   */
+  TimeStamp idle_time = TimeStamp::Undefined();
+
+public:
+  /**
+   * The CPU time of the calling thread spent in the stages of the
+   * #GlideComputer.
+   */
+  struct StageTimes {
+    FloatDuration gps{}, idle{}, exhaustive{};
+  };
+
+private:
+  StageTimes stage_times;
+
+public:
+  GlideComputerReplay();
+
+  /**
+   * Use the given terrain for the calculations and for the files
+   * loaded afterwards.  The terrain may be shared by several
+   * instances running in different threads.
+   */
+  void SetTerrain(RasterTerrain *_terrain);
+
+  /**
+   * Load a waypoint file.  Call this before LoadTask() if the task
+   * refers to these waypoints.  Throws on error.
+   */
+  void LoadWaypoints(Path path);
+
+  /**
+   * Load a task file and make it the active task.  Throws on error.
+   */
+  void LoadTask(Path path);
+
+  /**
+   * Load an airspace file.  Throws on error.
+   */
+  void LoadAirspaces(Path path);
+
+  /**
+   * Read the next fix from the replay and feed it to the
+   * #GlideComputer.
+   *
+   * @return false if the replay has ended
+   */
+  bool Next(DebugReplay &replay);
+
+  /**
+   * Run the calculations which are usually skipped when the
+   * calculation thread is busy.  Call this after the last fix.
+   */
+  void Finish();
+
+  unsigned long GetFixCount() const noexcept {
+    return n_fixes;
+  }
+
+  unsigned long GetIdleCount() const noexcept {
+    return n_idle;
+  }
+
+  /**
+   * The flight time covered by the fixes processed so far.
+   */
+  FloatDuration GetReplayedDuration() const noexcept {
+    return first_time.IsDefined()
+      ? last_time - first_time
+      : FloatDuration{};
+  }
+
+  const StageTimes &GetStageTimes() const noexcept {
+    return stage_times;
+  }
+
+  const GlideComputer &GetGlideComputer() const noexcept {
+    return glide_computer;
+  }
+
+  const TaskManager &GetTaskManager() const noexcept {
+    return task_manager;
+  }
+
+  using Digest = std::vector<std::pair<std::string, std::string>>;
+
+  /**
+   * Describe the state of the computer (position, wind, trace,
+   * contest, task and airspace warnings) as a list of key/value
+   * pairs.  Two replays of the same input produce the same digest
+   * after the same number of fixes.
+   */
+  Digest MakeDigest() const;
+};
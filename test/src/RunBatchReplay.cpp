@@ -0,0 +1,396 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Replay a batch of flights through the full GlideComputer pipeline,
+ * one flight per job on a thread pool, and print per-flight metrics
+ * (CPU time of each computer stage, heap allocations) and the final
+ * results as JSON.  This is meant to be run on a fixed set of flights
+ * to catch performance regressions.
+ *
+ * Each argument is an IGC or NMEA file or a directory which is
+ * searched for such files.  NMEA files are parsed with the driver
+ * given with --driver.
+ */
+
+#include "GlideComputerReplay.hpp"
+#include "DebugReplayIGC.hpp"
+#include "DebugReplayNMEA.hpp"
+#include "Terrain/RasterTerrain.hpp"
+#include "Operation/Operation.hpp"
+#include "system/Args.hpp"
+#include "system/FileUtil.hpp"
+#include "system/Path.hpp"
+#include "thread/WorkStealingPool.hpp"
+#include "io/StdioOutputStream.hxx"
+#include "json/Serialize.hxx"
+#include "util/StringCompare.hxx"
+#include "util/Exception.hxx"
+#include "util/PrintException.hxx"
+
+#include <boost/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+/* fake symbols: */
+
+#include "Input/InputQueue.hpp"
+#include "Logger/Logger.hpp"
+
+bool InputEvents::processGlideComputer(unsigned) { return false; }
+
+void Logger::LogStartEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogFinishEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogPoint([[maybe_unused]] const NMEAInfo &gps_info) {}
+
+/* done with fake symbols. */
+
+using namespace std::chrono;
+
+/* count the heap allocations of each thread, so they can be
+   attributed to the flight replayed by that thread */
+
+static thread_local std::size_t n_allocations, allocated_bytes;
+
+void *
+operator new(std::size_t size)
+{
+  ++n_allocations;
+  allocated_bytes += size;
+
+  void *p = malloc(size > 0 ? size : 1);
+  if (p == nullptr)
+    throw std::bad_alloc();
+
+  return p;
+}
+
+void
+operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+  free(p);
+}
+
+struct Inputs {
+  const char *task = nullptr, *airspace = nullptr, *waypoints = nullptr;
+  RasterTerrain *terrain = nullptr;
+  const char *driver = "Generic";
+};
+
+/**
+ * The outcome of one flight.  The JSON is built by the job, so the
+ * #GlideComputer can be freed before the next flight starts.
+ */
+struct FlightResult {
+  boost::json::object json;
+  double replayed = 0;
+  bool failed = false;
+};
+
+class FlightCollector final : public File::Visitor {
+  std::vector<AllocatedPath> &paths;
+
+public:
+  explicit FlightCollector(std::vector<AllocatedPath> &_paths) noexcept
+    :paths(_paths) {}
+
+  void Visit(Path path, [[maybe_unused]] Path filename) override {
+    paths.emplace_back(path);
+  }
+};
+
+static void
+AddFlights(std::vector<AllocatedPath> &paths, Path path)
+{
+  if (!Directory::Exists(path)) {
+    paths.emplace_back(path);
+    return;
+  }
+
+  std::vector<AllocatedPath> found;
+  FlightCollector collector(found);
+  Directory::VisitSpecificFiles(path, _T("*.igc"), collector, true);
+  Directory::VisitSpecificFiles(path, _T("*.nmea"), collector, true);
+
+  std::sort(found.begin(), found.end(),
+            [](const AllocatedPath &a, const AllocatedPath &b){
+              return StringCollate(a.c_str(), b.c_str()) < 0;
+            });
+
+  for (auto &i : found)
+    paths.emplace_back(std::move(i));
+}
+
+static std::unique_ptr<DebugReplay>
+OpenFlight(Path path, const Inputs &inputs)
+{
+  std::unique_ptr<DebugReplay> replay{
+    path.EndsWithIgnoreCase(_T(".igc"))
+    ? DebugReplayIGC::Create(path)
+    : DebugReplayNMEA::Create(path, inputs.driver)
+  };
+
+  if (!replay)
+    throw std::runtime_error("Failed to open the flight");
+
+  return replay;
+}
+
+static boost::json::object
+WriteStageTimes(const GlideComputerReplay::StageTimes &times) noexcept
+{
+  boost::json::object object;
+  object.emplace("gps", times.gps.count());
+  object.emplace("idle", times.idle.count());
+  object.emplace("exhaustive", times.exhaustive.count());
+  return object;
+}
+
+static boost::json::object
+WriteStageTiming(const StageTimingInfo &timing) noexcept
+{
+  boost::json::object object;
+  for (std::size_t i = 0; i < NUM_COMPUTER_STAGES; ++i) {
+    const ComputerStage stage = ComputerStage(i);
+    const StageTiming &t = timing[stage];
+    object.emplace(GetComputerStageName(stage), boost::json::object{
+        {"count", t.count},
+        {"mean", t.mean},
+        {"max", t.max},
+        {"over_budget", t.over_budget},
+        {"deferred", t.deferred},
+      });
+  }
+
+  return object;
+}
+
+static boost::json::object
+WriteResults(const GlideComputerReplay &replay) noexcept
+{
+  const GlideComputer &glide_computer = replay.GetGlideComputer();
+  const DerivedInfo &calculated = glide_computer.Calculated();
+
+  boost::json::object object;
+
+  object.emplace("trace_points",
+                 glide_computer.GetTraceComputer().GetFull().size());
+
+  const ContestResult &contest = calculated.contest_stats.GetResult();
+  object.emplace("contest", boost::json::object{
+      {"score", contest.score},
+      {"distance", contest.distance},
+      {"duration", contest.time.count()},
+    });
+
+  if (calculated.wind_available)
+    object.emplace("wind", boost::json::object{
+        {"speed", calculated.wind.norm},
+        {"direction", calculated.wind.bearing.Degrees()},
+      });
+
+  const TaskStats &task_stats = calculated.ordered_task_stats;
+  if (task_stats.task_valid)
+    object.emplace("task", boost::json::object{
+        {"active_point", replay.GetTaskManager().GetActiveTaskPointIndex()},
+        {"remaining", task_stats.total.remaining.GetDistance()},
+        {"finished", task_stats.task_finished},
+      });
+
+  object.emplace("airspace_warnings",
+                 !glide_computer.GetAirspaceWarnings().IsEmpty());
+
+  return object;
+}
+
+static FlightResult
+RunFlight(Path path, const Inputs &inputs)
+{
+  GlideComputerReplay replay;
+  replay.SetTerrain(inputs.terrain);
+
+  if (inputs.waypoints != nullptr)
+    replay.LoadWaypoints(Path(inputs.waypoints));
+
+  if (inputs.task != nullptr)
+    replay.LoadTask(Path(inputs.task));
+
+  if (inputs.airspace != nullptr)
+    replay.LoadAirspaces(Path(inputs.airspace));
+
+  const auto input = OpenFlight(path, inputs);
+
+  /* count only the allocations of the calculations, not those of
+     loading the input files */
+  const std::size_t allocations_before = n_allocations;
+  const std::size_t bytes_before = allocated_bytes;
+  const auto start = steady_clock::now();
+
+  while (replay.Next(*input)) {}
+  replay.Finish();
+
+  const duration<double> wall = steady_clock::now() - start;
+  const std::size_t allocations = n_allocations - allocations_before;
+  const std::size_t bytes = allocated_bytes - bytes_before;
+
+  FlightResult result;
+  result.replayed = replay.GetReplayedDuration().count();
+
+  auto &object = result.json;
+  object.emplace("file", path.ToUTF8());
+  object.emplace("fixes", replay.GetFixCount());
+  object.emplace("idle_ticks", replay.GetIdleCount());
+  object.emplace("replayed", result.replayed);
+  object.emplace("wall", wall.count());
+  object.emplace("cpu", WriteStageTimes(replay.GetStageTimes()));
+  object.emplace("stages",
+                 WriteStageTiming(replay.GetGlideComputer().Calculated().stage_timing));
+  object.emplace("allocations", allocations);
+  object.emplace("allocated_bytes", bytes);
+  object.emplace("results", WriteResults(replay));
+
+  return result;
+}
+
+/**
+ * Returns the peak resident set size of this process in kB, or 0 if
+ * unknown.  Memory is shared by all flights, so this cannot be
+ * attributed to a single flight.
+ */
+static long
+GetPeakMemory() noexcept
+{
+#ifdef _WIN32
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+  return usage.ru_maxrss;
+#endif
+}
+
+int
+main(int argc, char **argv)
+try {
+  Args args(argc, argv,
+            "[options] FILE|DIRECTORY...\n"
+            "Options:\n"
+            "  --task=FILE          Load the task from this file\n"
+            "  --airspace=FILE      Load airspaces from this file\n"
+            "  --waypoints=FILE     Load waypoints from this file\n"
+            "  --terrain=FILE       Load terrain from this file\n"
+            "  --driver=NAME        Driver for NMEA files (default = Generic)\n"
+            "  --threads=N          Number of threads (default = number of CPUs)");
+
+  Inputs inputs;
+  const char *terrain_path = nullptr;
+  unsigned n_threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  const char *arg;
+  while ((arg = args.PeekNext()) != nullptr && *arg == '-') {
+    args.Skip();
+
+    const char *value;
+    if ((value = StringAfterPrefix(arg, "--task=")) != nullptr) {
+      inputs.task = value;
+    } else if ((value = StringAfterPrefix(arg, "--airspace=")) != nullptr) {
+      inputs.airspace = value;
+    } else if ((value = StringAfterPrefix(arg, "--waypoints=")) != nullptr) {
+      inputs.waypoints = value;
+    } else if ((value = StringAfterPrefix(arg, "--terrain=")) != nullptr) {
+      terrain_path = value;
+    } else if ((value = StringAfterPrefix(arg, "--driver=")) != nullptr) {
+      inputs.driver = value;
+    } else if ((value = StringAfterPrefix(arg, "--threads=")) != nullptr) {
+      n_threads = strtoul(value, nullptr, 10);
+      if (n_threads == 0) {
+        fputs("The threads parameter could not be parsed correctly.\n", stderr);
+        args.UsageError();
+      }
+    } else {
+      args.UsageError();
+    }
+  }
+
+  std::vector<AllocatedPath> paths;
+  do {
+    AddFlights(paths, args.ExpectNextPath());
+  } while (!args.IsEmpty());
+
+  std::unique_ptr<RasterTerrain> terrain;
+  if (terrain_path != nullptr) {
+    NullOperationEnvironment operation;
+    terrain = RasterTerrain::OpenTerrain(nullptr, Path(terrain_path),
+                                         operation);
+    inputs.terrain = terrain.get();
+  }
+
+  std::vector<FlightResult> results(paths.size());
+
+  WorkStealingPool pool(n_threads);
+
+  const auto start = steady_clock::now();
+  pool.Run(paths.size(), [&paths, &inputs, &results](std::size_t i, unsigned) {
+    try {
+      results[i] = RunFlight(paths[i], inputs);
+    } catch (...) {
+      results[i].failed = true;
+      results[i].json.emplace("file", paths[i].ToUTF8());
+      results[i].json.emplace("error",
+                              GetFullMessage(std::current_exception()));
+    }
+  });
+  const duration<double> wall = steady_clock::now() - start;
+
+  boost::json::array flights;
+  unsigned n_failed = 0;
+  double replayed = 0;
+  for (auto &result : results) {
+    if (result.failed)
+      ++n_failed;
+    replayed += result.replayed;
+
+    flights.emplace_back(std::move(result.json));
+  }
+
+  boost::json::object root;
+  root.emplace("flights", std::move(flights));
+  root.emplace("summary", boost::json::object{
+      {"flights", paths.size()},
+      {"failed", n_failed},
+      {"threads", pool.GetWorkerCount()},
+      {"wall", wall.count()},
+      {"replayed", replayed},
+      {"throughput", wall.count() > 0 ? replayed / wall.count() : 0.},
+      {"peak_memory_kb", GetPeakMemory()},
+    });
+
+  StdioOutputStream os(stdout);
+  Json::Serialize(os, root);
+
+  return n_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+} catch (...) {
+  PrintException(std::current_exception());
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Replay a flight through the GlideComputer as fast as possible,
+ * without the UI and without the real-time pacing of the Replay
+ * class, and report the throughput in replayed seconds per wall
+ * second.
+ *
+ * With --checkpoint, the replay position (the number of fixes) and a
+ * digest of the computer state (position, wind, trace, contest, task,
+ * airspace warnings) are saved to a file.  This is not a snapshot of
+ * the state: --resume replays the flight from its beginning up to
+ * the saved position, verifies the state against the digest, and
+ * continues from there.  Because GlideComputerReplay schedules all
+ * calculations by replay time, the replay is deterministic.
+ */
+
+#include "GlideComputerReplay.hpp"
+#include "DebugReplay.hpp"
+#include "system/Args.hpp"
+#include "system/Path.hpp"
+#include "io/FileLineReader.hpp"
+#include "io/FileOutputStream.hxx"
+#include "io/BufferedOutputStream.hxx"
+#include "io/KeyValueFileReader.hpp"
+#include "io/KeyValueFileWriter.hpp"
+#include "util/StringCompare.hxx"
+#include "util/PrintException.hxx"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* fake symbols: */
+
+#include "Input/InputQueue.hpp"
+#include "Logger/Logger.hpp"
+
+bool InputEvents::processGlideComputer(unsigned) { return false; }
+
+void Logger::LogStartEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogFinishEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogPoint([[maybe_unused]] const NMEAInfo &gps_info) {}
+
+/* done with fake symbols. */
+
+using namespace std::chrono;
+
+static void
+PrintDigest(const GlideComputerReplay::Digest &digest)
+{
+  for (const auto &[key, value] : digest)
+    printf("%s=%s\n", key.c_str(), value.c_str());
+}
+
+static void
+WriteCheckpoint(Path path, const GlideComputerReplay &replay)
+{
+  FileOutputStream file(path);
+  BufferedOutputStream os(file);
+  KeyValueFileWriter writer(os);
+
+  writer.Write("fixes", std::to_string(replay.GetFixCount()).c_str());
+  for (const auto &[key, value] : replay.MakeDigest())
+    writer.Write(key.c_str(), value.c_str());
+
+  os.Flush();
+  file.Commit();
+}
+
+static std::map<std::string, std::string>
+ReadCheckpoint(Path path)
+{
+  FileLineReaderA file(path);
+  KeyValueFileReader reader(file);
+
+  std::map<std::string, std::string> result;
+  KeyValuePair pair;
+  while (reader.Read(pair))
+    result.emplace(pair.key, pair.value);
+
+  return result;
+}
+
+/**
+ * Replay from the beginning up to the position saved in the
+ * checkpoint and compare the state with its digest.
+ *
+ * @return false if the replay ended early or the state differs
+ */
+static bool
+Resume(GlideComputerReplay &replay, DebugReplay &input, Path path)
+{
+  auto checkpoint = ReadCheckpoint(path);
+
+  const auto fixes = checkpoint.find("fixes");
+  if (fixes == checkpoint.end()) {
+    fputs("No replay position in checkpoint\n", stderr);
+    return false;
+  }
+
+  const unsigned long n_fixes = strtoul(fixes->second.c_str(), nullptr, 10);
+  checkpoint.erase(fixes);
+
+  while (replay.GetFixCount() < n_fixes)
+    if (!replay.Next(input)) {
+      fprintf(stderr, "Replay ended after %lu of %lu fixes\n",
+              replay.GetFixCount(), n_fixes);
+      return false;
+    }
+
+  bool match = true;
+  for (const auto &[key, value] : replay.MakeDigest()) {
+    const auto i = checkpoint.find(key);
+    if (i == checkpoint.end()) {
+      fprintf(stderr, "Checkpoint lacks %s=%s\n", key.c_str(), value.c_str());
+      match = false;
+    } else {
+      if (i->second != value) {
+        fprintf(stderr, "Checkpoint mismatch: %s=%s, expected %s\n",
+                key.c_str(), value.c_str(), i->second.c_str());
+        match = false;
+      }
+
+      checkpoint.erase(i);
+    }
+  }
+
+  for (const auto &[key, value] : checkpoint) {
+    fprintf(stderr, "Checkpoint mismatch: %s missing, expected %s\n",
+            key.c_str(), value.c_str());
+    match = false;
+  }
+
+  return match;
+}
+
+int
+main(int argc, char **argv)
+try {
+  Args args(argc, argv,
+            "[options] DRIVER FILE\n"
+            "Options:\n"
+            "  --task=FILE          Load the task from this file\n"
+            "  --airspace=FILE      Load airspaces from this file\n"
+            "  --stop=SECONDS       Stop after this much flight time\n"
+            "  --checkpoint=FILE    Save the position and a digest at the end\n"
+            "  --resume=FILE        Replay to a checkpoint, verify, continue");
+
+  const char *task_path = nullptr, *airspace_path = nullptr;
+  const char *checkpoint_path = nullptr, *resume_path = nullptr;
+  FloatDuration stop{-1};
+
+  const char *arg;
+  while ((arg = args.PeekNext()) != nullptr && *arg == '-') {
+    args.Skip();
+
+    const char *value;
+    if ((value = StringAfterPrefix(arg, "--task=")) != nullptr) {
+      task_path = value;
+    } else if ((value = StringAfterPrefix(arg, "--airspace=")) != nullptr) {
+      airspace_path = value;
+    } else if ((value = StringAfterPrefix(arg, "--stop=")) != nullptr) {
+      char *endptr;
+      stop = FloatDuration{strtod(value, &endptr)};
+      if (endptr == value || *endptr != 0 || stop.count() < 0) {
+        fputs("The stop parameter could not be parsed correctly.\n", stderr);
+        args.UsageError();
+      }
+    } else if ((value = StringAfterPrefix(arg, "--checkpoint=")) != nullptr) {
+      checkpoint_path = value;
+    } else if ((value = StringAfterPrefix(arg, "--resume=")) != nullptr) {
+      resume_path = value;
+    } else {
+      args.UsageError();
+    }
+  }
+
+  std::unique_ptr<DebugReplay> input{CreateDebugReplay(args)};
+  if (!input)
+    return EXIT_FAILURE;
+
+  args.ExpectEnd();
+
+  GlideComputerReplay replay;
+
+  if (task_path != nullptr)
+    replay.LoadTask(Path(task_path));
+
+  if (airspace_path != nullptr)
+    replay.LoadAirspaces(Path(airspace_path));
+
+  const auto start_time = steady_clock::now();
+
+  if (resume_path != nullptr &&
+      !Resume(replay, *input, Path(resume_path)))
+    return EXIT_FAILURE;
+
+  const auto resume_time = steady_clock::now();
+  const auto resume_fixes = replay.GetFixCount();
+
+  while ((stop.count() < 0 || replay.GetReplayedDuration() < stop) &&
+         replay.Next(*input)) {}
+
+  if (stop.count() < 0)
+    replay.Finish();
+
+  const duration<double> wall = steady_clock::now() - start_time;
+
+  if (checkpoint_path != nullptr)
+    WriteCheckpoint(Path(checkpoint_path), replay);
+
+  PrintDigest(replay.MakeDigest());
+
+  if (resume_path != nullptr)
+    printf("fast_forward fixes=%lu wall=%.3fs\n", resume_fixes,
+           duration<double>(resume_time - start_time).count());
+
+  const double replayed = replay.GetReplayedDuration().count();
+  printf("fixes=%lu replayed=%.0fs wall=%.3fs throughput=%.0f\n",
+         replay.GetFixCount(), replayed, wall.count(),
+         wall.count() > 0 ? replayed / wall.count() : 0.);
+
+  return EXIT_SUCCESS;
+} catch (...) {
+  PrintException(std::current_exception());
+  return EXIT_FAILURE;
+}
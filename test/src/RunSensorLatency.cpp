@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+/*
+ * Replay NMEA sentences from a file at a fixed rate through a device
+ * driver into a #SensorStreams instance (like DeviceDescriptor does),
+ * while a second thread drains it at the calculation thread's period
+ * (like CalculationThread does).  Reports how many samples reach the
+ * consumer, compared to how many updates the blackboard copy alone
+ * would show, and the latency from reception to consumption.
+ *
+ * Usage: RunSensorLatency DRIVER FILE [RATE_HZ [PERIOD_MS]]
+ */
+
+#include "NMEA/Info.hpp"
+#include "NMEA/SensorStreams.hpp"
+#include "Device/Port/NullPort.hpp"
+#include "Device/Driver.hpp"
+#include "Device/Register.hpp"
+#include "Device/Parser.hpp"
+#include "Device/Config.hpp"
+#include "system/Args.hpp"
+#include "thread/Mutex.hxx"
+#include "util/StringStrip.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace std::chrono;
+
+static TimeStamp
+Now() noexcept
+{
+  return TimeStamp{steady_clock::now().time_since_epoch()};
+}
+
+struct ConsumerResult {
+  std::vector<double> latencies_ms;
+  unsigned long n_attitude = 0, n_acceleration = 0, n_vario = 0;
+
+  /**
+   * The number of periods in which the blackboard showed a new
+   * attitude; this is all the calculation thread saw before.
+   */
+  unsigned long n_blackboard_updates = 0;
+
+  void Add(TimeStamp now, TimeStamp time) noexcept {
+    latencies_ms.push_back(duration<double, std::milli>(now - time).count());
+  }
+};
+
+static double
+Percentile(const std::vector<double> &sorted, double p) noexcept
+{
+  return sorted[std::min<std::size_t>(sorted.size() * p, sorted.size() - 1)];
+}
+
+int
+main(int argc, char **argv)
+{
+  Args args(argc, argv, "DRIVER FILE [RATE_HZ [PERIOD_MS]]");
+  tstring driver_name = args.ExpectNextT();
+  const char *path = args.ExpectNext();
+  const double rate = args.IsEmpty() ? 50 : atof(args.ExpectNext());
+  const milliseconds period{args.IsEmpty() ? 450 : atoi(args.ExpectNext())};
+  args.ExpectEnd();
+
+  if (rate <= 0 || period.count() <= 0) {
+    fprintf(stderr, "Invalid rate or period\n");
+    return EXIT_FAILURE;
+  }
+
+  const DeviceRegister *driver = FindDriverByName(driver_name.c_str());
+  if (driver == nullptr) {
+    _ftprintf(stderr, _T("No such driver: %s\n"), driver_name.c_str());
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> lines;
+  {
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+      fprintf(stderr, "Failed to open %s\n", path);
+      return EXIT_FAILURE;
+    }
+
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+      StripRight(buffer);
+      if (*buffer != 0)
+        lines.emplace_back(buffer);
+    }
+
+    fclose(file);
+  }
+
+  DeviceConfig config;
+  config.Clear();
+
+  NullPort port;
+  Device *device = driver->CreateOnPort != nullptr
+    ? driver->CreateOnPort(config, port)
+    : nullptr;
+
+  NMEAParser parser;
+
+  /* "mutex" and "info" play the role of the DeviceBlackboard */
+  Mutex mutex;
+  NMEAInfo info;
+  info.Reset();
+
+  SensorStreams streams;
+  std::atomic<bool> done{false};
+
+  std::thread producer([&]{
+    const auto start = steady_clock::now();
+    const duration<double> interval{1. / rate};
+
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+      std::this_thread::sleep_until(start +
+                                    duration_cast<steady_clock::duration>(interval * i));
+
+      const std::lock_guard lock{mutex};
+      info.UpdateClock();
+      streams.BeginCapture(info);
+      if (device == nullptr || !device->ParseNMEA(lines[i].c_str(), info))
+        parser.ParseLine(lines[i].c_str(), info);
+      streams.EndCapture(info);
+    }
+
+    done = true;
+  });
+
+  ConsumerResult result;
+  SensorSampleBatch batch;
+  Validity last_attitude;
+  last_attitude.Clear();
+
+  bool finished;
+  do {
+    finished = done;
+    if (!finished)
+      std::this_thread::sleep_for(period);
+
+    batch.Clear();
+
+    {
+      const std::lock_guard lock{mutex};
+      if (info.attitude.heading_available.Modified(last_attitude) ||
+          info.attitude.bank_angle_available.Modified(last_attitude)) {
+        last_attitude = std::max(info.attitude.heading_available,
+                                 info.attitude.bank_angle_available);
+        ++result.n_blackboard_updates;
+      }
+    }
+
+    streams.ConsumeAttitude(&batch.attitude);
+    streams.ConsumeAcceleration(&batch.acceleration);
+    streams.ConsumeVario(&batch.vario);
+
+    const TimeStamp now = Now();
+    for (const auto &i : batch.attitude)
+      result.Add(now, i.time);
+    for (const auto &i : batch.acceleration)
+      result.Add(now, i.time);
+    for (const auto &i : batch.vario)
+      result.Add(now, i.time);
+
+    result.n_attitude += batch.attitude.size();
+    result.n_acceleration += batch.acceleration.size();
+    result.n_vario += batch.vario.size();
+  } while (!finished);
+
+  producer.join();
+  delete device;
+
+  printf("lines=%zu rate=%.0fHz period=%ldms\n",
+         lines.size(), rate, (long)period.count());
+  printf("samples: attitude=%lu acceleration=%lu vario=%lu dropped=%u\n",
+         result.n_attitude, result.n_acceleration, result.n_vario,
+         streams.GetDropped());
+  printf("attitude updates visible through the blackboard only: %lu\n",
+         result.n_blackboard_updates);
+
+  auto &l = result.latencies_ms;
+  if (!l.empty()) {
+    std::sort(l.begin(), l.end());
+
+    double sum = 0;
+    for (double i : l)
+      sum += i;
+
+    printf("latency: mean=%.1fms p50=%.1fms p99=%.1fms max=%.1fms\n",
+           sum / l.size(), Percentile(l, 0.5), Percentile(l, 0.99),
+           l.back());
+  }
+
+  return EXIT_SUCCESS;
+}
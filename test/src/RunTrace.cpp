@@ -1,9 +1,24 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 // Copyright The XCSoar Project
 
+/*
+ * Replay a flight into a #Trace and report the cost of appending
+ * points, of thinning and of obtaining a snapshot of the trace after
+ * each append (as a copy and as a span), like the contest solvers
+ * and the trail renderer do.
+ */
+
 #include "system/Args.hpp"
 #include "DebugReplay.hpp"
 #include "Engine/Trace/Trace.hpp"
+#include "Engine/Trace/Vector.hpp"
+
+#include <cassert>
+#include <chrono>
+
+#include <stdio.h>
+
+using namespace std::chrono;
 
 int main(int argc, char **argv)
 {
@@ -15,13 +30,59 @@ int main(int argc, char **argv)
   args.ExpectEnd();
 
   Trace trace;
+  TracePointVector copy;
+
+  unsigned n_appends = 0, n_thins = 0;
+  duration<double> append_time{}, thin_time{}, copy_time{}, span_time{};
 
   while (replay->Next()) {
     const MoreData &basic = replay->Basic();
-    if (basic.time_available && basic.location_available &&
-        basic.NavAltitudeAvailable())
-      trace.push_back(TracePoint(basic));
+    if (!basic.time_available || !basic.location_available ||
+        !basic.NavAltitudeAvailable())
+      continue;
+
+    const Serial modify_serial = trace.GetModifySerial();
+
+    auto start = steady_clock::now();
+    trace.push_back(TracePoint(basic));
+    auto end = steady_clock::now();
+
+    if (trace.GetModifySerial() != modify_serial) {
+      ++n_thins;
+      thin_time += end - start;
+    } else {
+      ++n_appends;
+      append_time += end - start;
+    }
+
+    if (trace.empty())
+      continue;
+
+    start = steady_clock::now();
+    trace.GetPoints(copy);
+    end = steady_clock::now();
+    copy_time += end - start;
+
+    start = steady_clock::now();
+    const auto span = trace.GetPoints();
+    end = steady_clock::now();
+    span_time += end - start;
+    assert(span.size() == copy.size());
   }
 
   delete replay;
+
+  const unsigned n = n_appends + n_thins;
+  if (n == 0) {
+    fprintf(stderr, "No fixes\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("points=%u appends=%u thins=%u\n",
+         trace.size(), n_appends, n_thins);
+  printf("append: %.0f ns\n", append_time.count() * 1e9 / n_appends);
+  if (n_thins > 0)
+    printf("thin: %.1f us\n", thin_time.count() * 1e6 / n_thins);
+  printf("snapshot copy: %.0f ns\n", copy_time.count() * 1e9 / n);
+  printf("snapshot span: %.0f ns\n", span_time.count() * 1e9 / n);
 }
@@ -45,6 +45,7 @@ MakeWaypointPtr(Args&&... args) noexcept
 static const auto wp1 = MakeWaypointPtr(0, 45, 50);
 static const auto wp2 = MakeWaypointPtr(0, 45.3, 50);
 static const auto wp3 = MakeWaypointPtr(0, 46, 50);
+static const auto wp4 = MakeWaypointPtr(0.4, 45.6, 50);
 
 static void
 TestAATPoint()
@@ -120,15 +121,106 @@ TestAATPoint()
   }
 }
 
+static constexpr AircraftState
+MakeAircraft(double longitude, double latitude, double altitude) noexcept
+{
+  AircraftState aircraft;
+  aircraft.Reset();
+  aircraft.location = MakeGeoPoint(longitude, latitude);
+  aircraft.altitude = altitude;
+  aircraft.wind = {Angle::Degrees(90), 15};
+  return aircraft;
+}
+
+static FloatDuration
+GetTimeRemaining(OrderedTask &task, const AircraftState &aircraft,
+                 const GlidePolar &polar) noexcept
+{
+  task.Update(aircraft, aircraft, polar);
+  return task.GetStats().total.time_remaining_now;
+}
+
+static void
+TestOptimiseTargets()
+{
+  OrderedTaskSettings settings = ordered_task_settings;
+  settings.aat_min_time = std::chrono::minutes{80};
+
+  OrderedTask task(task_behaviour);
+  task.SetOrderedTaskSettings(settings);
+  task.Append(StartPoint(std::make_unique<CylinderZone>(wp1->location, 500),
+                         WaypointPtr(wp1),
+                         task_behaviour,
+                         ordered_task_settings.start_constraints));
+  task.Append(AATPoint(std::make_unique<CylinderZone>(wp2->location, 10000),
+                       WaypointPtr(wp2),
+                       task_behaviour));
+  task.Append(AATPoint(std::make_unique<CylinderZone>(wp4->location, 10000),
+                       WaypointPtr(wp4),
+                       task_behaviour));
+  task.Append(FinishPoint(std::make_unique<CylinderZone>(wp3->location, 500),
+                          WaypointPtr(wp3),
+                          task_behaviour,
+                          ordered_task_settings.finish_constraints));
+  task.SetActiveTaskPoint(1);
+  task.UpdateGeometry();
+  ok1(!IsError(task.CheckTask()));
+
+  GlidePolar polar(2);
+  const auto aircraft = MakeAircraft(0.2, 45.1, 1500);
+
+  task.Update(aircraft, aircraft, polar);
+  task.UpdateIdle(aircraft, polar);
+  const auto initial = GetTimeRemaining(task, aircraft, polar);
+
+  /* the optimiser converges within a few sweeps and never makes the
+     plan worse */
+  task.SetBackgroundTargetOptimisation(true);
+  unsigned sweeps = 0;
+  while (task.OptimiseTargets(aircraft, polar) && sweeps < 10)
+    ++sweeps;
+  ok1(sweeps > 0);
+  ok1(sweeps < 10);
+
+  const auto optimised = GetTimeRemaining(task, aircraft, polar);
+  ok1(optimised < initial);
+
+  AATPoint &ap1 = (AATPoint &)task.GetPoint(1);
+  AATPoint &ap2 = (AATPoint &)task.GetPoint(2);
+  ok1(ap1.GetIsolineParameter() >= 0);
+  ok1(ap2.GetIsolineParameter() >= 0);
+
+  /* UpdateIdle() recalculates the ranges, but keeps the targets on
+     the optimised isoline positions */
+  const GeoPoint target1 = ap1.GetTargetLocation();
+  const GeoPoint target2 = ap2.GetTargetLocation();
+  task.UpdateIdle(aircraft, polar);
+  ok1(target1.Distance(ap1.GetTargetLocation()) < 500);
+  ok1(target2.Distance(ap2.GetTargetLocation()) < 500);
+  ok1(GetTimeRemaining(task, aircraft, polar) < initial);
+
+  /* a locked target is not moved */
+  ap1.LockTarget(true);
+  ap1.SetTarget(wp2->location, true);
+  task.OptimiseTargets(aircraft, polar);
+  ok1(equals(ap1.GetTargetLocation(), wp2->location));
+
+  /* a target chosen by the user is not moved back to its optimised
+     isoline position */
+  ap2.SetTarget(RangeAndRadial::Zero(), task.GetTaskProjection());
+  ok1(ap2.GetIsolineParameter() < 0);
+}
+
 static void
 TestAll()
 {
   TestAATPoint();
+  TestOptimiseTargets();
 }
 
 int main()
 {
-  plan_tests(717);
+  plan_tests(717 + 11);
 
   task_behaviour.SetDefaults();
   ordered_task_settings.SetDefaults();
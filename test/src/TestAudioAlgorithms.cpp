@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Audio/AudioAlgorithms.hpp"
+#include "Audio/ToneSynthesiser.hpp"
+#include "TestUtil.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <span>
+
+/**
+ * Fill the buffer with pseudo-random samples, including the extreme
+ * values.
+ */
+static void
+FillRandom(std::span<int16_t> buffer) noexcept
+{
+  unsigned seed = 42;
+  for (auto &i : buffer) {
+    seed = seed * 1103515245 + 12345;
+    i = static_cast<int16_t>(seed >> 16);
+  }
+
+  buffer[0] = -32768;
+  buffer[1] = 32767;
+}
+
+static void
+TestScale()
+{
+  /* an odd size, so the scalar tail of the SIMD loops is used, too */
+  std::array<int16_t, 1027> buffer;
+  FillRandom(buffer);
+
+  const auto original = buffer;
+  const int16_t gain = VolumeToGain(37);
+  ScalePCM(buffer.data(), buffer.size(), gain);
+
+  bool equal = true;
+  for (std::size_t i = 0; i < buffer.size(); ++i)
+    equal &= buffer[i] == ScaleSample(original[i], gain);
+  ok1(equal);
+
+  auto copy = original;
+  LowerVolume(copy.data(), copy.size(), 100);
+  ok1(copy == original);
+
+  LowerVolume(copy.data(), copy.size(), 0);
+  ok1(std::all_of(copy.begin(), copy.end(), [](int16_t i){ return i == 0; }));
+}
+
+static void
+TestMix()
+{
+  std::array<int16_t, 1027> src, dest;
+  FillRandom(src);
+  std::fill(dest.begin(), dest.end(), 30000);
+
+  const int16_t gain = VolumeToGain(80);
+  MixScaledPCM(dest.data(), src.data(), src.size(), gain);
+
+  bool equal = true;
+  for (std::size_t i = 0; i < dest.size(); ++i)
+    equal &= dest[i] == Clip(30000 + ScaleSample(src[i], gain));
+  ok1(equal);
+
+  /* the sum clips instead of wrapping around */
+  ok1(dest[1] == 32767);
+}
+
+static void
+TestToneRamp()
+{
+  constexpr unsigned sample_rate = 48000;
+  ToneSynthesiser tone(sample_rate);
+  tone.SetTone(1000);
+
+  std::array<int16_t, 480> buffer;
+  tone.Synthesise(buffer.data(), buffer.size());
+
+  /* muting ramps the volume down within 5 ms */
+  tone.SetVolume(0);
+  tone.Synthesise(buffer.data(), buffer.size());
+  ok1(std::any_of(buffer.begin(), buffer.begin() + sample_rate / 400,
+                  [](int16_t i){ return std::abs(i) > 1000; }));
+  ok1(std::all_of(buffer.begin() + sample_rate / 200, buffer.end(),
+                  [](int16_t i){ return i == 0; }));
+
+  tone.SetVolume(100);
+  tone.Synthesise(buffer.data(), buffer.size());
+  ok1(*std::max_element(buffer.begin(), buffer.end()) > 30000);
+}
+
+int
+main()
+{
+  plan_tests(8);
+
+  TestScale();
+  TestMix();
+  TestToneRamp();
+
+  return exit_status();
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Computer/ContestThread.hpp"
+#include "Computer/ContestComputer.hpp"
+#include "Computer/TraceComputer.hpp"
+#include "Engine/Contest/Settings.hpp"
+#include "Engine/Contest/ContestStatistics.hpp"
+#include "Geo/GeoVector.hpp"
+#include "TestUtil.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono;
+
+static constexpr unsigned N_ITERATIONS = 3;
+
+/**
+ * A flight along a 30 km triangle with one point every 10 seconds.
+ */
+static void
+MakeFlight(std::vector<TracePoint> &points)
+{
+  GeoPoint location{Angle::Degrees(7), Angle::Degrees(51)};
+  unsigned time = 36000;
+
+  for (unsigned leg = 0; leg < 3; ++leg) {
+    const GeoVector v{300, Angle::Degrees(leg * 120.)};
+    for (unsigned i = 0; i < 33; ++i) {
+      location = v.EndPoint(location);
+      time += 10;
+      points.emplace_back(location, duration<unsigned>{time}, 1000, 0, 0);
+    }
+  }
+}
+
+static bool
+WaitResult(ContestThread &thread, ContestStatistics &stats)
+{
+  for (unsigned i = 0; i < 1000; ++i) {
+    if (thread.GetResult(stats))
+      return true;
+
+    std::this_thread::sleep_for(milliseconds{10});
+  }
+
+  return false;
+}
+
+int
+main()
+{
+  plan_tests(6 + N_ITERATIONS);
+
+  ContestSettings settings;
+  settings.SetDefaults();
+
+  std::vector<TracePoint> points;
+  MakeFlight(points);
+
+  /* the reference: the same points, solved in this thread */
+  TraceComputer trace;
+  ContestComputer contest(trace.GetFull(), trace.GetContest(),
+                          trace.GetSprint());
+  for (const auto &i : points)
+    trace.Append(i, true);
+
+  ContestThread thread;
+  thread.Start();
+
+  for (const auto &i : points)
+    thread.Append(i, true);
+
+  ContestStatistics expected, stats;
+  for (unsigned i = 0; i < N_ITERATIONS; ++i) {
+    contest.Solve(settings, expected);
+    thread.Solve(settings, TracePoint::Invalid());
+    ok1(WaitResult(thread, stats) &&
+        stats.GetResult().score == expected.GetResult().score);
+  }
+
+  ok1(stats.GetResult().IsDefined());
+  ok1(stats.GetResult().distance > 20000);
+
+  /* no result is published twice */
+  ok1(!thread.GetResult(stats));
+
+  /* the exhaustive solution is calculated on the thread's trace */
+  contest.SolveExhaustive(settings, expected);
+  ok1(thread.SolveExhaustive(settings, TracePoint::Invalid(), stats) &&
+      stats.GetResult().score == expected.GetResult().score);
+
+  /* after Reset(), the trace is empty */
+  thread.Reset();
+  thread.Solve(settings, TracePoint::Invalid());
+  ok1(WaitResult(thread, stats));
+  ok1(!stats.GetResult().IsDefined());
+
+  thread.Stop();
+
+  return exit_status();
+}
@@ -4,8 +4,13 @@
 #include "Logger/GRecord.hpp"
 #include "TestUtil.hpp"
 #include "system/Path.hpp"
+#include "io/MemoryReader.hxx"
+#include "io/BufferedLineReader.hpp"
 #include "util/PrintException.hxx"
 
+#include <stdexcept>
+#include <string>
+
 #include <tchar.h>
 #include <stdlib.h>
 
@@ -18,15 +23,79 @@ CheckGRecord(const TCHAR *path)
   ok1(true);
 }
 
+static bool
+VerifyString(std::string_view igc)
+{
+  MemoryReader reader{std::as_bytes(std::span{igc})};
+  BufferedLineReader line_reader{reader};
+
+  GRecord grecord;
+  grecord.Initialize();
+
+  try {
+    grecord.Verify(line_reader);
+    return true;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+/**
+ * Sign a file record by record as the logger does, and verify it with
+ * the single-pass verifier.
+ */
+static void
+TestSignVerify()
+{
+  static constexpr const char *records[] = {
+    "AXCSfoo",
+    "HFDTE040910",
+    "HFFTYFRTYPE:XCSOAR,XCSOAR Linux 7.0",
+    "I023638FXA3940SIU",
+    "B1017325050087N00627335EA0044100439000099",
+    "B1017335050088N00627338EA0044200440000099",
+    "LXCSfoo,bar",
+  };
+
+  GRecord grecord;
+  grecord.Initialize();
+
+  std::string igc;
+  for (const char *record : records) {
+    grecord.AppendRecordToBuffer(record);
+    igc.append(record);
+    igc.push_back('\n');
+  }
+
+  grecord.FinalizeBuffer();
+
+  char digest[GRecord::DIGEST_LENGTH + 1];
+  grecord.GetDigest(digest);
+
+  for (std::size_t i = 0; i < GRecord::DIGEST_LENGTH; i += 16) {
+    igc.push_back('G');
+    igc.append(digest + i, 16);
+    igc.push_back('\n');
+  }
+
+  ok1(VerifyString(igc));
+
+  /* modify one digit of the first B record */
+  igc[igc.find("B1017325050087N") + 10] = '9';
+  ok1(!VerifyString(igc));
+}
+
 int main()
 try {
-  plan_tests(4);
+  plan_tests(6);
 
   CheckGRecord(_T("test/data/grecord64a.igc"));
   CheckGRecord(_T("test/data/grecord64b.igc"));
   CheckGRecord(_T("test/data/grecord65a.igc"));
   CheckGRecord(_T("test/data/grecord65b.igc"));
 
+  TestSignVerify();
+
   return exit_status();
 } catch (...) {
   PrintException(std::current_exception());
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "GlideComputerReplay.hpp"
+#include "DebugReplayIGC.hpp"
+#include "system/Path.hpp"
+#include "TestUtil.hpp"
+
+#include <memory>
+
+/* fake symbols: */
+
+#include "Input/InputQueue.hpp"
+#include "Logger/Logger.hpp"
+
+bool InputEvents::processGlideComputer(unsigned) { return false; }
+
+void Logger::LogStartEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogFinishEvent([[maybe_unused]] const NMEAInfo &gps_info) {}
+void Logger::LogPoint([[maybe_unused]] const NMEAInfo &gps_info) {}
+
+/* done with fake symbols. */
+
+static bool
+Replay(GlideComputerReplay &replay)
+{
+  std::unique_ptr<DebugReplay> input{
+    DebugReplayIGC::Create(Path(_T("test/data/01lz1hq1.igc")))
+  };
+  if (!input)
+    return false;
+
+  while (replay.Next(*input)) {}
+
+  replay.Finish();
+  return true;
+}
+
+int
+main()
+{
+  plan_tests(8);
+
+  GlideComputerReplay a, b;
+  if (!Replay(a) || !Replay(b))
+    skip(8, 0, "Failed to open the flight");
+  else {
+    /* the fixes of this file are 4 seconds apart, and ProcessIdle()
+       runs for each of them, no matter how fast this host is */
+    const auto duration = a.GetReplayedDuration();
+    ok1(duration.count() > 0);
+    ok1(a.GetIdleCount() * 4 >= duration.count());
+
+    /* the stages of ProcessIdle() have run */
+    const StageTimingInfo &timing =
+      a.GetGlideComputer().Calculated().stage_timing;
+    ok1(timing[ComputerStage::STATS].count > 0);
+    ok1(timing[ComputerStage::LOG].count > 0);
+    ok1(timing[ComputerStage::WARNING].count > 0);
+    ok1(timing[ComputerStage::CONTEST].count > 0);
+
+    /* the results do not depend on the wall clock */
+    ok1(a.GetIdleCount() == b.GetIdleCount());
+    ok1(a.MakeDigest() == b.MakeDigest());
+  }
+
+  return exit_status();
+}
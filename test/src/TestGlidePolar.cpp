@@ -3,10 +3,43 @@
 
 #include "TestUtil.hpp"
 #include "GlideSolvers/GlidePolar.hpp"
+#include "GlideSolvers/GlideSettings.hpp"
+#include "GlideSolvers/GlideState.hpp"
+#include "GlideSolvers/GlideResult.hpp"
+#include "GlideSolvers/MacCready.hpp"
+#include "Geo/SpeedVector.hpp"
+#include "Math/ZeroFinder.hpp"
 #include "Units/System.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstdio>
 
+/**
+ * The numerical speed to fly search which was used by
+ * GlidePolar::SpeedToFly() before it was replaced with the closed
+ * form solution.
+ */
+class SpeedToFlyReference final : public ZeroFinder {
+  const GlidePolar &polar;
+  const double net_sink_rate, head_wind;
+
+public:
+  SpeedToFlyReference(const GlidePolar &_polar, double _net_sink_rate,
+                      double _head_wind) noexcept
+    :ZeroFinder(std::max(1., _polar.GetVMin() - _head_wind),
+                _polar.GetVMax() - _head_wind, 0.0001),
+     polar(_polar), net_sink_rate(_net_sink_rate), head_wind(_head_wind) {}
+
+  double f(const double V) noexcept override {
+    return (polar.MSinkRate(V + head_wind) + net_sink_rate) / V;
+  }
+
+  double Solve() noexcept {
+    return find_min(polar.GetVMax()) + head_wind;
+  }
+};
+
 class GlidePolarTest
 {
   GlidePolar polar;
@@ -20,6 +53,8 @@ private:
   void TestBallast();
   void TestBugs();
   void TestMC();
+  void TestSpeedToFly();
+  void TestOptimiseGlide();
 };
 
 void
@@ -145,6 +180,101 @@ GlidePolarTest::TestMC()
   ok1(equals(polar.GetVBestLD(), 25.830434162));
 }
 
+void
+GlidePolarTest::TestSpeedToFly()
+{
+  /* compare with the numerical search over a grid of MacCready
+     settings, netto sink rates and head winds; the closed form
+     solution must be at least as good as the one found by the
+     search, and not differ by more than 0.5% */
+
+  unsigned n_better = 0, n_close = 0, n = 0;
+
+  for (double mc : {0., 0.5, 1., 2., 4.}) {
+    polar.SetMC(mc);
+
+    for (double net_sink = -3; net_sink <= 3; net_sink += 0.5) {
+      for (double head_wind = -20; head_wind <= 20; head_wind += 2.5) {
+        const double v = polar.SpeedToFly(net_sink, head_wind);
+        const double v_ref =
+          SpeedToFlyReference(polar, net_sink, head_wind).Solve();
+
+        const auto f = [&](double _v){
+          return (polar.MSinkRate(_v) + net_sink) / (_v - head_wind);
+        };
+
+        ++n;
+        if (f(v) <= f(v_ref) + 1e-6)
+          ++n_better;
+        if (fabs(v - v_ref) <= 0.005 * v_ref)
+          ++n_close;
+      }
+    }
+  }
+
+  ok1(n_better == n);
+  ok1(n_close == n);
+
+  polar.SetMC(0);
+}
+
+void
+GlidePolarTest::TestOptimiseGlide()
+{
+  /* at MC=0, MacCready::Solve() searches the optimal glide speed; its
+     result must be within 0.1% of a brute force scan, with and
+     without cross wind */
+
+  GlideSettings settings;
+  settings.SetDefaults();
+
+  /* Init() doesn't set the cruise efficiency */
+  GlidePolar polar = this->polar;
+  polar.SetCruiseEfficiency(1);
+
+  std::array<GlideState, 8> states{
+    GlideState{GeoVector{10000, Angle::Zero()}, 0, 1000, SpeedVector::Zero()},
+    GlideState{GeoVector{10000, Angle::Zero()}, 0, 1000,
+               SpeedVector{Angle::Zero(), 10}},
+    GlideState{GeoVector{10000, Angle::Zero()}, 0, 1000,
+               SpeedVector{Angle::HalfCircle(), 10}},
+    GlideState{GeoVector{10000, Angle::Zero()}, 0, 1000,
+               SpeedVector{Angle::QuarterCircle(), 10}},
+    GlideState{GeoVector{30000, Angle::Degrees(30)}, 0, 500,
+               SpeedVector{Angle::Degrees(100), 15}},
+    GlideState{GeoVector{30000, Angle::Degrees(200)}, 0, 2000,
+               SpeedVector{Angle::Degrees(100), 5}},
+    GlideState{GeoVector{5000, Angle::Degrees(270)}, 0, 300,
+               SpeedVector{Angle::Degrees(45), 8}},
+    GlideState{GeoVector{50000, Angle::Degrees(90)}, 0, 3000,
+               SpeedVector{Angle::Degrees(60), 20}},
+  };
+
+  std::array<GlideResult, states.size()> results;
+  MacCready::Solve(settings, polar, states, results);
+
+  const MacCready mac(settings, polar);
+
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    const GlideState &state = states[i];
+    const GlideResult &result = results[i];
+
+    double best = 1e6;
+    for (double v = polar.GetVMin(); v <= polar.GetVMax(); v += 0.01) {
+      const GlideResult r = mac.SolveGlide(state, v);
+      if (r.IsOk())
+        best = std::min(best, r.height_glide);
+    }
+
+    const GlideResult single =
+      MacCready::Solve(settings, polar, state);
+
+    ok1(result.IsOk());
+    ok1(result.height_glide <= best * 1.001);
+    ok1(equals(result.height_glide, single.height_glide));
+  }
+}
+
 void
 GlidePolarTest::Run()
 {
@@ -153,11 +283,13 @@ GlidePolarTest::Run()
   TestBallast();
   TestBugs();
   TestMC();
+  TestSpeedToFly();
+  TestOptimiseGlide();
 }
 
 int main()
 {
-  plan_tests(46);
+  plan_tests(46 + 2 + 3 * 8);
 
   GlidePolarTest test;
   test.Run();
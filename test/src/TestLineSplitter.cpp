@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Device/Util/LineSplitter.hpp"
+#include "TestUtil.hpp"
+
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+/**
+ * Records the lines and the chunks they were delivered in.
+ */
+class RecordingSplitter final : public PortLineSplitter {
+public:
+  std::vector<std::string> lines;
+  std::vector<unsigned> batches;
+
+  bool Feed(const char *s) noexcept {
+    return DataReceived(std::as_bytes(std::span{s, strlen(s)}));
+  }
+
+protected:
+  bool LinesReceived(std::span<const char *const> l) noexcept override {
+    batches.push_back(l.size());
+    return PortLineSplitter::LinesReceived(l);
+  }
+
+  bool LineReceived(const char *line) noexcept override {
+    lines.emplace_back(line);
+    return true;
+  }
+};
+
+static void
+TestBatch()
+{
+  RecordingSplitter s;
+
+  /* three lines in one chunk are delivered together */
+  ok1(s.Feed("$GPGGA,1*00\r\n$PFLAU,2*00\r\n$LXWP0,3*00\r\n"));
+  ok1(s.batches.size() == 1 && s.batches[0] == 3);
+  ok1(s.lines.size() == 3);
+  ok1(s.lines[0] == "$GPGGA,1*00");
+  ok1(s.lines[2] == "$LXWP0,3*00");
+
+  /* a partial line waits for the next chunk */
+  ok1(s.Feed("$GPRMC,"));
+  ok1(s.batches.size() == 1);
+  ok1(s.Feed("4*00\r\n$GP"));
+  ok1(s.batches.size() == 2 && s.batches[1] == 1);
+  ok1(s.lines.back() == "$GPRMC,4*00");
+}
+
+static void
+TestLargeChunk()
+{
+  RecordingSplitter s;
+
+  /* a chunk larger than the internal buffer */
+  std::string chunk;
+  for (unsigned i = 0; i < 100; ++i)
+    chunk += "$PGRMZ," + std::to_string(i) + ",F,2*00\r\n";
+
+  ok1(s.Feed(chunk.c_str()));
+  ok1(s.batches.size() == 1 && s.batches[0] == 100);
+  ok1(s.lines.size() == 100 &&
+      s.lines.front() == "$PGRMZ,0,F,2*00" &&
+      s.lines.back() == "$PGRMZ,99,F,2*00");
+}
+
+static void
+TestSanitise()
+{
+  RecordingSplitter s;
+
+  /* control characters are replaced, trailing whitespace and control
+     characters are removed */
+  ok1(s.Feed("ab\tc\r\n$GPGSA*00 \x01\r\n"));
+  ok1(s.lines.size() == 2);
+  ok1(s.lines[0] == "ab c");
+  ok1(s.lines[1] == "$GPGSA*00");
+}
+
+int main()
+{
+  plan_tests(17);
+
+  TestBatch();
+  TestLargeChunk();
+  TestSanitise();
+
+  return exit_status();
+}
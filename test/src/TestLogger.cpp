@@ -125,27 +125,32 @@ Run(IGCWriter &writer)
 
   writer.Flush();
   writer.Sign();
-  writer.Flush();
+  writer.Sync();
 }
 
 static void
 Run(Path path)
 {
-  IGCWriter writer(path);
+  /* with this latency budget, only Sync() writes the file */
+  IGCWriter writer(path, std::chrono::hours{1});
   Run(writer);
+
+  CheckTextFile(path, expect);
+
+  const auto statistics = writer.GetWriterStatistics();
+  ok1(statistics.pending_bytes == 0);
+  ok1(statistics.batches == 1);
 }
 
 int main()
 try {
-  plan_tests(51);
+  plan_tests(53);
 
   const Path path(_T("output/test/test.igc"));
   File::Delete(path);
 
   Run(path);
 
-  CheckTextFile(path, expect);
-
   GRecord grecord;
   grecord.Initialize();
   grecord.VerifyGRecordInFile(path);
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "NMEA/Sentence.hpp"
+#include "NMEA/SentenceTable.hpp"
+#include "NMEA/Checksum.hpp"
+#include "TestUtil.hpp"
+
+using std::string_view_literals::operator""sv;
+
+/**
+ * Does NMEASentence agree with VerifyNMEAChecksum()?
+ */
+static bool
+SameChecksumResult(const char *line) noexcept
+{
+  return NMEASentence(line).IsChecksumValid() == VerifyNMEAChecksum(line);
+}
+
+static void
+TestChecksum()
+{
+  ok1(NMEASentence("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*63").IsChecksumValid());
+  ok1(!NMEASentence("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*64").IsChecksumValid());
+  ok1(!NMEASentence("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C").IsChecksumValid());
+
+  ok1(SameChecksumResult("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*63"));
+  ok1(SameChecksumResult("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*"));
+  ok1(SameChecksumResult("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*63X"));
+  ok1(SameChecksumResult("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*163"));
+  ok1(SameChecksumResult("$A*B*29"));
+  ok1(SameChecksumResult("!ABC*40"));
+  ok1(SameChecksumResult(""));
+}
+
+static void
+TestSplit()
+{
+  NMEASentence sentence("$PFLAU,3,1,2,1,1,-45,2,50,75,1A304C*63");
+  ok1(sentence.GetType() == "$PFLAU"sv);
+
+  NMEAInputLine line = sentence.GetLine();
+  ok1(line.Read(0) == 3);
+  line.Skip(8);
+  ok1(line.ReadView() == "1A304C"sv);
+  ok1(line.IsEmpty());
+
+  /* no fields */
+  sentence = NMEASentence("$PFLAC*7C");
+  ok1(sentence.GetType() == "$PFLAC"sv);
+  ok1(sentence.GetLine().IsEmpty());
+
+  /* a comma after the asterisk does not end the type */
+  sentence = NMEASentence("$ABC*1,2");
+  ok1(sentence.GetType() == "$ABC"sv);
+  ok1(sentence.GetLine().IsEmpty());
+
+  /* no checksum at all */
+  sentence = NMEASentence("$ABC,1,2");
+  ok1(sentence.GetType() == "$ABC"sv);
+  ok1(sentence.GetLine().Rest() == "1,2"sv);
+}
+
+enum class Test : unsigned {
+  A, B, C, D, E,
+};
+
+static constexpr auto table = MakeNMEASentenceTable<Test>({
+  {"$GPRMC"sv, Test::A},
+  {"$GPGGA"sv, Test::B},
+  {"$PFLAU"sv, Test::C},
+  {"$PFLAA"sv, Test::D},
+  {"$LXWP0"sv, Test::E},
+});
+
+static_assert(*table.Find("$PFLAA"sv) == Test::D);
+static_assert(table.Find("$PFLAX"sv) == nullptr);
+
+static void
+TestTable()
+{
+  ok1(table.Find("$GPRMC"sv) != nullptr && *table.Find("$GPRMC"sv) == Test::A);
+  ok1(table.Find("$GPGGA"sv) != nullptr && *table.Find("$GPGGA"sv) == Test::B);
+  ok1(table.Find("$PFLAU"sv) != nullptr && *table.Find("$PFLAU"sv) == Test::C);
+  ok1(table.Find("$LXWP0"sv) != nullptr && *table.Find("$LXWP0"sv) == Test::E);
+  ok1(table.Find(""sv) == nullptr);
+  ok1(table.Find("$GPRM"sv) == nullptr);
+  ok1(table.Find("$GPRMCX"sv) == nullptr);
+}
+
+int main()
+{
+  plan_tests(27);
+
+  TestChecksum();
+  TestSplit();
+  TestTable();
+
+  return exit_status();
+}
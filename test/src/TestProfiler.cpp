@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Profiler/Profiler.hpp"
+#include "Profiler/ChromeTrace.hpp"
+#include "io/BufferedOutputStream.hxx"
+#include "io/StringOutputStream.hxx"
+#include "util/StringAPI.hxx"
+#include "TestUtil.hpp"
+
+#include <string>
+
+using namespace std::chrono;
+
+static constinit Profiler::Zone a_zone{"A"};
+static constinit Profiler::Zone b_zone{"B"};
+
+static const Profiler::ZoneStatistics *
+FindZone(const std::vector<Profiler::ZoneStatistics> &v, const char *name)
+{
+  for (const auto &i : v)
+    if (StringIsEqual(i.name, name))
+      return &i;
+
+  return nullptr;
+}
+
+static std::size_t
+CountOccurrences(const std::string &haystack, const char *needle)
+{
+  std::size_t n = 0;
+  for (auto i = haystack.find(needle); i != haystack.npos;
+       i = haystack.find(needle, i + 1))
+    ++n;
+  return n;
+}
+
+int
+main()
+{
+  plan_tests(19);
+
+  /* while disabled, nothing is recorded */
+  {
+    const Profiler::Scope scope{a_zone};
+  }
+
+  ok1(Profiler::GetStatistics().empty());
+  ok1(Profiler::GetEvents().empty());
+
+  Profiler::SetEnabled(true);
+  ok1(Profiler::IsEnabled());
+
+  /* 1..100 microseconds, in reverse order */
+  const auto t0 = Profiler::Clock::now();
+  for (unsigned i = 100; i > 0; --i)
+    Profiler::Record(a_zone, t0, t0 + microseconds(i));
+
+  {
+    Profiler::Scope scope{b_zone};
+    scope.Next(a_zone);
+  }
+
+  auto statistics = Profiler::GetStatistics();
+  ok1(statistics.size() == 2);
+
+  const auto *a = FindZone(statistics, "A");
+  ok1(a != nullptr);
+  ok1(a->count == 101);
+  ok1(a->p50 == 50);
+  ok1(a->p95 == 95);
+  ok1(a->max == 100);
+
+  const auto *b = FindZone(statistics, "B");
+  ok1(b != nullptr);
+  ok1(b->count == 1);
+
+  /* the window only keeps the most recent durations */
+  Profiler::Clear();
+  for (unsigned i = 0; i < Profiler::Zone::WINDOW; ++i)
+    Profiler::Record(b_zone, t0, t0 + milliseconds(1));
+  for (unsigned i = 0; i < Profiler::Zone::WINDOW; ++i)
+    Profiler::Record(b_zone, t0, t0 + microseconds(10));
+
+  statistics = Profiler::GetStatistics();
+  ok1(statistics.size() == 1);
+  ok1(statistics.front().count == 2 * Profiler::Zone::WINDOW);
+  ok1(statistics.front().max == 10);
+
+  /* the trace buffer overwrites the oldest events */
+  Profiler::Clear();
+  for (std::size_t i = 0; i < Profiler::MAX_EVENTS + 10; ++i)
+    Profiler::Record(a_zone, t0 + microseconds(i), t0 + microseconds(i + 1));
+
+  const auto events = Profiler::GetEvents();
+  ok1(events.size() == Profiler::MAX_EVENTS);
+  ok1(events.front().start == t0 + microseconds(10));
+
+  /* export */
+  Profiler::Clear();
+  Profiler::Record(a_zone, t0, t0 + microseconds(5));
+  Profiler::Record(b_zone, t0 + microseconds(10), t0 + microseconds(15));
+
+  StringOutputStream sos;
+  BufferedOutputStream bos(sos);
+  Profiler::WriteChromeTrace(bos);
+  bos.Flush();
+
+  const std::string &json = sos.GetValue();
+  ok1(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  ok1(CountOccurrences(json, "\"ph\":\"X\"") == 2);
+  ok1(json.find("\"name\":\"B\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                "\"ts\":10.0,\"dur\":5.0}") != json.npos);
+
+  return exit_status();
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "util/RadixQueue.hpp"
+#include "TestUtil.hpp"
+
+#include <queue>
+#include <random>
+
+/**
+ * Feed random pushes and pops into a RadixQueue and a
+ * std::priority_queue, and verify that both return the same keys.
+ * Pushed keys may be smaller than the last popped one.
+ */
+static bool
+CompareRandom(unsigned seed, unsigned max_key) noexcept
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<unsigned> key_dist(0, max_key);
+  std::uniform_int_distribution<unsigned> op_dist(0, 2);
+
+  RadixQueue<unsigned> q;
+  std::priority_queue<unsigned, std::vector<unsigned>,
+                      std::greater<unsigned>> reference;
+
+  for (unsigned i = 0; i < 10000; ++i) {
+    if (op_dist(rng) > 0 || reference.empty()) {
+      const unsigned key = key_dist(rng);
+      q.push(key, key);
+      reference.push(key);
+    } else {
+      if (q.top_key() != reference.top() || q.top() != reference.top())
+        return false;
+
+      q.pop();
+      reference.pop();
+    }
+
+    if (q.size() != reference.size())
+      return false;
+  }
+
+  while (!reference.empty()) {
+    if (q.empty() || q.top_key() != reference.top())
+      return false;
+
+    q.pop();
+    reference.pop();
+  }
+
+  return q.empty();
+}
+
+int main()
+{
+  plan_tests(14);
+
+  RadixQueue<char> q;
+  ok1(q.empty());
+
+  q.push(7, 'a');
+  q.push(3, 'b');
+  q.push(12, 'c');
+  ok1(q.size() == 3);
+  ok1(q.top_key() == 3);
+  ok1(q.top() == 'b');
+  q.pop();
+
+  /* smaller than the last extracted minimum */
+  q.push(1, 'd');
+  ok1(q.top() == 'd');
+  q.pop();
+  ok1(q.top() == 'a');
+  q.pop();
+  ok1(q.top() == 'c');
+  q.pop();
+  ok1(q.empty());
+
+  q.push(5, 'e');
+  q.clear();
+  ok1(q.empty());
+  ok1(q.size() == 0);
+
+  ok1(CompareRandom(1, 100));
+  ok1(CompareRandom(2, 100000));
+  ok1(CompareRandom(3, std::numeric_limits<unsigned>::max()));
+  ok1(CompareRandom(4, 3));
+
+  return exit_status();
+}
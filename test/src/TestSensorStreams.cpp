@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "NMEA/SensorStreams.hpp"
+#include "NMEA/Info.hpp"
+#include "util/SPSCRing.hpp"
+#include "TestUtil.hpp"
+
+#include <thread>
+
+static void
+TestRing()
+{
+  SPSCRing<unsigned, 4> ring;
+  ok1(ring.IsEmpty());
+
+  for (unsigned i = 0; i < 4; ++i)
+    ring.Push(i);
+
+  /* full */
+  ok1(!ring.Push(4));
+
+  unsigned sum = 0;
+  ok1(ring.Consume([&sum](unsigned i){ sum += i; }) == 4);
+  ok1(sum == 0 + 1 + 2 + 3);
+  ok1(ring.IsEmpty());
+
+  /* wrap around */
+  ok1(ring.Push(5));
+  ok1(ring.Push(6));
+  unsigned last = 0;
+  ok1(ring.Consume([&last](unsigned i){ last = i; }) == 2);
+  ok1(last == 6);
+}
+
+/**
+ * One thread pushes a sequence of numbers, the other one consumes
+ * them; verify that none is lost, duplicated or reordered.
+ */
+static bool
+TestThreads()
+{
+  static constexpr unsigned N = 200000;
+
+  SPSCRing<unsigned, 64> ring;
+
+  std::thread producer([&ring]{
+    for (unsigned i = 0; i < N;)
+      if (ring.Push(i))
+        ++i;
+      else
+        std::this_thread::yield();
+  });
+
+  unsigned expected = 0;
+  bool in_order = true;
+  while (expected < N)
+    ring.Consume([&](unsigned i){
+      if (i != expected)
+        in_order = false;
+      ++expected;
+    });
+
+  producer.join();
+  return in_order && ring.IsEmpty();
+}
+
+static void
+TestCapture()
+{
+  NMEAInfo info;
+  info.Reset();
+  info.UpdateClock();
+
+  SensorStreams streams;
+
+  /* two samples with the same clock */
+  for (unsigned i = 0; i < 2; ++i) {
+    streams.BeginCapture(info);
+    info.attitude.heading = Angle::Degrees(10);
+    info.attitude.heading_available.Update(info.clock);
+    info.acceleration.ProvideGLoad(1.5);
+    info.ProvideTotalEnergyVario(2);
+    streams.EndCapture(info);
+  }
+
+  /* a line without sensor data must not produce samples, and must
+     not modify the existing ones */
+  streams.BeginCapture(info);
+  streams.EndCapture(info);
+  ok1(info.attitude.heading_available.IsValid());
+  ok1(!info.attitude.bank_angle_available.IsValid());
+  ok1(info.acceleration.available);
+  ok1(info.total_energy_vario_available.IsValid());
+
+  /* a driver explicitly clearing a value */
+  streams.BeginCapture(info);
+  info.attitude.heading_available.Clear();
+  streams.EndCapture(info);
+  ok1(!info.attitude.heading_available.IsValid());
+
+  std::vector<AttitudeSample> attitude;
+  ok1(streams.ConsumeAttitude(&attitude) == 2);
+  ok1(attitude.size() == 2);
+  ok1(attitude[1].heading_available);
+  ok1(!attitude[1].bank_angle_available);
+  ok1(attitude[1].time == info.clock);
+
+  std::vector<AccelerationSample> acceleration;
+  ok1(streams.ConsumeAcceleration(&acceleration) == 2);
+  ok1(equals(acceleration.front().g_load, 1.5));
+
+  ok1(streams.ConsumeVario(nullptr) == 2);
+  ok1(streams.GetDropped() == 0);
+}
+
+int main()
+{
+  plan_tests(24);
+
+  TestRing();
+  ok1(TestThreads());
+  TestCapture();
+
+  return exit_status();
+}
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Copyright The XCSoar Project
+
+#include "Computer/StageTiming.hpp"
+#include "TestUtil.hpp"
+
+static void
+TestAdd()
+{
+  StageTiming t;
+  t.Clear();
+
+  t.Add(100);
+  ok1(t.count == 1);
+  ok1(t.last == 100);
+  ok1(t.mean == 100);
+  ok1(t.max == 100);
+
+  /* the mean converges slowly, also for very short durations */
+  for (unsigned i = 0; i < 100; ++i)
+    t.Add(4);
+  ok1(t.mean == 4);
+  ok1(t.last == 4);
+
+  /* a peak is forgotten after two windows */
+  ok1(t.max == 100);
+  for (unsigned i = 0; i < StageTiming::WINDOW * 2; ++i)
+    t.Add(4);
+  ok1(t.max == 4);
+}
+
+static void
+TestDefer()
+{
+  StageTimingInfo info;
+  info.Clear();
+
+  /* not overloaded: never defer */
+  info.BeginTick();
+  ok1(!info.CheckDefer(ComputerStage::CONTEST));
+
+  /* overloaded: defer, but not forever */
+  unsigned n_deferred = 0;
+  for (unsigned i = 0; i < 10; ++i) {
+    info.BeginTick();
+    info.overloaded = true;
+    if (info.CheckDefer(ComputerStage::CONTEST))
+      ++n_deferred;
+  }
+
+  ok1(n_deferred == 8);
+  ok1(info[ComputerStage::CONTEST].deferred == 8);
+  ok1(info[ComputerStage::ROUTE].deferred == 0);
+
+  /* pending measurements are committed once per tick */
+  info[ComputerStage::TASK].pending = 30;
+  info[ComputerStage::TASK].has_pending = true;
+  info.Commit();
+  ok1(info[ComputerStage::TASK].count == 1);
+  ok1(info[ComputerStage::TASK].last == 30);
+  ok1(!info[ComputerStage::TASK].has_pending);
+  ok1(info[ComputerStage::ROUTE].count == 0);
+}
+
+int
+main()
+{
+  plan_tests(16);
+
+  TestAdd();
+  TestDefer();
+
+  return exit_status();
+}
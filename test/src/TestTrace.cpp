@@ -13,28 +13,73 @@
 #include "util/PrintException.hxx"
 
 #include <windef.h>
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdio>
 
 #include <tchar.h>
 
 using namespace std::chrono;
 
+/**
+ * Accumulated cost of the #Trace operations.  Appends which thinned
+ * the trace (i.e. which changed the modify serial) are counted
+ * separately.
+ */
+struct TraceTiming {
+  unsigned n_appends = 0, n_thins = 0, n_snapshots = 0;
+  duration<double> append{}, thin{}, copy{}, span{};
+
+  void Print() const noexcept {
+    if (n_appends > 0)
+      printf("# append %.0f ns\n", append.count() * 1e9 / n_appends);
+    if (n_thins > 0)
+      printf("# thin %.1f us (%u)\n", thin.count() * 1e6 / n_thins, n_thins);
+    if (n_snapshots > 0)
+      printf("# snapshot copy %.0f ns, span %.0f ns\n",
+             copy.count() * 1e9 / n_snapshots,
+             span.count() * 1e9 / n_snapshots);
+  }
+};
+
 static void
 OnAdvance(Trace &trace, const GeoPoint &loc, const double alt,
-          const TimeStamp t) noexcept
+          const TimeStamp t, TraceTiming &timing) noexcept
 {
   if (t.IsDefined()) {
     const TracePoint point(loc, t.Cast<duration<unsigned>>(),
                            alt, 0, 0);
+    const Serial modify_serial = trace.GetModifySerial();
+    const auto start = steady_clock::now();
     trace.push_back(point);
+    const auto elapsed = steady_clock::now() - start;
+
+    if (trace.GetModifySerial() != modify_serial) {
+      ++timing.n_thins;
+      timing.thin += elapsed;
+    } else {
+      ++timing.n_appends;
+      timing.append += elapsed;
+    }
   }
+
 // get the trace, just so it's included in timing
+  auto start = steady_clock::now();
   TracePointVector v;
   trace.GetPoints(v);
-  if (trace.size()>1) {
-//    assert(abs(v.size()-trace.size())<2);
-  }
+  timing.copy += steady_clock::now() - start;
+
+  start = steady_clock::now();
+  const auto span = trace.GetPoints();
+  timing.span += steady_clock::now() - start;
+  ++timing.n_snapshots;
+
+  assert(span.size() == v.size());
+  assert(std::equal(span.begin(), span.end(), v.begin(),
+                    [](const TracePoint &a, const TracePoint &b){
+                      return a.GetTime() == b.GetTime();
+                    }));
 }
 
 static bool
@@ -48,6 +93,8 @@ TestTrace(Path filename, unsigned ntrace, bool output=false)
   IGCExtensions extensions;
   extensions.clear();
 
+  TraceTiming timing;
+
   char *line;
   int i = 0;
   for (; (line = reader.ReadLine()) != NULL; i++) {
@@ -63,10 +110,12 @@ TestTrace(Path filename, unsigned ntrace, bool output=false)
     OnAdvance(trace,
               fix.location,
               fix.gps_altitude,
-              TimeStamp{fix.time.DurationSinceMidnight()});
+              TimeStamp{fix.time.DurationSinceMidnight()},
+              timing);
   }
   putchar('\n');
   printf("# samples %d\n", i);
+  timing.Print();
   return true;
 }
 
@@ -1,25 +1,80 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 // Copyright The XCSoar Project
 
+/*
+ * Verify the G record of one or more IGC files.  Multiple files are
+ * verified in parallel, one file per job.
+ *
+ * Usage: VerifyGRecord FILE.igc...
+ */
+
 #include "Logger/GRecord.hpp"
 #include "system/Args.hpp"
+#include "system/FileUtil.hpp"
+#include "thread/WorkStealingPool.hpp"
 #include "util/PrintException.hxx"
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <vector>
+
 #include <stdio.h>
 
+using namespace std::chrono;
+
 int
 main(int argc, char **argv)
 try {
-  Args args(argc, argv, "FILE.igc");
-  const auto path = args.ExpectNextPath();
-  args.ExpectEnd();
+  Args args(argc, argv, "FILE.igc...");
+
+  std::vector<AllocatedPath> paths;
+  do {
+    paths.emplace_back(args.ExpectNextPath());
+  } while (!args.IsEmpty());
+
+  std::vector<std::exception_ptr> errors(paths.size());
+
+  WorkStealingPool pool(std::max(std::thread::hardware_concurrency(), 1U));
+
+  const auto start = steady_clock::now();
+  pool.Run(paths.size(), [&paths, &errors](std::size_t i, unsigned) {
+    try {
+      GRecord g;
+      g.Initialize();
+      g.VerifyGRecordInFile(paths[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  });
+  const duration<double> elapsed = steady_clock::now() - start;
+
+  if (paths.size() == 1) {
+    if (errors.front())
+      std::rethrow_exception(errors.front());
+
+    fprintf(stderr, "G record is ok\n");
+    return EXIT_SUCCESS;
+  }
+
+  unsigned n_failed = 0;
+  uint64_t total_size = 0;
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    total_size += File::GetSize(paths[i]);
+
+    if (errors[i]) {
+      ++n_failed;
+      fprintf(stderr, "%s: ", paths[i].c_str());
+      PrintException(errors[i]);
+    }
+  }
 
-  GRecord g;
-  g.Initialize();
+  fprintf(stderr, "%zu of %zu G records are ok (%.1f MB/s)\n",
+          paths.size() - n_failed, paths.size(),
+          total_size / elapsed.count() / (1024 * 1024));
 
-  g.VerifyGRecordInFile(path);
-  fprintf(stderr, "G record is ok\n");
-  return EXIT_SUCCESS;
+  return n_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 } catch (...) {
   PrintException(std::current_exception());
   return EXIT_FAILURE;
@@ -21,6 +21,8 @@
 
 #include <zzip/zzip.h>
 
+#include <vector>
+
 #include <string.h>
 
 static void
@@ -50,6 +52,9 @@ test_reach(const RasterMap &map, double mwind, double mc, double height_min_work
                                               true, true);
   PrintHelper::print(reach_working);
 
+  std::vector<AGeoPoint> dests;
+  std::vector<ReachResult> expected;
+
   {
     Directory::Create(Path(_T("output/results")));
     std::ofstream fout("output/results/terrain.txt");
@@ -65,6 +70,8 @@ test_reach(const RasterMap &map, double mwind, double mc, double height_min_work
         AGeoPoint adest(x, h);
         const auto reach = reach_terrain.FindPositiveArrival(adest,
                                                              route.GetReachPolar());
+        dests.push_back(adest);
+        expected.push_back(*reach);
         if ((i % 5 == 0) && (j % 5 == 0)) {
           AGeoPoint ao2(x, h + 1000);
           [[maybe_unused]] auto reach2 =
@@ -80,6 +87,17 @@ test_reach(const RasterMap &map, double mwind, double mc, double height_min_work
     fout << "\n";
   }
 
+  /* the batch solver must produce the same results */
+  std::vector<ReachResult> results(dests.size());
+  bool batch_ok = reach_terrain.FindPositiveArrivals(dests, results,
+                                                     route.GetReachPolar());
+  for (std::size_t i = 0; batch_ok && i < dests.size(); ++i)
+    batch_ok = results[i].direct == expected[i].direct &&
+      results[i].terrain_valid == expected[i].terrain_valid &&
+      (results[i].terrain_valid == ReachResult::Validity::INVALID ||
+       results[i].terrain == expected[i].terrain);
+  ok1(batch_ok);
+
   //  double pd = map.PixelDistance(origin, 1);
   //  printf("# pixel size %g\n", (double)pd);
 }
@@ -118,7 +136,7 @@ try {
   } while (map.IsDirty());
   zzip_dir_close(dir);
 
-  plan_tests(6);
+  plan_tests(4);
   test_reach(map, 0, 0.1, 0);
   test_reach(map, 0, 0.1, 750);
   test_reach(map, 0, 0.1, 500);
@@ -130,6 +130,7 @@ test_route(const unsigned n_airspaces, const RasterMap& map)
     GlideSettings settings;
     settings.SetDefaults();
     RoutePlannerConfig config;
+    config.SetDefaults();
     config.mode = RoutePlannerConfig::Mode::BOTH;
 
     AirspaceRoute route;